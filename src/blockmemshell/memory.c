@@ -656,6 +656,308 @@ void BMSfreeMemoryNull_call(
 }
 
 
+/***********************************************************
+ * Memory Accounting
+ *
+ * Attribution of used block and buffer memory to the source files that allocate it
+ ***********************************************************/
+
+#define ACCOUNT_INITHASHSIZE       64                 /**< initial size of the hash table of a memory account */
+
+/** memory usage of a single source file */
+typedef struct BMS_MemAccountFile
+{
+   const char*           filename;           /**< name of the source file */
+   long long             memused;            /**< number of bytes currently used by the file */
+   long long             maxmemused;         /**< maximal number of bytes used by the file */
+} BMS_MEMACCOUNTFILE;
+
+/** memory usage per source file of block and buffer memories
+ *
+ *  The files are looked up by the address of the filename string, which is usually the same for all allocations of a
+ *  source file, in an open addressing hash table. Different addresses with equal names are mapped to the same file.
+ */
+struct BMS_MemAccount
+{
+   BMS_MEMACCOUNTFILE*   files;              /**< memory usage of the source files */
+   const char**          hashkeys;           /**< filename addresses in the hash table, NULL for empty slots */
+   int*                  hashfiles;          /**< indices of the files belonging to the hash table slots */
+   int                   nfiles;             /**< number of source files */
+   int                   filessize;          /**< size of files array */
+   int                   hashsize;           /**< size of hash table, a power of two */
+};
+
+/** returns the first hash table slot of the given filename address */
+static
+int accountHashSlot(
+   const BMS_MEMACCOUNT* account,            /**< memory account */
+   const char*           filename            /**< address of filename */
+   )
+{
+   uint64_t key;
+
+   key = (uint64_t)(uintptr_t)filename;
+   key = (key >> 3) * UINT64_C(0x9e3779b97f4a7c15);
+
+   return (int)((key >> 32) & (uint64_t)(unsigned)(account->hashsize - 1));
+}
+
+/** inserts the filename address with the given file index into the hash table, which must have a free slot */
+static
+void accountHashInsert(
+   BMS_MEMACCOUNT*       account,            /**< memory account */
+   const char*           filename,           /**< address of filename */
+   int                   fileidx             /**< index of the file */
+   )
+{
+   int slot;
+
+   slot = accountHashSlot(account, filename);
+   while( account->hashkeys[slot] != NULL )
+      slot = (slot + 1) & (account->hashsize - 1);
+
+   account->hashkeys[slot] = filename;
+   account->hashfiles[slot] = fileidx;
+}
+
+/** returns the file of the given filename address, adding it to the account if necessary; returns NULL if there is not
+ *  enough memory for the account
+ */
+static
+BMS_MEMACCOUNTFILE* accountGetFile(
+   BMS_MEMACCOUNT*       account,            /**< memory account */
+   const char*           filename            /**< address of filename */
+   )
+{
+   int slot;
+   int i;
+
+   assert(account != NULL);
+   assert(filename != NULL);
+
+   slot = accountHashSlot(account, filename);
+   while( account->hashkeys[slot] != NULL )
+   {
+      if( account->hashkeys[slot] == filename )
+         return &account->files[account->hashfiles[slot]];
+      slot = (slot + 1) & (account->hashsize - 1);
+   }
+
+   /* keep the hash table at most half full */
+   if( 2 * (account->nfiles + 1) > account->hashsize )
+   {
+      const char** oldkeys;
+      int* oldfiles;
+      int oldsize;
+
+      oldkeys = account->hashkeys;
+      oldfiles = account->hashfiles;
+      oldsize = account->hashsize;
+
+      BMSallocClearMemoryArray(&account->hashkeys, 2 * oldsize);
+      BMSallocMemoryArray(&account->hashfiles, 2 * oldsize);
+      if( account->hashkeys == NULL || account->hashfiles == NULL )
+      {
+         BMSfreeMemoryArrayNull(&account->hashkeys);
+         BMSfreeMemoryArrayNull(&account->hashfiles);
+         account->hashkeys = oldkeys;
+         account->hashfiles = oldfiles;
+         return NULL;
+      }
+      account->hashsize = 2 * oldsize;
+
+      for( i = 0; i < oldsize; ++i )
+      {
+         if( oldkeys[i] != NULL )
+            accountHashInsert(account, oldkeys[i], oldfiles[i]);
+      }
+      BMSfreeMemoryArray(&oldkeys);
+      BMSfreeMemoryArray(&oldfiles);
+   }
+
+   /* the same name may be stored at a different address, e.g., for allocations in inline functions of headers */
+   for( i = 0; i < account->nfiles; ++i )
+   {
+      if( strcmp(account->files[i].filename, filename) == 0 )
+         break;
+   }
+
+   if( i == account->nfiles )
+   {
+      if( account->nfiles == account->filessize )
+      {
+         BMS_MEMACCOUNTFILE* newfiles;
+         int newsize;
+
+         newsize = MAX(2 * account->filessize, ACCOUNT_INITHASHSIZE / 2);
+         newfiles = account->files;
+         BMSreallocMemoryArray(&newfiles, newsize);
+         if( newfiles == NULL )
+            return NULL;
+         account->files = newfiles;
+         account->filessize = newsize;
+      }
+
+      account->files[i].filename = filename;
+      account->files[i].memused = 0;
+      account->files[i].maxmemused = 0;
+      ++account->nfiles;
+   }
+
+   accountHashInsert(account, filename, i);
+
+   return &account->files[i];
+}
+
+/** adds the given number of bytes to the memory used by the given source file */
+static
+void accountAddMemory(
+   BMS_MEMACCOUNT*       account,            /**< memory account, or NULL */
+   const char*           filename,           /**< source file of the allocation */
+   long long             size                /**< number of bytes to add, negative for frees */
+   )
+{
+   BMS_MEMACCOUNTFILE* file;
+
+   if( account == NULL )
+      return;
+
+   /* silently skip the bookkeeping if the account runs out of memory */
+   file = accountGetFile(account, filename);
+   if( file == NULL )
+      return;
+
+   file->memused += size;
+   file->maxmemused = MAX(file->maxmemused, file->memused);
+}
+
+/** creates an empty memory account */
+BMS_MEMACCOUNT* BMScreateMemoryAccount_call(
+   const char*           filename,           /**< source file of the function call */
+   int                   line                /**< line number in source file of the function call */
+   )
+{
+   BMS_MEMACCOUNT* account;
+
+   BMSallocMemory(&account);
+   if( account != NULL )
+   {
+      account->files = NULL;
+      account->nfiles = 0;
+      account->filessize = 0;
+      account->hashsize = ACCOUNT_INITHASHSIZE;
+      BMSallocClearMemoryArray(&account->hashkeys, account->hashsize);
+      BMSallocMemoryArray(&account->hashfiles, account->hashsize);
+
+      if( account->hashkeys == NULL || account->hashfiles == NULL )
+      {
+         BMSfreeMemoryArrayNull(&account->hashkeys);
+         BMSfreeMemoryArrayNull(&account->hashfiles);
+         BMSfreeMemory(&account);
+      }
+   }
+
+   if( account == NULL )
+   {
+      printErrorHeader(filename, line);
+      printError("Insufficient memory for memory account.\n");
+   }
+
+   return account;
+}
+
+/** frees a memory account; the account must not be attached to a block or buffer memory anymore */
+void BMSdestroyMemoryAccount_call(
+   BMS_MEMACCOUNT**      account,            /**< pointer to memory account */
+   const char*           filename,           /**< source file of the function call */
+   int                   line                /**< line number in source file of the function call */
+   )
+{
+   assert(account != NULL);
+
+   if( *account != NULL )
+   {
+      BMSfreeMemoryArrayNull(&(*account)->files);
+      BMSfreeMemoryArray(&(*account)->hashfiles);
+      BMSfreeMemoryArray(&(*account)->hashkeys);
+      BMSfreeMemory(account);
+   }
+   else
+   {
+      printErrorHeader(filename, line);
+      printError("Tried to destroy null memory account.\n");
+   }
+}
+
+/** resets the used and maximal used bytes of all source files to zero */
+void BMSclearMemoryAccount(
+   BMS_MEMACCOUNT*       account             /**< memory account */
+   )
+{
+   int i;
+
+   assert(account != NULL);
+
+   for( i = 0; i < account->nfiles; ++i )
+   {
+      account->files[i].memused = 0;
+      account->files[i].maxmemused = 0;
+   }
+}
+
+/** returns the number of source files that allocated memory since the account was created */
+int BMSgetMemoryAccountNFiles(
+   const BMS_MEMACCOUNT* account             /**< memory account */
+   )
+{
+   assert(account != NULL);
+
+   return account->nfiles;
+}
+
+/** returns the name of the i-th source file of the account */
+const char* BMSgetMemoryAccountFile(
+   const BMS_MEMACCOUNT* account,            /**< memory account */
+   int                   i                   /**< index of the source file, 0 <= i < BMSgetMemoryAccountNFiles() */
+   )
+{
+   assert(account != NULL);
+   assert(0 <= i && i < account->nfiles);
+
+   return account->files[i].filename;
+}
+
+/** returns the number of bytes currently used by the i-th source file of the account
+ *
+ *  @note Memory is attributed to the file that allocates it and subtracted from the file that frees it, such that the
+ *        value may become negative for files that free memory allocated elsewhere.
+ */
+long long BMSgetMemoryAccountUsed(
+   const BMS_MEMACCOUNT* account,            /**< memory account */
+   int                   i                   /**< index of the source file, 0 <= i < BMSgetMemoryAccountNFiles() */
+   )
+{
+   assert(account != NULL);
+   assert(0 <= i && i < account->nfiles);
+
+   return account->files[i].memused;
+}
+
+/** returns the maximal number of bytes used by the i-th source file of the account at any time */
+long long BMSgetMemoryAccountUsedMax(
+   const BMS_MEMACCOUNT* account,            /**< memory account */
+   int                   i                   /**< index of the source file, 0 <= i < BMSgetMemoryAccountNFiles() */
+   )
+{
+   assert(account != NULL);
+   assert(0 <= i && i < account->nfiles);
+
+   return account->files[i].maxmemused;
+}
+
+
+
+
 /***********************************************************
  * Block Memory Management (forward declaration)
  *
@@ -677,6 +979,7 @@ struct BMS_BlkMem
    int                   initchunksize;      /**< number of elements in the first chunk of each chunk block */
    int                   garbagefactor;      /**< garbage collector is called, if at least garbagefactor * avg. chunksize
                                               *   elements are free (-1: disable garbage collection) */
+   BMS_MEMACCOUNT*       account;            /**< memory account recording the used bytes per source file, or NULL */
 };
 
 
@@ -927,6 +1230,372 @@ void checkChkmem(
 #endif
 
 
+/*
+ * pool of unused chunks shared by all chunk blocks
+ *
+ * Destroyed chunks are not returned to the operating system immediately, but kept for reuse by chunks of the same
+ * size, which are taken from the pool before new memory is allocated. Since all chunk blocks, i.e., the block memories
+ * of all SCIP instances, share the pool, memory released by the garbage collection or destruction of one block memory
+ * can be reused by another one, e.g., by a sub-SCIP created later or by a different concurrent solver.
+ *
+ * The chunk blocks themselves remain private to their block memory and serve allocations without synchronization. In
+ * front of the shared part of the pool, each thread has a magazine of unused chunks: chunks destroyed by a thread are
+ * first put into its magazine and chunks are first taken from its magazine, such that the lock of the shared part is
+ * only needed if the magazine is full or does not contain a chunk of the requested size. The magazines are assigned to
+ * the threads round-robin; each one has its own lock, which is only contended if there are more threads than
+ * magazines. Half of the maximal size of the pool is reserved for the shared part, the other half is divided evenly
+ * among the magazines.
+ *
+ * The pool lives as long as chunk blocks exist: when the last chunk block is destroyed, e.g., when the last SCIP
+ * instance is freed, all pooled chunks are freed.
+ */
+
+#define CHUNKPOOL_NBUCKETS          64 /**< number of buckets of the hash table of pooled chunks */
+#define CHUNKPOOL_NMAGAZINES        32 /**< number of magazines of pooled chunks for the threads */
+#define CHUNKPOOL_MAXSIZE  (32LL << 20) /**< default maximal number of bytes kept in the chunk pool */
+
+#if defined(ENABLE_MEMLIST_CHECKS)
+/* pooled chunks would show up as memory leaks in the memory list */
+#define BMS_NOCHUNKPOOL
+#elif defined(SCIP_THREADSAFE)
+#if defined(__GNUC__) || defined(_MSC_VER)
+#define CHUNKPOOL_THREADSAFE
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_ATOMICS__) && !defined(__STDC_NO_THREADS__)
+#include <stdatomic.h>
+#define CHUNKPOOL_THREADSAFE
+#define CHUNKPOOL_STDATOMIC
+#else
+/* without atomics, the pool cannot be shared safely between threads */
+#define BMS_NOCHUNKPOOL
+#endif
+#endif
+
+#ifndef BMS_NOCHUNKPOOL
+
+#if !defined(CHUNKPOOL_THREADSAFE)
+typedef int CHUNKPOOLLOCK;                /**< dummy lock in single-threaded builds */
+#define lockChunkPool(lock)               (void) (lock)
+#define unlockChunkPool(lock)             (void) (lock)
+#define fetchAddChunkPoolCounter(ptr,val) ((*(ptr) += (val)) - (val))
+#define CHUNKPOOL_THREADLOCAL             /**/
+#elif defined(CHUNKPOOL_STDATOMIC)
+typedef atomic_int CHUNKPOOLLOCK;         /**< spin lock protecting a part of the chunk pool */
+#define lockChunkPool(lock)               while( atomic_exchange_explicit((lock), 1, memory_order_acquire) != 0 ) {}
+#define unlockChunkPool(lock)             atomic_store_explicit((lock), 0, memory_order_release)
+#define fetchAddChunkPoolCounter(ptr,val) atomic_fetch_add_explicit((ptr), (val), memory_order_relaxed)
+#define CHUNKPOOL_THREADLOCAL             _Thread_local
+#elif defined(__GNUC__)
+typedef int CHUNKPOOLLOCK;                /**< spin lock protecting a part of the chunk pool */
+#define lockChunkPool(lock)               while( __atomic_exchange_n((lock), 1, __ATOMIC_ACQUIRE) != 0 ) {}
+#define unlockChunkPool(lock)             __atomic_store_n((lock), 0, __ATOMIC_RELEASE)
+#define fetchAddChunkPoolCounter(ptr,val) __atomic_fetch_add((ptr), (val), __ATOMIC_RELAXED)
+#define CHUNKPOOL_THREADLOCAL             __thread
+#else
+#include <intrin.h>
+typedef long CHUNKPOOLLOCK;               /**< spin lock protecting a part of the chunk pool */
+#define lockChunkPool(lock)               while( _InterlockedExchange((volatile long*) (lock), 1L) != 0 ) {}
+#define unlockChunkPool(lock)             (void) _InterlockedExchange((volatile long*) (lock), 0L)
+#define fetchAddChunkPoolCounter(ptr,val) _InterlockedExchangeAdd((volatile long*) (ptr), (long) (val))
+#define CHUNKPOOL_THREADLOCAL             __declspec(thread)
+#endif
+
+typedef struct PooledChunk POOLEDCHUNK;   /**< unused chunk in the chunk pool */
+typedef struct ChunkMagazine CHUNKMAGAZINE; /**< magazine of unused chunks of a thread */
+
+/** unused chunk in the chunk pool; the data is stored in the memory of the chunk itself */
+struct PooledChunk
+{
+   POOLEDCHUNK*          next;               /**< next pooled chunk in the same list */
+   size_t                size;               /**< size of the chunk in bytes */
+};
+
+/** magazine of unused chunks of a thread */
+struct ChunkMagazine
+{
+   POOLEDCHUNK*          chunks;             /**< list of pooled chunks in the magazine */
+   long long             size;               /**< number of bytes in the magazine */
+   CHUNKPOOLLOCK         lock;               /**< lock of the magazine, only contended if threads share the magazine */
+};
+
+static POOLEDCHUNK* chunkpool[CHUNKPOOL_NBUCKETS]; /**< hash table of pooled chunks in the shared part by their size */
+static long long chunkpoolsize = 0;               /**< number of bytes in the shared part of the chunk pool */
+static CHUNKPOOLLOCK chunkpoollock;               /**< lock of the shared part of the chunk pool */
+static int nchunkblocks = 0;                      /**< number of existing chunk blocks, protected by chunkpoollock */
+static CHUNKMAGAZINE chunkmagazines[CHUNKPOOL_NMAGAZINES]; /**< magazines of pooled chunks for the threads */
+static CHUNKPOOLLOCK nextchunkmagazine;           /**< counter for the round-robin assignment of magazines */
+static CHUNKPOOL_THREADLOCAL int threadchunkmagazine = -1; /**< index of the magazine of the current thread */
+#endif
+
+static long long chunkpoolmaxsize = CHUNKPOOL_MAXSIZE; /**< maximal number of bytes kept in the chunk pool */
+
+#ifndef BMS_NOCHUNKPOOL
+/** returns the bucket of the shared part of the chunk pool for chunks of the given size */
+static
+int getChunkPoolBucket(
+   size_t                size                /**< size of the chunk in bytes */
+   )
+{
+   return (int) ((size / ALIGNMENT) % CHUNKPOOL_NBUCKETS);
+}
+
+/** returns the magazine of the current thread */
+static
+CHUNKMAGAZINE* getChunkMagazine(
+   void
+   )
+{
+   if( threadchunkmagazine < 0 )
+      threadchunkmagazine = (int) ((unsigned int) fetchAddChunkPoolCounter(&nextchunkmagazine, 1) % CHUNKPOOL_NMAGAZINES);
+
+   return &chunkmagazines[threadchunkmagazine];
+}
+
+/** removes a chunk of the given size from a list of pooled chunks and returns it, or returns NULL if the list does not
+ *  contain a chunk of this size
+ */
+static
+POOLEDCHUNK* takePooledChunk(
+   POOLEDCHUNK**         list,               /**< pointer to the first chunk of the list */
+   size_t                size                /**< size of the chunk in bytes */
+   )
+{
+   for( ; *list != NULL; list = &(*list)->next )
+   {
+      if( (*list)->size == size )
+      {
+         POOLEDCHUNK* pooledchunk;
+
+         pooledchunk = *list;
+         *list = pooledchunk->next;
+
+         return pooledchunk;
+      }
+   }
+
+   return NULL;
+}
+
+/** frees all chunks of a list of pooled chunks */
+static
+void freePooledChunkList(
+   POOLEDCHUNK*          list                /**< first chunk of the list */
+   )
+{
+   while( list != NULL )
+   {
+      POOLEDCHUNK* pooledchunk;
+
+      pooledchunk = list;
+      list = list->next;
+      BMSfreeMemory(&pooledchunk);
+   }
+}
+#endif
+
+/** takes memory of the given size for a chunk from the chunk pool, or allocates new memory if the pool has no chunk of
+ *  this size
+ */
+static
+void* allocPooledChunk(
+   size_t                size                /**< size of the chunk in bytes */
+   )
+{
+   void* ptr;
+
+#ifndef BMS_NOCHUNKPOOL
+   {
+      CHUNKMAGAZINE* magazine;
+      POOLEDCHUNK* pooledchunk;
+
+      assert(size >= sizeof(POOLEDCHUNK));
+
+      /* look into the magazine of the thread first */
+      magazine = getChunkMagazine();
+      lockChunkPool(&magazine->lock);
+      pooledchunk = takePooledChunk(&magazine->chunks, size);
+      if( pooledchunk != NULL )
+         magazine->size -= (long long) size;
+      unlockChunkPool(&magazine->lock);
+
+      if( pooledchunk != NULL )
+         return (void*) pooledchunk;
+
+      /* look into the shared part of the pool */
+      lockChunkPool(&chunkpoollock);
+      pooledchunk = takePooledChunk(&chunkpool[getChunkPoolBucket(size)], size);
+      if( pooledchunk != NULL )
+         chunkpoolsize -= (long long) size;
+      unlockChunkPool(&chunkpoollock);
+
+      if( pooledchunk != NULL )
+         return (void*) pooledchunk;
+   }
+#endif
+
+   BMSallocMemorySize(&ptr, size);
+
+   return ptr;
+}
+
+/** returns the memory of a chunk to the chunk pool, or frees it if the pool is full */
+static
+void freePooledChunk(
+   void**                ptr,                /**< pointer to the memory of the chunk */
+   size_t                size                /**< size of the chunk in bytes */
+   )
+{
+   assert(ptr != NULL);
+   assert(*ptr != NULL);
+
+#ifndef BMS_NOCHUNKPOOL
+   {
+      CHUNKMAGAZINE* magazine;
+      POOLEDCHUNK* pooledchunk;
+
+      assert(size >= sizeof(POOLEDCHUNK));
+
+      pooledchunk = (POOLEDCHUNK*) *ptr;
+      pooledchunk->size = size;
+
+      /* put the chunk into the magazine of the thread first */
+      magazine = getChunkMagazine();
+      lockChunkPool(&magazine->lock);
+      if( magazine->size + (long long) size <= chunkpoolmaxsize / (2 * CHUNKPOOL_NMAGAZINES) )
+      {
+         pooledchunk->next = magazine->chunks;
+         magazine->chunks = pooledchunk;
+         magazine->size += (long long) size;
+         pooledchunk = NULL;
+      }
+      unlockChunkPool(&magazine->lock);
+
+      /* if the magazine is full, put the chunk into the shared part of the pool */
+      if( pooledchunk != NULL )
+      {
+         int bucket;
+
+         bucket = getChunkPoolBucket(size);
+
+         lockChunkPool(&chunkpoollock);
+         if( chunkpoolsize + (long long) size <= chunkpoolmaxsize / 2 )
+         {
+            pooledchunk->next = chunkpool[bucket];
+            chunkpool[bucket] = pooledchunk;
+            chunkpoolsize += (long long) size;
+            pooledchunk = NULL;
+         }
+         unlockChunkPool(&chunkpoollock);
+      }
+
+      if( pooledchunk == NULL )
+      {
+         *ptr = NULL;
+         return;
+      }
+   }
+#endif
+
+   BMSfreeMemory(ptr);
+}
+
+/** frees pooled chunks until the magazines hold at most the given number of bytes each and the shared part of the
+ *  chunk pool holds at most the given number of bytes
+ */
+static
+void shrinkChunkPool(
+   long long             maxmagazinesize,    /**< maximal number of bytes to keep in each magazine */
+   long long             maxsharedsize       /**< maximal number of bytes to keep in the shared part of the pool */
+   )
+{
+#ifndef BMS_NOCHUNKPOOL
+   int i;
+
+   for( i = 0; i < CHUNKPOOL_NMAGAZINES; ++i )
+   {
+      CHUNKMAGAZINE* magazine;
+      POOLEDCHUNK* removed;
+
+      magazine = &chunkmagazines[i];
+      removed = NULL;
+
+      /* detach chunks under the lock, but free them afterwards */
+      lockChunkPool(&magazine->lock);
+      while( magazine->size > maxmagazinesize )
+      {
+         POOLEDCHUNK* pooledchunk;
+
+         assert(magazine->chunks != NULL);
+         pooledchunk = magazine->chunks;
+         magazine->chunks = pooledchunk->next;
+         magazine->size -= (long long) pooledchunk->size;
+         pooledchunk->next = removed;
+         removed = pooledchunk;
+      }
+      unlockChunkPool(&magazine->lock);
+
+      freePooledChunkList(removed);
+   }
+
+   for( i = 0; i < CHUNKPOOL_NBUCKETS; ++i )
+   {
+      POOLEDCHUNK* removed;
+
+      removed = NULL;
+
+      lockChunkPool(&chunkpoollock);
+      while( chunkpoolsize > maxsharedsize && chunkpool[i] != NULL )
+      {
+         POOLEDCHUNK* pooledchunk;
+
+         pooledchunk = chunkpool[i];
+         chunkpool[i] = pooledchunk->next;
+         chunkpoolsize -= (long long) pooledchunk->size;
+         pooledchunk->next = removed;
+         removed = pooledchunk;
+      }
+      unlockChunkPool(&chunkpoollock);
+
+      freePooledChunkList(removed);
+   }
+#else
+   (void) maxmagazinesize;
+   (void) maxsharedsize;
+#endif
+}
+
+/** registers a newly created chunk block with the chunk pool */
+static
+void addChunkPoolUser(
+   void
+   )
+{
+#ifndef BMS_NOCHUNKPOOL
+   lockChunkPool(&chunkpoollock);
+   ++nchunkblocks;
+   unlockChunkPool(&chunkpoollock);
+#endif
+}
+
+/** unregisters a destroyed chunk block from the chunk pool; frees all pooled chunks if it was the last chunk block */
+static
+void removeChunkPoolUser(
+   void
+   )
+{
+#ifndef BMS_NOCHUNKPOOL
+   int nremaining;
+
+   lockChunkPool(&chunkpoollock);
+   assert(nchunkblocks > 0);
+   nremaining = --nchunkblocks;
+   unlockChunkPool(&chunkpoollock);
+
+   if( nremaining == 0 )
+      shrinkChunkPool(0LL, 0LL);
+#endif
+}
+
+
 /** links chunk to the block's chunk array, sort it by store pointer;
  *  returns TRUE if successful, FALSE otherwise
  */
@@ -1063,7 +1732,7 @@ int createChunk(
    assert(BMSisAligned(sizeof(CHUNK)));
    assert( chkmem->elemsize < INT_MAX / storesize );
    assert( sizeof(CHUNK) < MAXMEMSIZE - (size_t)(storesize * chkmem->elemsize) ); /*lint !e571 !e647*/
-   BMSallocMemorySize(&newchunk, sizeof(CHUNK) + storesize * chkmem->elemsize);
+   newchunk = (CHUNK*) allocPooledChunk(sizeof(CHUNK) + (size_t)storesize * chkmem->elemsize);
    if( newchunk == NULL )
       return FALSE;
 
@@ -1121,7 +1790,8 @@ void destroyChunk(
       (*memsize) -= ((long long)sizeof(CHUNK) + (long long)(*chunk)->storesize * (*chunk)->elemsize);
 
    /* free chunk header and store (allocated in one call) */
-   BMSfreeMemory(chunk);
+   freePooledChunk((void**) chunk, sizeof(CHUNK) + (size_t)(*chunk)->storesize * (*chunk)->elemsize);
+   assert(*chunk == NULL);
 }
 
 /** removes a completely unused chunk, i.e. a chunk with all elements in the eager free list */
@@ -1263,6 +1933,8 @@ BMS_CHKMEM* createChkmem(
    if( memsize != NULL )
       (*memsize) += (long long)sizeof(BMS_CHKMEM);
 
+   addChunkPoolUser();
+
    return chkmem;
 }
 
@@ -1311,6 +1983,8 @@ void destroyChkmem(
       (*memsize) -= (long long)(sizeof(BMS_CHKMEM));
 
    BMSfreeMemory(chkmem);
+
+   removeChunkPoolUser();
 }
 
 /** allocates a new memory element from the chunk block */
@@ -1643,6 +2317,71 @@ long long BMSgetChunkMemoryUsed_call(
    return ((long long)(chkmem->elemsize) * (long long)(chkmem->storesize));
 }
 
+/** sets the maximal number of bytes of unused chunks that are kept for reuse in the chunk pool shared by all chunk
+ *  blocks and block memories; pooled chunks exceeding the new size are freed
+ *
+ *  @note must not be called while other threads allocate or free block memory
+ */
+void BMSsetChunkPoolMaxSize_call(
+   long long             maxsize             /**< maximal number of bytes in the chunk pool (0: no pooling) */
+   )
+{
+   assert(maxsize >= 0);
+
+   chunkpoolmaxsize = maxsize;
+
+   shrinkChunkPool(maxsize / (2 * CHUNKPOOL_NMAGAZINES), maxsize / 2);
+}
+
+/** returns the number of bytes of unused chunks that are currently kept in the chunk pool */
+long long BMSgetChunkPoolSize_call(
+   void
+   )
+{
+#ifndef BMS_NOCHUNKPOOL
+   long long size;
+   int i;
+
+   lockChunkPool(&chunkpoollock);
+   size = chunkpoolsize;
+   unlockChunkPool(&chunkpoollock);
+
+   for( i = 0; i < CHUNKPOOL_NMAGAZINES; ++i )
+   {
+      lockChunkPool(&chunkmagazines[i].lock);
+      size += chunkmagazines[i].size;
+      unlockChunkPool(&chunkmagazines[i].lock);
+   }
+
+   return size;
+#else
+   return 0LL;
+#endif
+}
+
+/** frees all unused chunks in the chunk pool; this happens automatically when the last chunk block is destroyed */
+void BMSclearChunkPool_call(
+   void
+   )
+{
+   shrinkChunkPool(0LL, 0LL);
+}
+
+/** returns whether destroyed chunks are kept in the chunk pool, which is not the case if block memory is compiled with
+ *  memory list checks or thread safety on a compiler without atomic operations
+ */
+int BMSisChunkPoolEnabled_call(
+   void
+   )
+{
+#ifndef BMS_NOCHUNKPOOL
+   return 1;
+#else
+   return 0;
+#endif
+}
+
+
 
 
 
@@ -1755,6 +2494,7 @@ BMS_BLKMEM* BMScreateBlockMemory_call(
       blkmem->maxmemused = 0;
       blkmem->maxmemunused = 0;
       blkmem->maxmemallocated = 0;
+      blkmem->account = NULL;
    }
    else
    {
@@ -1869,6 +2609,8 @@ void* BMSallocBlockMemory_work(
       printErrorHeader(filename, line);
       printError("Insufficient memory for new chunk.\n");
    }
+   else
+      accountAddMemory(blkmem->account, filename, (long long) size);
    debugMessage("alloced %8llu bytes in %p [%s:%d]\n", (unsigned long long)size, ptr, filename, line);
 
    /* add the used memory */
@@ -2119,6 +2861,7 @@ void BMSfreeBlockMemory_work(
    /* free memory in chunk block */
    freeChkmemElement(chkmem, *ptr, &blkmem->memallocated, filename, line);
    blkmem->memused -= (long long) size;
+   accountAddMemory(blkmem->account, filename, -(long long) size);
 
    blkmem->maxmemunused = MAX(blkmem->maxmemunused, blkmem->memallocated - blkmem->memused);
 
@@ -2480,6 +3223,19 @@ long long BMScheckEmptyBlockMemory_call(
    return allocedmem - freemem;
 }
 
+/** attaches a memory account to the block memory, which from then on records the allocations and frees per source file;
+ *  the account is not updated if the block memory is cleared
+ */
+void BMSsetBlockMemoryAccount_call(
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   BMS_MEMACCOUNT*       account             /**< memory account, or NULL to stop accounting */
+   )
+{
+   assert(blkmem != NULL);
+
+   blkmem->account = account;
+}
+
 
 
 
@@ -2503,6 +3259,7 @@ struct BMS_BufMem
    size_t                firstfree;          /**< first unused memory chunk */
    double                arraygrowfac;       /**< memory growing factor for dynamically allocated arrays */
    unsigned int          arraygrowinit;      /**< initial size of dynamically allocated arrays */
+   BMS_MEMACCOUNT*       account;            /**< memory account recording the sizes of used buffers per source file, or NULL */
 };
 
 
@@ -2532,6 +3289,7 @@ BMS_BUFMEM* BMScreateBufferMemory_call(
       buffer->firstfree = 0;
       buffer->arraygrowinit = (unsigned) arraygrowinit;
       buffer->arraygrowfac = arraygrowfac;
+      buffer->account = NULL;
    }
    else
    {
@@ -2599,6 +3357,19 @@ void BMSsetBufferMemoryArraygrowinit(
    buffer->arraygrowinit = (unsigned) arraygrowinit;
 }
 
+/** attaches a memory account to the buffer memory, which from then on records the sizes of the buffers in use per
+ *  source file; without buffer memory (SCIP_NOBUFFERMEM), nothing is recorded
+ */
+void BMSsetBufferMemoryAccount(
+   BMS_BUFMEM*           buffer,             /**< pointer to memory buffer storage */
+   BMS_MEMACCOUNT*       account             /**< memory account, or NULL to stop accounting */
+   )
+{
+   assert( buffer != NULL );
+
+   buffer->account = account;
+}
+
 #ifndef SCIP_NOBUFFERMEM
 /** calculate memory size for dynamically allocated arrays
  *
@@ -2758,6 +3529,7 @@ void* BMSallocBufferMemory_work(
    ptr = buffer->data[bufnum];
    buffer->used[bufnum] = TRUE;
    buffer->firstfree++;
+   accountAddMemory(buffer->account, filename, (long long) buffer->size[bufnum]);
 
    debugMessage("Allocated buffer %llu/%llu at %p of size %llu (required size: %llu) for pointer %p.\n",
       (unsigned long long)bufnum, (unsigned long long)(buffer->ndata), buffer->data[bufnum],
@@ -2888,6 +3660,7 @@ void* BMSreallocBufferMemory_work(
       BMSreallocMemorySize(&buffer->data[bufnum], newsize);
       assert( newsize > buffer->size[bufnum] );
       buffer->totalmem += newsize - buffer->size[bufnum];
+      accountAddMemory(buffer->account, filename, (long long) (newsize - buffer->size[bufnum]));
       buffer->size[bufnum] = newsize;
       if ( buffer->data[bufnum] == NULL )
       {
@@ -3063,6 +3836,7 @@ void BMSfreeBufferMemory_work(
 
    assert( buffer->data[bufnum] == *ptr );
    buffer->used[bufnum] = FALSE;
+   accountAddMemory(buffer->account, filename, -(long long) buffer->size[bufnum]);
 
    while ( buffer->firstfree > 0 && !buffer->used[buffer->firstfree-1] )
       --buffer->firstfree;
@@ -3163,3 +3937,269 @@ void BMSprintBufferMemory(
    }
    printf("    %8llu bytes total in %llu buffers\n", (unsigned long long)totalmem, (unsigned long long)(buffer->ndata));
 }
+
+
+/***********************************************************
+ * Arena Memory Management
+ *
+ * Bump pointer allocation of objects that are freed all at once
+ ***********************************************************/
+
+#define ARENA_ALIGNMENT (2 * sizeof(void*))  /**< alignment of the objects in arena memory */
+
+typedef struct ArenaBlock ARENABLOCK;        /**< memory block of an arena */
+
+/** memory block of an arena; the objects are stored behind the header */
+struct ArenaBlock
+{
+   ARENABLOCK*           next;               /**< next older memory block of the arena */
+   size_t                size;               /**< usable size of the block in bytes */
+};
+
+/** arena memory for objects with a common lifetime */
+struct BMS_ArenaMem
+{
+   ARENABLOCK*           blocks;             /**< memory blocks, the one used for allocations first */
+   char*                 curr;               /**< first free byte in the current block */
+   char*                 end;                /**< end of the current block */
+   size_t                blocksize;          /**< minimal usable size of new blocks (0: one block per object) */
+   size_t                totalmem;           /**< total memory consumption of the blocks in bytes */
+};
+
+/** size of the header of a memory block, rounded up to the alignment of the objects */
+#define ARENA_HEADERSIZE (((sizeof(ARENABLOCK) + ARENA_ALIGNMENT - 1) / ARENA_ALIGNMENT) * ARENA_ALIGNMENT)
+
+/** creates arena memory */
+BMS_ARENAMEM* BMScreateArenaMemory_call(
+   size_t                blocksize,          /**< size of the memory blocks that are requested from the system */
+   const char*           filename,           /**< source file of the function call */
+   int                   line                /**< line number in source file of the function call */
+   )
+{
+   BMS_ARENAMEM* arena;
+
+   BMSallocMemory(&arena);
+   if ( arena != NULL )
+   {
+      arena->blocks = NULL;
+      arena->curr = NULL;
+      arena->end = NULL;
+      arena->totalmem = 0UL;
+#ifdef BMS_NOBLOCKMEM
+      /* every object gets its own block, such that memory checkers can find accesses behind the object */
+      arena->blocksize = 0UL;
+#else
+      arena->blocksize = blocksize;
+#endif
+   }
+   else
+   {
+      printErrorHeader(filename, line);
+      printError("Insufficient memory for arena memory header.\n");
+   }
+
+   return arena;
+}
+
+/** destroys arena memory and frees all objects in it */
+void BMSdestroyArenaMemory_call(
+   BMS_ARENAMEM**        arena,              /**< pointer to arena memory */
+   const char*           filename,           /**< source file of the function call */
+   int                   line                /**< line number in source file of the function call */
+   )
+{
+   if ( *arena != NULL )
+   {
+      ARENABLOCK* block;
+
+      block = (*arena)->blocks;
+      while ( block != NULL )
+      {
+         ARENABLOCK* next;
+
+         next = block->next;
+         BMSfreeMemory(&block);
+         block = next;
+      }
+      BMSfreeMemory(arena);
+   }
+   else
+   {
+      printErrorHeader(filename, line);
+      printError("Tried to free null arena memory.\n");
+   }
+}
+
+/** frees all objects in the arena memory at once; the largest memory block is kept for later allocations
+ *
+ *  Since new blocks grow with the requested memory, the arena usually consists of a single block after the first
+ *  clearings, such that clearing it does not free anything.
+ */
+void BMSclearArenaMemory_call(
+   BMS_ARENAMEM*         arena               /**< arena memory */
+   )
+{
+   ARENABLOCK* largest;
+   ARENABLOCK* block;
+
+   assert( arena != NULL );
+
+   largest = NULL;
+   block = arena->blocks;
+   while ( block != NULL )
+   {
+      ARENABLOCK* next;
+
+      next = block->next;
+      if ( arena->blocksize > 0 && (largest == NULL || block->size > largest->size) )
+      {
+         if ( largest != NULL )
+            BMSfreeMemory(&largest);
+         largest = block;
+      }
+      else
+         BMSfreeMemory(&block);
+      block = next;
+   }
+
+   arena->blocks = largest;
+   if ( largest != NULL )
+   {
+      largest->next = NULL;
+      arena->curr = (char*)largest + ARENA_HEADERSIZE;
+      arena->end = arena->curr + largest->size;
+      arena->totalmem = ARENA_HEADERSIZE + largest->size;
+   }
+   else
+   {
+      arena->curr = NULL;
+      arena->end = NULL;
+      arena->totalmem = 0UL;
+   }
+}
+
+/** allocates an object in the arena memory */
+void* BMSallocArenaMemory_call(
+   BMS_ARENAMEM*         arena,              /**< arena memory */
+   size_t                size,               /**< size of the object */
+   const char*           filename,           /**< source file of the function call */
+   int                   line                /**< line number in source file of the function call */
+   )
+{
+   void* ptr;
+
+   assert( arena != NULL );
+   assert( arena->curr <= arena->end );
+
+   if ( size > MAXMEMSIZE - ARENA_HEADERSIZE - ARENA_ALIGNMENT )
+   {
+      printErrorHeader(filename, line);
+      printError("Tried to allocate arena memory of size exceeding %lu.\n", MAXMEMSIZE);
+      return NULL;
+   }
+
+   size = MAX(size, 1);
+   size = ((size + ARENA_ALIGNMENT - 1) / ARENA_ALIGNMENT) * ARENA_ALIGNMENT;
+
+   /* start a new block if the object does not fit into the current one; the blocks grow geometrically */
+   if ( (size_t)(arena->end - arena->curr) < size )
+   {
+      ARENABLOCK* block;
+      size_t blocksize;
+
+      blocksize = arena->blocksize;
+      if ( arena->blocks != NULL && blocksize > 0 && arena->blocks->size <= (MAXMEMSIZE - ARENA_HEADERSIZE) / 2 )
+         blocksize = MAX(blocksize, 2 * arena->blocks->size);
+      blocksize = MAX(blocksize, size);
+
+      BMSallocMemorySize(&block, ARENA_HEADERSIZE + blocksize);
+      if ( block == NULL )
+      {
+         printErrorHeader(filename, line);
+         printError("Insufficient memory for arena memory block of %llu bytes.\n", (unsigned long long)blocksize);
+         return NULL;
+      }
+
+      block->next = arena->blocks;
+      block->size = blocksize;
+      arena->blocks = block;
+      arena->curr = (char*)block + ARENA_HEADERSIZE;
+      arena->end = arena->curr + blocksize;
+      arena->totalmem += ARENA_HEADERSIZE + blocksize;
+   }
+
+   ptr = (void*)arena->curr;
+   arena->curr += size;
+
+   return ptr;
+}
+
+/** allocates an array in the arena memory */
+void* BMSallocArenaMemoryArray_call(
+   BMS_ARENAMEM*         arena,              /**< arena memory */
+   size_t                num,                /**< size of array to be allocated */
+   size_t                typesize,           /**< size of components */
+   const char*           filename,           /**< source file of the function call */
+   int                   line                /**< line number in source file of the function call */
+   )
+{
+   assert( typesize > 0 );
+
+   if ( num > (MAXMEMSIZE / typesize) )
+   {
+      printErrorHeader(filename, line);
+      printError("Tried to allocate arena memory of size exceeding %lu.\n", MAXMEMSIZE);
+      return NULL;
+   }
+
+   return BMSallocArenaMemory_call(arena, num * typesize, filename, line);
+}
+
+/** allocates an array in the arena memory and clears it */
+void* BMSallocClearArenaMemoryArray_call(
+   BMS_ARENAMEM*         arena,              /**< arena memory */
+   size_t                num,                /**< size of array to be allocated */
+   size_t                typesize,           /**< size of components */
+   const char*           filename,           /**< source file of the function call */
+   int                   line                /**< line number in source file of the function call */
+   )
+{
+   void* ptr;
+
+   ptr = BMSallocArenaMemoryArray_call(arena, num, typesize, filename, line);
+   if ( ptr != NULL )
+      BMSclearMemorySize(ptr, num * typesize);
+
+   return ptr;
+}
+
+/** allocates an array in the arena memory and copies the given memory into it */
+void* BMSduplicateArenaMemoryArray_call(
+   BMS_ARENAMEM*         arena,              /**< arena memory */
+   const void*           source,             /**< memory block to copy into the arena */
+   size_t                num,                /**< size of array to be allocated */
+   size_t                typesize,           /**< size of components */
+   const char*           filename,           /**< source file of the function call */
+   int                   line                /**< line number in source file of the function call */
+   )
+{
+   void* ptr;
+
+   assert( source != NULL );
+
+   ptr = BMSallocArenaMemoryArray_call(arena, num, typesize, filename, line);
+   if ( ptr != NULL )
+      BMScopyMemorySize(ptr, source, num * typesize);
+
+   return ptr;
+}
+
+/** returns the number of bytes of the memory blocks held by the arena memory */
+long long BMSgetArenaMemoryUsed(
+   const BMS_ARENAMEM*   arena               /**< arena memory */
+   )
+{
+   assert( arena != NULL );
+
+   return (long long) arena->totalmem;
+}
@@ -315,6 +315,10 @@ typedef struct BMS_ChkMem BMS_CHKMEM;           /**< collection of memory chunks
 #define BMSfreeChunkMemoryNull(mem,ptr)       BMSfreeChunkMemoryNull_call( (mem), (void**)(ptr), sizeof(**(ptr)), __FILE__, __LINE__ )
 #define BMSgarbagecollectChunkMemory(mem)     BMSgarbagecollectChunkMemory_call(mem)
 #define BMSgetChunkMemoryUsed(mem)            BMSgetChunkMemoryUsed_call(mem)
+#define BMSsetChunkPoolMaxSize(size)          BMSsetChunkPoolMaxSize_call(size)
+#define BMSgetChunkPoolSize()                 BMSgetChunkPoolSize_call()
+#define BMSclearChunkPool()                   BMSclearChunkPool_call()
+#define BMSisChunkPoolEnabled()               BMSisChunkPoolEnabled_call()
 
 #else
 
@@ -331,6 +335,10 @@ typedef struct BMS_ChkMem BMS_CHKMEM;           /**< collection of memory chunks
 #define BMSfreeChunkMemoryNull(mem,ptr)            BMSfreeMemoryNull(ptr)
 #define BMSgarbagecollectChunkMemory(mem)          /**/
 #define BMSgetChunkMemoryUsed(mem)                 0LL
+#define BMSsetChunkPoolMaxSize(size)               /**/
+#define BMSgetChunkPoolSize()                      0LL
+#define BMSclearChunkPool()                        /**/
+#define BMSisChunkPoolEnabled()                    0
 
 #endif
 
@@ -425,6 +433,102 @@ long long BMSgetChunkMemoryUsed_call(
    const BMS_CHKMEM*     chkmem              /**< chunk block */
    );
 
+/** sets the maximal number of bytes of unused chunks that are kept for reuse in the chunk pool shared by all chunk
+ *  blocks and block memories; pooled chunks exceeding the new size are freed
+ *
+ *  @note must not be called while other threads allocate or free block memory
+ */
+SCIP_EXPORT
+void BMSsetChunkPoolMaxSize_call(
+   long long             maxsize             /**< maximal number of bytes in the chunk pool (0: no pooling) */
+   );
+
+/** returns the number of bytes of unused chunks that are currently kept in the chunk pool */
+SCIP_EXPORT
+long long BMSgetChunkPoolSize_call(
+   void
+   );
+
+/** frees all unused chunks in the chunk pool; this happens automatically when the last chunk block is destroyed */
+SCIP_EXPORT
+void BMSclearChunkPool_call(
+   void
+   );
+
+/** returns whether destroyed chunks are kept in the chunk pool, which is not the case if block memory is compiled with
+ *  memory list checks or thread safety on a compiler without atomic operations
+ */
+SCIP_EXPORT
+int BMSisChunkPoolEnabled_call(
+   void
+   );
+
+
+
+
+/***********************************************************
+ * Memory Accounting
+ *
+ * Attribution of used block and buffer memory to the source files that allocate it
+ ***********************************************************/
+
+typedef struct BMS_MemAccount BMS_MEMACCOUNT;  /**< memory usage per source file of block and buffer memories */
+
+#define BMScreateMemoryAccount()              BMScreateMemoryAccount_call(__FILE__, __LINE__)
+#define BMSdestroyMemoryAccount(account)      BMSdestroyMemoryAccount_call((account), __FILE__, __LINE__)
+
+/** creates an empty memory account */
+SCIP_EXPORT
+BMS_MEMACCOUNT* BMScreateMemoryAccount_call(
+   const char*           filename,           /**< source file of the function call */
+   int                   line                /**< line number in source file of the function call */
+   );
+
+/** frees a memory account; the account must not be attached to a block or buffer memory anymore */
+SCIP_EXPORT
+void BMSdestroyMemoryAccount_call(
+   BMS_MEMACCOUNT**      account,            /**< pointer to memory account */
+   const char*           filename,           /**< source file of the function call */
+   int                   line                /**< line number in source file of the function call */
+   );
+
+/** resets the used and maximal used bytes of all source files to zero */
+SCIP_EXPORT
+void BMSclearMemoryAccount(
+   BMS_MEMACCOUNT*       account             /**< memory account */
+   );
+
+/** returns the number of source files that allocated memory since the account was created */
+SCIP_EXPORT
+int BMSgetMemoryAccountNFiles(
+   const BMS_MEMACCOUNT* account             /**< memory account */
+   );
+
+/** returns the name of the i-th source file of the account */
+SCIP_EXPORT
+const char* BMSgetMemoryAccountFile(
+   const BMS_MEMACCOUNT* account,            /**< memory account */
+   int                   i                   /**< index of the source file, 0 <= i < BMSgetMemoryAccountNFiles() */
+   );
+
+/** returns the number of bytes currently used by the i-th source file of the account
+ *
+ *  @note Memory is attributed to the file that allocates it and subtracted from the file that frees it, such that the
+ *        value may become negative for files that free memory allocated elsewhere.
+ */
+SCIP_EXPORT
+long long BMSgetMemoryAccountUsed(
+   const BMS_MEMACCOUNT* account,            /**< memory account */
+   int                   i                   /**< index of the source file, 0 <= i < BMSgetMemoryAccountNFiles() */
+   );
+
+/** returns the maximal number of bytes used by the i-th source file of the account at any time */
+SCIP_EXPORT
+long long BMSgetMemoryAccountUsedMax(
+   const BMS_MEMACCOUNT* account,            /**< memory account */
+   int                   i                   /**< index of the source file, 0 <= i < BMSgetMemoryAccountNFiles() */
+   );
+
 
 
 
@@ -479,6 +583,7 @@ typedef struct BMS_BlkMem BMS_BLKMEM;           /**< block memory: collection of
 #define BMSgetBlockPointerSize(mem,ptr)       BMSgetBlockPointerSize_call((mem), (ptr))
 #define BMSdisplayBlockMemory(mem)            BMSdisplayBlockMemory_call(mem)
 #define BMSblockMemoryCheckEmpty(mem)         BMScheckEmptyBlockMemory_call(mem)
+#define BMSsetBlockMemoryAccount(mem,account) BMSsetBlockMemoryAccount_call((mem), (account))
 
 #else
 
@@ -514,6 +619,7 @@ typedef struct BMS_BlkMem BMS_BLKMEM;           /**< block memory: collection of
 #define BMSgetBlockPointerSize(mem,ptr)                      (SCIP_UNUSED(mem), SCIP_UNUSED(ptr), 0)
 #define BMSdisplayBlockMemory(mem)                           SCIP_UNUSED(mem)
 #define BMSblockMemoryCheckEmpty(mem)                        (SCIP_UNUSED(mem), 0LL)
+#define BMSsetBlockMemoryAccount(mem,account)                (SCIP_UNUSED(mem), SCIP_UNUSED(account))
 
 #endif
 
@@ -708,6 +814,15 @@ long long BMScheckEmptyBlockMemory_call(
    const BMS_BLKMEM*     blkmem              /**< block memory */
    );
 
+/** attaches a memory account to the block memory, which from then on records the allocations and frees per source file;
+ *  the account is not updated if the block memory is cleared
+ */
+SCIP_EXPORT
+void BMSsetBlockMemoryAccount_call(
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   BMS_MEMACCOUNT*       account             /**< memory account, or NULL to stop accounting */
+   );
+
 
 
 
@@ -780,6 +895,15 @@ void BMSsetBufferMemoryArraygrowinit(
    int                   arraygrowinit       /**< initial size of dynamically allocated arrays */
    );
 
+/** attaches a memory account to the buffer memory, which from then on records the sizes of the buffers in use per
+ *  source file; without buffer memory (SCIP_NOBUFFERMEM), nothing is recorded
+ */
+SCIP_EXPORT
+void BMSsetBufferMemoryAccount(
+   BMS_BUFMEM*           buffer,             /**< pointer to memory buffer storage */
+   BMS_MEMACCOUNT*       account             /**< memory account, or NULL to stop accounting */
+   );
+
 /** allocates the next unused buffer */
 SCIP_EXPORT
 void* BMSallocBufferMemory_call(
@@ -888,6 +1012,97 @@ void BMSprintBufferMemory(
    );
 
 
+/***********************************************************
+ * Arena Memory Management
+ *
+ * Bump pointer allocation of objects that are freed all at once
+ ***********************************************************/
+
+typedef struct BMS_ArenaMem BMS_ARENAMEM;    /**< arena memory for objects with a common lifetime */
+
+/* Note: objects in arena memory cannot be freed individually; the whole arena is cleared with BMSclearArenaMemory() */
+
+#define BMSallocArenaMemory(mem,ptr)         ASSIGN((ptr), BMSallocArenaMemory_call((mem), sizeof(**(ptr)), __FILE__, __LINE__))
+#define BMSallocArenaMemorySize(mem,ptr,size) ASSIGN((ptr), BMSallocArenaMemory_call((mem), (size_t)(ptrdiff_t)(size), __FILE__, __LINE__))
+#define BMSallocArenaMemoryArray(mem,ptr,num) ASSIGN((ptr), BMSallocArenaMemoryArray_call((mem), (size_t)(ptrdiff_t)(num), sizeof(**(ptr)), __FILE__, __LINE__))
+#define BMSallocClearArenaMemoryArray(mem,ptr,num) ASSIGN((ptr), BMSallocClearArenaMemoryArray_call((mem), (size_t)(ptrdiff_t)(num), sizeof(**(ptr)), __FILE__, __LINE__))
+#define BMSduplicateArenaMemoryArray(mem,ptr,source,num) ASSIGNCHECK((ptr), BMSduplicateArenaMemoryArray_call((mem), \
+                                                 (const void*)(source), (size_t)(ptrdiff_t)(num), sizeof(**(ptr)), __FILE__, __LINE__), source)
+
+#define BMScreateArenaMemory(blocksize)      BMScreateArenaMemory_call((size_t)(ptrdiff_t)(blocksize), __FILE__, __LINE__)
+#define BMSclearArenaMemory(mem)             BMSclearArenaMemory_call((mem))
+#define BMSdestroyArenaMemory(mem)           BMSdestroyArenaMemory_call((mem), __FILE__, __LINE__)
+
+
+/** creates arena memory */
+SCIP_EXPORT
+BMS_ARENAMEM* BMScreateArenaMemory_call(
+   size_t                blocksize,          /**< size of the memory blocks that are requested from the system */
+   const char*           filename,           /**< source file of the function call */
+   int                   line                /**< line number in source file of the function call */
+   );
+
+/** destroys arena memory and frees all objects in it */
+SCIP_EXPORT
+void BMSdestroyArenaMemory_call(
+   BMS_ARENAMEM**        arena,              /**< pointer to arena memory */
+   const char*           filename,           /**< source file of the function call */
+   int                   line                /**< line number in source file of the function call */
+   );
+
+/** frees all objects in the arena memory at once; the largest memory block is kept for later allocations */
+SCIP_EXPORT
+void BMSclearArenaMemory_call(
+   BMS_ARENAMEM*         arena               /**< arena memory */
+   );
+
+/** allocates an object in the arena memory */
+SCIP_EXPORT
+void* BMSallocArenaMemory_call(
+   BMS_ARENAMEM*         arena,              /**< arena memory */
+   size_t                size,               /**< size of the object */
+   const char*           filename,           /**< source file of the function call */
+   int                   line                /**< line number in source file of the function call */
+   );
+
+/** allocates an array in the arena memory */
+SCIP_EXPORT
+void* BMSallocArenaMemoryArray_call(
+   BMS_ARENAMEM*         arena,              /**< arena memory */
+   size_t                num,                /**< size of array to be allocated */
+   size_t                typesize,           /**< size of components */
+   const char*           filename,           /**< source file of the function call */
+   int                   line                /**< line number in source file of the function call */
+   );
+
+/** allocates an array in the arena memory and clears it */
+SCIP_EXPORT
+void* BMSallocClearArenaMemoryArray_call(
+   BMS_ARENAMEM*         arena,              /**< arena memory */
+   size_t                num,                /**< size of array to be allocated */
+   size_t                typesize,           /**< size of components */
+   const char*           filename,           /**< source file of the function call */
+   int                   line                /**< line number in source file of the function call */
+   );
+
+/** allocates an array in the arena memory and copies the given memory into it */
+SCIP_EXPORT
+void* BMSduplicateArenaMemoryArray_call(
+   BMS_ARENAMEM*         arena,              /**< arena memory */
+   const void*           source,             /**< memory block to copy into the arena */
+   size_t                num,                /**< size of array to be allocated */
+   size_t                typesize,           /**< size of components */
+   const char*           filename,           /**< source file of the function call */
+   int                   line                /**< line number in source file of the function call */
+   );
+
+/** returns the number of bytes of the memory blocks held by the arena memory */
+SCIP_EXPORT
+long long BMSgetArenaMemoryUsed(
+   const BMS_ARENAMEM*   arena               /**< arena memory */
+   );
+
+
 #ifdef __cplusplus
 }
 #endif
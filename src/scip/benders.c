@@ -53,6 +53,7 @@
 #include "scip/struct_benderscut.h"
 
 #include "scip/benderscut.h"
+#include "tpi/tpi.h"
 
 /* Defaults for parameters */
 #define SCIP_DEFAULT_TRANSFERCUTS         FALSE  /** should Benders' cuts generated in LNS heuristics be transferred to the main SCIP instance? */
@@ -71,6 +72,7 @@
 #define SCIP_DEFAULT_STRENGTHENENABLED    FALSE  /** enable the core point cut strengthening approach */
 #define SCIP_DEFAULT_STRENGTHENINTPOINT     'r'  /** where should the strengthening interior point be sourced from ('l'p relaxation, 'f'irst solution, 'i'ncumbent solution, 'r'elative interior point, vector of 'o'nes, vector of 'z'eros) */
 #define SCIP_DEFAULT_NUMTHREADS               1  /** the number of parallel threads to use when solving the subproblems */
+#define SCIP_DEFAULT_STOPONCUT            FALSE  /** should the remaining subproblems of a solve loop be skipped once a cut is found? */
 #define SCIP_DEFAULT_EXECFEASPHASE        FALSE  /** should a feasibility phase be executed during the root node processing */
 #define SCIP_DEFAULT_SLACKVARCOEF          1e+6  /** the initial objective coefficient of the slack variables in the subproblem */
 #define SCIP_DEFAULT_MAXSLACKVARCOEF       1e+9  /** the maximal objective coefficient of the slack variables in the subproblem */
@@ -1173,6 +1175,11 @@ SCIP_RETCODE doBendersCreate(
          "the number of threads to use when solving the subproblems", &(*benders)->numthreads, TRUE,
          SCIP_DEFAULT_NUMTHREADS, 1, INT_MAX, NULL, NULL) );
 
+   (void) SCIPsnprintf(paramname, SCIP_MAXSTRLEN, "benders/%s/stoponcut", name);
+   SCIP_CALL( SCIPsetAddBoolParam(set, messagehdlr, blkmem, paramname,
+         "should the remaining subproblems of a solve loop be skipped once a solved subproblem shows that the solution is infeasible or not optimal?",
+         &(*benders)->stoponcut, TRUE, SCIP_DEFAULT_STOPONCUT, NULL, NULL) ); /*lint !e740*/
+
    (void) SCIPsnprintf(paramname, SCIP_MAXSTRLEN, "benders/%s/execfeasphase", name);
    SCIP_CALL( SCIPsetAddBoolParam(set, messagehdlr, blkmem, paramname,
          "should a feasibility phase be executed during the root node, i.e. adding slack variables to constraints to ensure feasibility",
@@ -2591,6 +2598,8 @@ SCIP_RETCODE SCIPbendersActivate(
          solvestat->idx = i;
          solvestat->ncalls = 0;
          solvestat->avgiter = 0;
+         solvestat->avgtime = 0.0;
+         SCIP_CALL( SCIPclockCreate(&solvestat->solveclock, SCIP_CLOCKTYPE_WALL) );
          benders->solvestat[i] = solvestat;
 
          /* inserting the initial elements into the priority queue */
@@ -2652,7 +2661,10 @@ SCIP_RETCODE SCIPbendersDeactivate(
       SCIPpqueueFree(&benders->subprobqueue);
 
       for( i = nsubproblems - 1; i >= 0; i-- )
+      {
+         SCIPclockFree(&benders->solvestat[i]->solveclock);
          BMSfreeMemory(&benders->solvestat[i]);
+      }
 
       /* freeing the memory allocated during the activation of the Benders' decomposition */
       BMSfreeMemoryArray(&benders->mastervarscont);
@@ -3092,8 +3104,11 @@ SCIP_RETCODE updateSubproblemStatQueue(
          else
             solvestat->avgiter = (SCIP_Real)(solvestat->avgiter*solvestat->ncalls + SCIPgetNLPIterations(subproblem))
                /(SCIP_Real)(solvestat->ncalls + 1);
+         solvestat->avgtime = (solvestat->avgtime*solvestat->ncalls + SCIPclockGetTime(solvestat->solveclock))
+            /(SCIP_Real)(solvestat->ncalls + 1);
          solvestat->ncalls++;
       }
+      SCIPclockReset(solvestat->solveclock);
 
       /* inserting the solving statistics into the priority queue */
       SCIP_CALL( SCIPpqueueInsert(benders->subprobqueue, solvestat) );
@@ -3104,12 +3119,435 @@ SCIP_RETCODE updateSubproblemStatQueue(
    return SCIP_OKAY;
 }
 
+/** solves a single Benders' decomposition subproblem in the current solve loop
+ *
+ *  The results are only stored for the given subproblem, such that several subproblems can be solved concurrently.
+ *  The caller combines them into the results of the solve loop.
+ */
+static
+SCIP_RETCODE solveBendersSubproblem(
+   SCIP_BENDERS*         benders,            /**< Benders' decomposition */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_SOL*             sol,                /**< primal CIP solution */
+   SCIP_BENDERSENFOTYPE  type,               /**< the type of solution being enforced */
+   SCIP_BENDERSSOLVELOOP solveloop,          /**< the current solve loop */
+   SCIP_Bool             checkint,           /**< are the subproblems called during a check/enforce of integer sols? */
+   SCIP_Bool             onlyconvexcheck,    /**< are only the convex relaxations of the subproblems checked? */
+   int                   probnumber,         /**< the subproblem index */
+   SCIP_Bool*            subprobsolved,      /**< pointer to store whether the subproblem was solved in this loop */
+   SCIP_BENDERSSUBSTATUS* substatus,         /**< pointer to store the status of the subproblem */
+   SCIP_Bool*            infeasible,         /**< pointer to store whether the subproblem is infeasible */
+   SCIP_Bool*            optimal,            /**< pointer to store whether the solution is optimal for the subproblem */
+   SCIP_Bool*            verified,           /**< pointer to store whether the subproblem was verified in this loop */
+   SCIP_Bool*            violated            /**< pointer to store whether the solved subproblem shows that the solution
+                                              *   is infeasible or not optimal */
+   )
+{
+   SCIP_Bool convexsub;
+   SCIP_Bool solvesub = TRUE;
+   int i = probnumber;
+
+   assert(benders != NULL);
+   assert(set != NULL);
+
+   *infeasible = FALSE;
+   *optimal = TRUE;
+   *verified = FALSE;
+   *violated = FALSE;
+
+   convexsub = SCIPbendersGetSubproblemType(benders, i) == SCIP_BENDERSSUBTYPE_CONVEXCONT;
+
+   /* the subproblem is initially flagged as not solved for this solving loop */
+   *subprobsolved = FALSE;
+
+   /* setting the subsystem status to UNKNOWN at the start of each solve loop */
+   *substatus = SCIP_BENDERSSUBSTATUS_UNKNOWN;
+
+   /* for the second solving loop, if the problem is an LP, it is not solved again. If the problem is a MIP,
+    * then the subproblem objective function value is set to infinity. However, if the subproblem is proven
+    * infeasible from the LP, then the IP loop is not performed.
+    * If the solve loop is SCIP_BENDERSSOLVELOOP_USERCIP, then nothing is done. It is assumed that the user will
+    * correctly update the objective function within the user-defined solving function.
+    */
+   if( solveloop == SCIP_BENDERSSOLVELOOP_CIP )
+   {
+      if( convexsub || *substatus == SCIP_BENDERSSUBSTATUS_INFEAS )
+         solvesub = FALSE;
+      else
+      {
+         SCIPbendersSetSubproblemObjval(benders, i, SCIPbendersSubproblem(benders, i) != NULL ?
+            SCIPinfinity(SCIPbendersSubproblem(benders, i)) : SCIPsetInfinity(set));
+      }
+   }
+
+   /* if the subproblem is independent, then it does not need to be solved. In this case, the nverified flag will
+    * increase by one. When the subproblem is not independent, then it needs to be checked.
+    */
+   if( !subproblemIsActive(benders, i) )
+   {
+      /* NOTE: There is no need to update the optimal flag. This is because optimal is always TRUE until a
+       * non-optimal subproblem is found.
+       */
+      /* if the auxiliary variable value is infinity, then the subproblem has not been solved yet. Currently the
+       * subproblem statue is unknown. */
+      if( SCIPsetIsInfinity(set, SCIPbendersGetAuxiliaryVarVal(benders, set, sol, i))
+         || SCIPsetIsInfinity(set, -SCIPbendersGetAuxiliaryVarVal(benders, set, sol, i))
+         || SCIPsetIsInfinity(set, -SCIPbendersGetSubproblemLowerbound(benders, i)) )
+      {
+         SCIPbendersSetSubproblemObjval(benders, i, SCIPbendersSubproblem(benders, i) != NULL ?
+            SCIPinfinity(SCIPbendersSubproblem(benders, i)) : SCIPsetInfinity(set));
+
+         *substatus = SCIP_BENDERSSUBSTATUS_UNKNOWN;
+         *optimal = FALSE;
+
+         SCIPsetDebugMsg(set, "Benders' decomposition: subproblem %d is not active, but has not been solved."
+           " setting status to UNKNOWN\n", i);
+      }
+      else
+      {
+         if( SCIPrelDiff(SCIPbendersGetSubproblemLowerbound(benders, i),
+               SCIPbendersGetAuxiliaryVarVal(benders, set, sol, i)) < benders->solutiontol )
+         {
+            SCIPbendersSetSubproblemObjval(benders, i, SCIPbendersGetAuxiliaryVarVal(benders, set, sol, i));
+            *substatus = SCIP_BENDERSSUBSTATUS_OPTIMAL;
+         }
+         else
+         {
+            SCIPbendersSetSubproblemObjval(benders, i, SCIPbendersGetSubproblemLowerbound(benders, i));
+            *substatus = SCIP_BENDERSSUBSTATUS_AUXVIOL;
+         }
+
+         SCIPsetDebugMsg(set, "Benders' decomposition: subproblem %d is not active, setting status to OPTIMAL\n", i);
+      }
+
+      *subprobsolved = TRUE;
+
+      /* the nverified counter is only increased in the convex solving loop */
+      if( solveloop == SCIP_BENDERSSOLVELOOP_CONVEX || solveloop == SCIP_BENDERSSOLVELOOP_USERCONVEX )
+         *verified = TRUE;
+   }
+   else if( solvesub )
+   {
+      SCIP_RETCODE retcode;
+      SCIP_Bool subinfeas = FALSE;
+      SCIP_Bool solved;
+
+      /* the solving time is used to start the longest subproblems first when solving in parallel */
+      SCIPclockStart(benders->solvestat[i]->solveclock, set);
+      retcode = SCIPbendersExecSubproblemSolve(benders, set, sol, i, solveloop, FALSE, &solved, &subinfeas, type);
+      SCIPclockStop(benders->solvestat[i]->solveclock, set);
+
+      /* the solution for the subproblem is only processed if the return code is SCIP_OKAY */
+      SCIP_CALL( retcode );
+
+#ifdef SCIP_DEBUG
+      if( type == SCIP_BENDERSENFOTYPE_LP )
+      {
+      SCIPsetDebugMsg(set, "Enfo LP: Subproblem %d Type %d (%f < %f)\n", i,
+         SCIPbendersGetSubproblemType(benders, i), SCIPbendersGetAuxiliaryVarVal(benders, set, sol, i),
+            SCIPbendersGetSubproblemObjval(benders, i));
+      }
+#endif
+      *subprobsolved = solved;
+
+      *infeasible = subinfeas;
+      if( subinfeas )
+         *substatus = SCIP_BENDERSSUBSTATUS_INFEAS;
+
+      /* if the subproblems are solved to check integer feasibility, then the optimality check must be performed.
+       * This will only be performed if checkint is TRUE and the subproblem was solved. The subproblem may not be
+       * solved if the user has defined a solving function
+       */
+      if( checkint && *subprobsolved )
+      {
+         /* if the subproblem is feasible, then it is necessary to update the value of the auxiliary variable to the
+          * objective function value of the subproblem.
+          */
+         if( !subinfeas )
+         {
+            SCIP_Bool subproboptimal;
+
+            subproboptimal = SCIPbendersSubproblemIsOptimal(benders, set, sol, i);
+
+            if( subproboptimal )
+               *substatus = SCIP_BENDERSSUBSTATUS_OPTIMAL;
+            else
+               *substatus = SCIP_BENDERSSUBSTATUS_AUXVIOL;
+
+            /* It is only possible to determine the optimality of a solution within a given subproblem in four
+             * different cases:
+             * i) solveloop == SCIP_BENDERSSOLVELOOP_CONVEX or USERCONVEX and the subproblem is convex.
+             * ii) solveloop == SCIP_BENDERSOLVELOOP_CONVEX  and only the convex relaxations will be checked.
+             * iii) solveloop == SCIP_BENDERSSOLVELOOP_USERCIP and the subproblem was solved, since the user has
+             * defined a solve function, it is expected that the solving is correctly executed.
+             * iv) solveloop == SCIP_BENDERSSOLVELOOP_CIP and the MIP for the subproblem has been solved.
+             */
+            if( convexsub || onlyconvexcheck
+               || solveloop == SCIP_BENDERSSOLVELOOP_CIP
+               || solveloop == SCIP_BENDERSSOLVELOOP_USERCIP )
+               *optimal = subproboptimal;
+
+#ifdef SCIP_DEBUG
+            if( convexsub || solveloop >= SCIP_BENDERSSOLVELOOP_CIP )
+            {
+               if( subproboptimal )
+               {
+                  SCIPsetDebugMsg(set, "Subproblem %d is Optimal (%f >= %f)\n", i,
+                     SCIPbendersGetAuxiliaryVarVal(benders, set, sol, i), SCIPbendersGetSubproblemObjval(benders, i));
+               }
+               else
+               {
+                  SCIPsetDebugMsg(set, "Subproblem %d is NOT Optimal (%f < %f)\n", i,
+                     SCIPbendersGetAuxiliaryVarVal(benders, set, sol, i), SCIPbendersGetSubproblemObjval(benders, i));
+               }
+            }
+#endif
+
+            /* the nverified variable is only incremented when the original form of the subproblem has been solved.
+             * What is meant by "original" is that the LP relaxation of CIPs are solved to generate valid cuts. So
+             * if the subproblem is defined as a CIP, then it is only classified as checked if the CIP is solved.
+             * There are three cases where the "original" form is solved are:
+             * i) solveloop == SCIP_BENDERSSOLVELOOP_CONVEX or USERCONVEX and the subproblem is an LP
+             *    - the original form has been solved.
+             * ii) solveloop == SCIP_BENDERSSOLVELOOP_CIP or USERCIP and the CIP for the subproblem has been
+             *    solved.
+             * iii) or, only a convex check is performed.
+             */
+            if( ((solveloop == SCIP_BENDERSSOLVELOOP_CONVEX || solveloop == SCIP_BENDERSSOLVELOOP_USERCONVEX)
+                  && convexsub)
+               || ((solveloop == SCIP_BENDERSSOLVELOOP_CIP || solveloop == SCIP_BENDERSSOLVELOOP_USERCIP)
+                  && !convexsub)
+               || onlyconvexcheck )
+               *verified = TRUE;
+         }
+      }
+
+      /* a cut can be generated from this subproblem */
+      *violated = *subprobsolved && (subinfeas || *substatus == SCIP_BENDERSSUBSTATUS_AUXVIOL);
+   }
+
+   return SCIP_OKAY;
+}
+
+/** data of a Benders' decomposition subproblem that is solved by a TPI job */
+struct SubproblemJob
+{
+   SCIP_BENDERS*         benders;            /**< Benders' decomposition */
+   SCIP_SET*             set;                /**< global SCIP settings */
+   SCIP_SOL*             sol;                /**< primal CIP solution */
+   SCIP_BENDERSENFOTYPE  type;               /**< the type of solution being enforced */
+   SCIP_BENDERSSOLVELOOP solveloop;          /**< the current solve loop */
+   SCIP_Bool             checkint;           /**< are the subproblems called during a check/enforce of integer sols? */
+   SCIP_Bool             onlyconvexcheck;    /**< are only the convex relaxations of the subproblems checked? */
+   int                   probnumber;         /**< the subproblem index */
+   int*                  skip;               /**< shared flag whether the remaining subproblems should be skipped */
+   SCIP_Bool*            subprobsolved;      /**< pointer to store whether the subproblem was solved in this loop */
+   SCIP_BENDERSSUBSTATUS* substatus;         /**< pointer to store the status of the subproblem */
+   SCIP_Bool             skipped;            /**< was the subproblem skipped? */
+   SCIP_Bool             infeasible;         /**< is the subproblem infeasible? */
+   SCIP_Bool             optimal;            /**< is the solution optimal for the subproblem? */
+   SCIP_Bool             verified;           /**< was the subproblem verified in this loop? */
+   SCIP_Bool             violated;           /**< does the subproblem show that the solution is infeasible or not optimal? */
+   SCIP_Bool             stopped;            /**< was the solving process stopped? */
+};
+typedef struct SubproblemJob SUBPROBLEMJOB;
+
+/** solves a Benders' decomposition subproblem on a worker thread */
+static
+SCIP_RETCODE subproblemJobExec(
+   void*                 args                /**< the subproblem job */
+   )
+{
+   SUBPROBLEMJOB* job;
+
+   job = (SUBPROBLEMJOB*) args;
+   assert(job != NULL);
+
+   /* a previous subproblem already cut off the solution, or the solving process was stopped */
+   if( SCIPtpiAtomicLoadInt(job->skip) != 0 || SCIPisStopped(job->set->scip) )
+   {
+      job->skipped = TRUE;
+      job->stopped = SCIPisStopped(job->set->scip);
+
+      return SCIP_OKAY;
+   }
+
+   SCIP_CALL( solveBendersSubproblem(job->benders, job->set, job->sol, job->type, job->solveloop, job->checkint,
+         job->onlyconvexcheck, job->probnumber, job->subprobsolved, job->substatus, &job->infeasible, &job->optimal,
+         &job->verified, &job->violated) );
+
+   if( job->violated && job->benders->stoponcut )
+      SCIPtpiAtomicStoreInt(job->skip, 1);
+
+   /* checking whether the limits have been exceeded in the master problem */
+   job->stopped = SCIPisStopped(job->set->scip);
+
+   return SCIP_OKAY;
+}
+
+/** solves the given Benders' decomposition subproblems in parallel with the task processing interface
+ *
+ *  The subproblems are submitted as one job each, the subproblems with the longest average solving time first, such that
+ *  the threads are balanced if the solving times are skewed. If benders/<name>/stoponcut is set, the jobs that have not
+ *  been started are skipped once a subproblem shows that the solution is infeasible or not optimal.
+ *
+ *  The OpenMP task processing interface does not provide jobs, so in this case the same jobs are executed by an OpenMP
+ *  parallel loop, which hands out the subproblems in the same order.
+ */
+static
+SCIP_RETCODE solveBendersSubproblemsParallel(
+   SCIP_BENDERS*         benders,            /**< Benders' decomposition */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_SOL*             sol,                /**< primal CIP solution */
+   SCIP_BENDERSENFOTYPE  type,               /**< the type of solution being enforced */
+   SCIP_BENDERSSOLVELOOP solveloop,          /**< the current solve loop */
+   SCIP_Bool             checkint,           /**< are the subproblems called during a check/enforce of integer sols? */
+   SCIP_Bool             onlyconvexcheck,    /**< are only the convex relaxations of the subproblems checked? */
+   int                   numthreads,         /**< the number of threads to use */
+   int*                  solveidx,           /**< the indices of subproblems to be solved in this loop */
+   int                   nsolveidx,          /**< the number of subproblems to be solved in this loop */
+   SCIP_Bool*            subprobsolved,      /**< array indicating the subproblems that were solved in this loop */
+   SCIP_BENDERSSUBSTATUS* substatus,         /**< array to store the status of the subproblems */
+   int*                  nverified,          /**< pointer to increase by the number of verified subproblems */
+   SCIP_Bool*            infeasible,         /**< pointer to update whether a subproblem is infeasible */
+   SCIP_Bool*            optimal,            /**< pointer to update whether the solution is optimal */
+   SCIP_Bool*            stopped             /**< pointer to update whether the solving process was stopped */
+   )
+{
+   SUBPROBLEMJOB* jobs;
+   SCIP_Real* expectedtime;
+   int* order;
+   SCIP_RETCODE retcode;
+   int skip;
+   int jobid;
+   int j;
+
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &jobs, nsolveidx) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &expectedtime, nsolveidx) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &order, nsolveidx) );
+
+   /* subproblems that have not been solved before are started first, followed by the slowest ones */
+   for( j = 0; j < nsolveidx; j++ )
+   {
+      SCIP_SUBPROBLEMSOLVESTAT* solvestat = benders->solvestat[solveidx[j]];
+
+      expectedtime[j] = solvestat->ncalls == 0 ? SCIPsetInfinity(set) : solvestat->avgtime;
+      order[j] = j;
+   }
+   SCIPsortDownRealInt(expectedtime, order, nsolveidx);
+
+   skip = 0;
+
+   for( j = 0; j < nsolveidx; j++ )
+   {
+      SUBPROBLEMJOB* subprobjob;
+      int probnumber;
+
+      probnumber = solveidx[order[j]];
+      subprobjob = &jobs[order[j]];
+
+      subprobjob->benders = benders;
+      subprobjob->set = set;
+      subprobjob->sol = sol;
+      subprobjob->type = type;
+      subprobjob->solveloop = solveloop;
+      subprobjob->checkint = checkint;
+      subprobjob->onlyconvexcheck = onlyconvexcheck;
+      subprobjob->probnumber = probnumber;
+      subprobjob->skip = &skip;
+      subprobjob->subprobsolved = &subprobsolved[probnumber];
+      subprobjob->substatus = &substatus[probnumber];
+      subprobjob->skipped = FALSE;
+      subprobjob->infeasible = FALSE;
+      subprobjob->optimal = TRUE;
+      subprobjob->verified = FALSE;
+      subprobjob->violated = FALSE;
+      subprobjob->stopped = FALSE;
+
+      /* the subproblem is flagged as not solved until the job is executed */
+      subprobsolved[probnumber] = FALSE;
+      substatus[probnumber] = SCIP_BENDERSSUBSTATUS_UNKNOWN;
+   }
+
+   retcode = SCIP_OKAY;
+
+   if( SCIPtpiIsAvailable() )
+   {
+      SCIP_CALL( SCIPinitTpi(set->scip, numthreads) );
+
+      jobid = SCIPtpiGetNewJobID();
+      for( j = 0; j < nsolveidx && retcode == SCIP_OKAY; j++ )
+      {
+         SCIP_SUBMITSTATUS status;
+         SCIP_JOB* job;
+
+         retcode = SCIPtpiCreateJob(&job, jobid, subproblemJobExec, (void*) &jobs[order[j]]);
+
+         if( retcode == SCIP_OKAY )
+         {
+            retcode = SCIPtpiSubmitJob(job, &status);
+
+            if( retcode == SCIP_OKAY && status != SCIP_SUBMIT_SUCCESS )
+               retcode = SCIP_ERROR;
+         }
+      }
+
+      /* all submitted jobs are collected, even after an error */
+      retcode = MIN(retcode, SCIPtpiCollectJobs(jobid));
+   }
+#ifdef _OPENMP
+   else
+   {
+#ifndef __INTEL_COMPILER
+      #pragma omp parallel for num_threads(numthreads) schedule(dynamic, 1) reduction(min:retcode)
+#endif
+      for( j = 0; j < nsolveidx; j++ )
+      {
+         SCIP_RETCODE jobretcode;
+
+         jobretcode = subproblemJobExec((void*) &jobs[order[j]]);
+         retcode = MIN(retcode, jobretcode);
+      }
+   }
+#endif
+
+   /* combining the results in the order of the subproblem indices */
+   if( retcode == SCIP_OKAY )
+   {
+      for( j = 0; j < nsolveidx; j++ )
+      {
+         if( jobs[j].skipped )
+         {
+            /* a skipped subproblem is not verified for the solution */
+            *optimal = FALSE;
+         }
+         else
+         {
+            *infeasible = *infeasible || jobs[j].infeasible;
+            *optimal = *optimal && jobs[j].optimal;
+            if( jobs[j].verified )
+               (*nverified)++;
+         }
+
+         *stopped = *stopped || jobs[j].stopped;
+      }
+   }
+
+   SCIPsetFreeBufferArray(set, &order);
+   SCIPsetFreeBufferArray(set, &expectedtime);
+   SCIPsetFreeBufferArray(set, &jobs);
+
+   return retcode;
+}
+
 /** Solves each of the Benders' decomposition subproblems for the given solution. All, or a fraction, of subproblems are
  *  solved before the Benders' decomposition cuts are generated.
  *  Since a convex relaxation of the subproblem could be solved to generate cuts, a parameter nverified is used to
  *  identified the number of subproblems that have been solved in their "original" form. For example, if the subproblem
  *  is a MIP, then if the LP is solved to generate cuts, this does not constitute a verification. The verification is
  *  only performed when the MIP is solved.
+ *  If more than one thread is requested and the task processing interface or OpenMP is available, the subproblems are
+ *  solved in parallel.
  */
 static
 SCIP_RETCODE solveBendersSubproblems(
@@ -3130,21 +3568,10 @@ SCIP_RETCODE solveBendersSubproblems(
    )
 {
    SCIP_Bool onlyconvexcheck;
-#ifdef _OPENMP
    int numthreads;
    int maxnthreads;
-#endif
-   int i;
    int j;
 
-   /* local variables for parallelisation of the solving loop */
-   int locnverified = *nverified;
-   SCIP_Bool locinfeasible = *infeasible;
-   SCIP_Bool locoptimal = *optimal;
-   SCIP_Bool locstopped = *stopped;
-
-   SCIP_RETCODE retcode = SCIP_OKAY;
-
    assert(benders != NULL);
    assert(set != NULL);
 
@@ -3153,10 +3580,9 @@ SCIP_RETCODE solveBendersSubproblems(
     * NOTE: This may not be correct. The Benders' decomposition parallelisation should not take all minimum threads if
     * they are specified. The number of threads should be specified with the Benders' decomposition parameters.
     */
-#ifdef _OPENMP
    SCIP_CALL( SCIPsetGetIntParam(set, "parallel/maxnthreads", &maxnthreads) );
    numthreads = MIN(benders->numthreads, maxnthreads);
-#endif
+   numthreads = MIN(numthreads, nsolveidx);
 
    /* in the case of an LNS check, only the convex relaxations of the subproblems will be solved. This is a performance
     * feature, since solving the convex relaxation is typically much faster than solving the corresponding CIP. While
@@ -3172,200 +3598,62 @@ SCIP_RETCODE solveBendersSubproblems(
    if( type == SCIP_BENDERSENFOTYPE_CHECK && sol == NULL )
    {
       /* TODO: Check whether this is absolutely necessary. I think that this if statment can be removed. */
-      locinfeasible = TRUE;
+      *infeasible = TRUE;
+   }
+#ifdef _OPENMP
+   else if( numthreads > 1 )
+#else
+   else if( numthreads > 1 && SCIPtpiIsAvailable() )
+#endif
+   {
+      SCIP_CALL( solveBendersSubproblemsParallel(benders, set, sol, type, solveloop, checkint, onlyconvexcheck,
+            numthreads, solveidx, nsolveidx, *subprobsolved, *substatus, nverified, infeasible, optimal, stopped) );
    }
    else
    {
+      SCIP_Bool skip = FALSE;
+
       /* solving each of the subproblems for Benders' decomposition */
       /* TODO: ensure that the each of the subproblems solve and update the parameters with the correct return values
        */
-#ifndef __INTEL_COMPILER
-      #pragma omp parallel for num_threads(numthreads) private(i) reduction(&&:locoptimal) reduction(||:locinfeasible) reduction(+:locnverified) reduction(||:locstopped) reduction(min:retcode)
-#endif
       for( j = 0; j < nsolveidx; j++ )
       {
-         SCIP_Bool subinfeas = FALSE;
-         SCIP_Bool convexsub;
-         SCIP_Bool solvesub = TRUE;
-         SCIP_Bool solved;
+         SCIP_Bool subinfeas;
+         SCIP_Bool suboptimal;
+         SCIP_Bool verified;
+         SCIP_Bool violated;
+         int i;
 
          i = solveidx[j];
-         convexsub = SCIPbendersGetSubproblemType(benders, i) == SCIP_BENDERSSUBTYPE_CONVEXCONT;;
-
-         /* the subproblem is initially flagged as not solved for this solving loop */
-         (*subprobsolved)[i] = FALSE;
-
-         /* setting the subsystem status to UNKNOWN at the start of each solve loop */
-         (*substatus)[i] = SCIP_BENDERSSUBSTATUS_UNKNOWN;
 
-         /* for the second solving loop, if the problem is an LP, it is not solved again. If the problem is a MIP,
-          * then the subproblem objective function value is set to infinity. However, if the subproblem is proven
-          * infeasible from the LP, then the IP loop is not performed.
-          * If the solve loop is SCIP_BENDERSSOLVELOOP_USERCIP, then nothing is done. It is assumed that the user will
-          * correctly update the objective function within the user-defined solving function.
-          */
-         if( solveloop == SCIP_BENDERSSOLVELOOP_CIP )
-         {
-            if( convexsub || (*substatus)[i] == SCIP_BENDERSSUBSTATUS_INFEAS )
-               solvesub = FALSE;
-            else
-            {
-               SCIPbendersSetSubproblemObjval(benders, i, SCIPbendersSubproblem(benders, i) != NULL ?
-                  SCIPinfinity(SCIPbendersSubproblem(benders, i)) : SCIPsetInfinity(set));
-            }
-         }
-
-         /* if the subproblem is independent, then it does not need to be solved. In this case, the nverified flag will
-          * increase by one. When the subproblem is not independent, then it needs to be checked.
-          */
-         if( !subproblemIsActive(benders, i) )
+         /* a previous subproblem already showed that the solution is infeasible or not optimal */
+         if( skip )
          {
-            /* NOTE: There is no need to update the optimal flag. This is because optimal is always TRUE until a
-             * non-optimal subproblem is found.
-             */
-            /* if the auxiliary variable value is infinity, then the subproblem has not been solved yet. Currently the
-             * subproblem statue is unknown. */
-            if( SCIPsetIsInfinity(set, SCIPbendersGetAuxiliaryVarVal(benders, set, sol, i))
-               || SCIPsetIsInfinity(set, -SCIPbendersGetAuxiliaryVarVal(benders, set, sol, i))
-               || SCIPsetIsInfinity(set, -SCIPbendersGetSubproblemLowerbound(benders, i)) )
-            {
-               SCIPbendersSetSubproblemObjval(benders, i, SCIPbendersSubproblem(benders, i) != NULL ?
-                  SCIPinfinity(SCIPbendersSubproblem(benders, i)) : SCIPsetInfinity(set));
-
-               (*substatus)[i] = SCIP_BENDERSSUBSTATUS_UNKNOWN;
-               locoptimal = FALSE;
-
-               SCIPsetDebugMsg(set, "Benders' decomposition: subproblem %d is not active, but has not been solved."
-                 " setting status to UNKNOWN\n", i);
-            }
-            else
-            {
-               if( SCIPrelDiff(SCIPbendersGetSubproblemLowerbound(benders, i),
-                     SCIPbendersGetAuxiliaryVarVal(benders, set, sol, i)) < benders->solutiontol )
-               {
-                  SCIPbendersSetSubproblemObjval(benders, i, SCIPbendersGetAuxiliaryVarVal(benders, set, sol, i));
-                  (*substatus)[i] = SCIP_BENDERSSUBSTATUS_OPTIMAL;
-               }
-               else
-               {
-                  SCIPbendersSetSubproblemObjval(benders, i, SCIPbendersGetSubproblemLowerbound(benders, i));
-                  (*substatus)[i] = SCIP_BENDERSSUBSTATUS_AUXVIOL;
-               }
-
-               SCIPsetDebugMsg(set, "Benders' decomposition: subproblem %d is not active, setting status to OPTIMAL\n", i);
-            }
-
-            (*subprobsolved)[i] = TRUE;
-
-            /* the nverified counter is only increased in the convex solving loop */
-            if( solveloop == SCIP_BENDERSSOLVELOOP_CONVEX || solveloop == SCIP_BENDERSSOLVELOOP_USERCONVEX )
-               locnverified++;
+            (*subprobsolved)[i] = FALSE;
+            (*substatus)[i] = SCIP_BENDERSSUBSTATUS_UNKNOWN;
+            *optimal = FALSE;
+            continue;
          }
-         else if( solvesub )
-         {
-            retcode = SCIPbendersExecSubproblemSolve(benders, set, sol, i, solveloop, FALSE, &solved, &subinfeas, type);
-
-            /* the solution for the subproblem is only processed if the return code is SCIP_OKAY */
-            if( retcode == SCIP_OKAY )
-            {
-#ifdef SCIP_DEBUG
-               if( type == SCIP_BENDERSENFOTYPE_LP )
-               {
-               SCIPsetDebugMsg(set, "Enfo LP: Subproblem %d Type %d (%f < %f)\n", i,
-                  SCIPbendersGetSubproblemType(benders, i), SCIPbendersGetAuxiliaryVarVal(benders, set, sol, i),
-                     SCIPbendersGetSubproblemObjval(benders, i));
-               }
-#endif
-               (*subprobsolved)[i] = solved;
 
-               locinfeasible = locinfeasible || subinfeas;
-               if( subinfeas )
-                  (*substatus)[i] = SCIP_BENDERSSUBSTATUS_INFEAS;
-
-               /* if the subproblems are solved to check integer feasibility, then the optimality check must be performed.
-                * This will only be performed if checkint is TRUE and the subproblem was solved. The subproblem may not be
-                * solved if the user has defined a solving function
-                */
-               if( checkint && (*subprobsolved)[i] )
-               {
-                  /* if the subproblem is feasible, then it is necessary to update the value of the auxiliary variable to the
-                   * objective function value of the subproblem.
-                   */
-                  if( !subinfeas )
-                  {
-                     SCIP_Bool subproboptimal;
-
-                     subproboptimal = SCIPbendersSubproblemIsOptimal(benders, set, sol, i);
-
-                     if( subproboptimal )
-                        (*substatus)[i] = SCIP_BENDERSSUBSTATUS_OPTIMAL;
-                     else
-                        (*substatus)[i] = SCIP_BENDERSSUBSTATUS_AUXVIOL;
-
-                     /* It is only possible to determine the optimality of a solution within a given subproblem in four
-                      * different cases:
-                      * i) solveloop == SCIP_BENDERSSOLVELOOP_CONVEX or USERCONVEX and the subproblem is convex.
-                      * ii) solveloop == SCIP_BENDERSOLVELOOP_CONVEX  and only the convex relaxations will be checked.
-                      * iii) solveloop == SCIP_BENDERSSOLVELOOP_USERCIP and the subproblem was solved, since the user has
-                      * defined a solve function, it is expected that the solving is correctly executed.
-                      * iv) solveloop == SCIP_BENDERSSOLVELOOP_CIP and the MIP for the subproblem has been solved.
-                      */
-                     if( convexsub || onlyconvexcheck
-                        || solveloop == SCIP_BENDERSSOLVELOOP_CIP
-                        || solveloop == SCIP_BENDERSSOLVELOOP_USERCIP )
-                        locoptimal = locoptimal && subproboptimal;
+         SCIP_CALL( solveBendersSubproblem(benders, set, sol, type, solveloop, checkint, onlyconvexcheck, i,
+               &(*subprobsolved)[i], &(*substatus)[i], &subinfeas, &suboptimal, &verified, &violated) );
 
-#ifdef SCIP_DEBUG
-                     if( convexsub || solveloop >= SCIP_BENDERSSOLVELOOP_CIP )
-                     {
-                        if( subproboptimal )
-                        {
-                           SCIPsetDebugMsg(set, "Subproblem %d is Optimal (%f >= %f)\n", i,
-                              SCIPbendersGetAuxiliaryVarVal(benders, set, sol, i), SCIPbendersGetSubproblemObjval(benders, i));
-                        }
-                        else
-                        {
-                           SCIPsetDebugMsg(set, "Subproblem %d is NOT Optimal (%f < %f)\n", i,
-                              SCIPbendersGetAuxiliaryVarVal(benders, set, sol, i), SCIPbendersGetSubproblemObjval(benders, i));
-                        }
-                     }
-#endif
+         *infeasible = *infeasible || subinfeas;
+         *optimal = *optimal && suboptimal;
+         if( verified )
+            (*nverified)++;
 
-                     /* the nverified variable is only incremented when the original form of the subproblem has been solved.
-                      * What is meant by "original" is that the LP relaxation of CIPs are solved to generate valid cuts. So
-                      * if the subproblem is defined as a CIP, then it is only classified as checked if the CIP is solved.
-                      * There are three cases where the "original" form is solved are:
-                      * i) solveloop == SCIP_BENDERSSOLVELOOP_CONVEX or USERCONVEX and the subproblem is an LP
-                      *    - the original form has been solved.
-                      * ii) solveloop == SCIP_BENDERSSOLVELOOP_CIP or USERCIP and the CIP for the subproblem has been
-                      *    solved.
-                      * iii) or, only a convex check is performed.
-                      */
-                     if( ((solveloop == SCIP_BENDERSSOLVELOOP_CONVEX || solveloop == SCIP_BENDERSSOLVELOOP_USERCONVEX)
-                           && convexsub)
-                        || ((solveloop == SCIP_BENDERSSOLVELOOP_CIP || solveloop == SCIP_BENDERSSOLVELOOP_USERCIP)
-                           && !convexsub)
-                        || onlyconvexcheck )
-                        locnverified++;
-                  }
-               }
-            }
-         }
+         skip = violated && benders->stoponcut;
 
          /* checking whether the limits have been exceeded in the master problem */
-         locstopped = SCIPisStopped(set->scip);
+         *stopped = SCIPisStopped(set->scip);
       }
    }
 
-   /* setting the input parameters to the local variables */
-   SCIPsetDebugMsg(set, "Local variable values: nverified %d infeasible %u optimal %u stopped %u\n", locnverified,
-      locinfeasible, locoptimal, locstopped);
-   *nverified = locnverified;
-   *infeasible = locinfeasible;
-   *optimal = locoptimal;
-   *stopped = locstopped;
+   SCIPsetDebugMsg(set, "Local variable values: nverified %d infeasible %u optimal %u stopped %u\n", *nverified,
+      *infeasible, *optimal, *stopped);
 
-   return retcode;
+   return SCIP_OKAY;
 }
 
 /** Calls the Benders' decompsition cuts for the given solve loop. There are four cases:
@@ -217,8 +217,24 @@ SCIP_RETCODE SCIPselectVarStrongBranching(
    SCIP_Bool upconflict;
    SCIP_Bool bothgains;
    SCIP_Bool propagate;
+   SCIP_Bool* batchdone = NULL;
+   SCIP_Real* batchdown = NULL;
+   SCIP_Real* batchup = NULL;
+   SCIP_Bool* batchdownvalid = NULL;
+   SCIP_Bool* batchupvalid = NULL;
+   SCIP_Bool* batchdowninf = NULL;
+   SCIP_Bool* batchupinf = NULL;
+   SCIP_Bool* batchdownconflict = NULL;
+   SCIP_Bool* batchupconflict = NULL;
+   SCIP_Bool batchlperror = FALSE;
+   SCIP_VAR** batchvars = NULL;
+   int* batchpos = NULL;
+   int nbatchcands;
+   int batchend = 0;
    int nvars = 0;
    int nsbcalls;
+   int maxnthreads;
+   int sbnthreads;
    int i;
    int c;
 
@@ -300,6 +316,29 @@ SCIP_RETCODE SCIPselectVarStrongBranching(
     /* initialize strong branching */
    SCIP_CALL( SCIPstartStrongbranch(scip, propagate) );
 
+   /* if several threads are available for strong branching without propagation, the candidates that the loop below
+    * evaluates are passed to the LP in rounds of one candidate per thread, such that they are solved in parallel; the
+    * loop then processes the results in the same order as in the sequential case
+    */
+   SCIP_CALL( SCIPgetIntParam(scip, "branching/sbnthreads", &sbnthreads) );
+   SCIP_CALL( SCIPgetIntParam(scip, "parallel/maxnthreads", &maxnthreads) );
+   sbnthreads = MIN(sbnthreads, maxnthreads);
+   nbatchcands = MIN(nlpcands, ncomplete);
+   if( !propagate && sbnthreads > 1 && nbatchcands > 1 )
+   {
+      SCIP_CALL( SCIPallocClearBufferArray(scip, &batchdone, nbatchcands) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &batchdown, nbatchcands) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &batchup, nbatchcands) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &batchdownvalid, nbatchcands) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &batchupvalid, nbatchcands) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &batchdowninf, nbatchcands) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &batchupinf, nbatchcands) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &batchdownconflict, nbatchcands) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &batchupconflict, nbatchcands) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &batchvars, sbnthreads) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &batchpos, sbnthreads) );
+   }
+
    /* search the full strong candidate
     * cycle through the candidates, starting with the position evaluated in the last run
     */
@@ -310,10 +349,59 @@ SCIP_RETCODE SCIPselectVarStrongBranching(
       c = c % nlpcands;
       assert(lpcands[c] != NULL);
 
+      /* evaluate the next round of candidates in parallel */
+      if( batchdone != NULL && i < nbatchcands && i >= batchend && !batchdone[i] )
+      {
+         int nbatch;
+         int b;
+
+         /* collect the next candidates whose strong branching values are not cached */
+         nbatch = 0;
+         for( batchend = i; batchend < nbatchcands && nbatch < sbnthreads; ++batchend )
+         {
+            int bc = (*start + batchend) % nlpcands;
+
+            if( SCIPgetVarStrongbranchNode(scip, lpcands[bc]) == nodenum
+               && SCIPgetVarStrongbranchLPAge(scip, lpcands[bc]) < reevalage )
+               continue;
+
+            batchvars[nbatch] = lpcands[bc];
+            batchpos[nbatch] = batchend;
+            ++nbatch;
+         }
+
+         if( nbatch > 0 )
+         {
+            SCIP_CALL( SCIPgetVarsStrongbranchesFrac(scip, batchvars, nbatch, INT_MAX, batchdown, batchup,
+                  batchdownvalid, batchupvalid, batchdowninf, batchupinf, batchdownconflict, batchupconflict,
+                  &batchlperror) );
+
+            /* move the results to the loop positions of the candidates, starting at the back to not overwrite them */
+            for( b = nbatch - 1; b >= 0; --b )
+            {
+               int pos = batchpos[b];
+
+               assert(pos >= b);
+
+               batchdone[pos] = TRUE;
+               batchdown[pos] = batchdown[b];
+               batchup[pos] = batchup[b];
+               batchdownvalid[pos] = batchdownvalid[b];
+               batchupvalid[pos] = batchupvalid[b];
+               batchdowninf[pos] = batchdowninf[b];
+               batchupinf[pos] = batchupinf[b];
+               batchdownconflict[pos] = batchdownconflict[b];
+               batchupconflict[pos] = batchupconflict[b];
+            }
+         }
+      }
+
       /* don't use strong branching on variables that have already been initialized at the current node,
-       * and that were evaluated not too long ago
+       * and that were evaluated not too long ago; the candidates evaluated in the current round of parallel strong
+       * branching are also initialized at the current node, but their values are taken from the round
        */
-      if( SCIPgetVarStrongbranchNode(scip, lpcands[c]) == nodenum
+      if( (batchdone == NULL || i >= nbatchcands || !batchdone[i])
+         && SCIPgetVarStrongbranchNode(scip, lpcands[c]) == nodenum
          && SCIPgetVarStrongbranchLPAge(scip, lpcands[c]) < reevalage )
       {
          SCIP_Real lastlpobjval;
@@ -351,6 +439,20 @@ SCIP_RETCODE SCIPselectVarStrongBranching(
             SCIPdebugMsg(scip, "-> down=%.9g (gain=%.9g, valid=%u, inf=%u, conflict=%u), up=%.9g (gain=%.9g, valid=%u, inf=%u, conflict=%u)\n",
                down, down - lpobjval, downvalid, downinf, downconflict, up, up - lpobjval, upvalid, upinf, upconflict);
          }
+         else if( batchdone != NULL && i < nbatchcands && batchdone[i] )
+         {
+            /* candidates evaluated in parallel are never skipped, because they are among the first ncomplete ones */
+            batchdone[i] = FALSE;
+            down = batchdown[i];
+            up = batchup[i];
+            downvalid = batchdownvalid[i];
+            upvalid = batchupvalid[i];
+            downinf = batchdowninf[i];
+            upinf = batchupinf[i];
+            downconflict = batchdownconflict[i];
+            upconflict = batchupconflict[i];
+            lperror = batchlperror;
+         }
          else
          {
             SCIP_CALL( SCIPgetVarStrongbranchFrac(scip, lpcands[c], INT_MAX, FALSE,
@@ -521,11 +623,40 @@ SCIP_RETCODE SCIPselectVarStrongBranching(
          SCIPvarGetName(lpcands[*bestcand]), *bestscore);
    }
 
+   if( batchdone != NULL )
+   {
+      /* the loop was left before it processed all candidates of the last round; in the sequential case, these
+       * candidates would not have been evaluated, so their strong branching values must not be reused later
+       */
+      for( i = 0; i < nbatchcands; ++i )
+      {
+         if( batchdone[i] )
+         {
+            SCIP_CALL( SCIPinvalidateVarStrongbranchData(scip, lpcands[(*start + i) % nlpcands]) );
+         }
+      }
+   }
+
    /* end strong branching */
    SCIP_CALL( SCIPendStrongbranch(scip) );
 
    *start = c;
 
+   if( batchdone != NULL )
+   {
+      SCIPfreeBufferArray(scip, &batchpos);
+      SCIPfreeBufferArray(scip, &batchvars);
+      SCIPfreeBufferArray(scip, &batchupconflict);
+      SCIPfreeBufferArray(scip, &batchdownconflict);
+      SCIPfreeBufferArray(scip, &batchupinf);
+      SCIPfreeBufferArray(scip, &batchdowninf);
+      SCIPfreeBufferArray(scip, &batchupvalid);
+      SCIPfreeBufferArray(scip, &batchdownvalid);
+      SCIPfreeBufferArray(scip, &batchup);
+      SCIPfreeBufferArray(scip, &batchdown);
+      SCIPfreeBufferArray(scip, &batchdone);
+   }
+
    if( probingbounds )
    {
       assert(newlbs != NULL);
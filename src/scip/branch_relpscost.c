@@ -757,6 +757,30 @@ SCIP_RETCODE applyBdchgs(
    return SCIP_OKAY;
 }
 
+/** invalidates the strong branching data of the candidates of the last batch whose results were not used, such that
+ *  later strong branching calls on the same LP do not reuse them
+ */
+static
+SCIP_RETCODE invalidateUnusedBatch(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_VAR**            batchvars,          /**< candidates of the last batch */
+   SCIP_Bool*            batchused,          /**< stores for each candidate whether its results were used */
+   int                   nbatchvars          /**< number of candidates in the last batch */
+   )
+{
+   int k;
+
+   for( k = 0; k < nbatchvars; ++k )
+   {
+      if( !batchused[k] )
+      {
+         SCIP_CALL( SCIPinvalidateVarStrongbranchData(scip, batchvars[k]) );
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
 /** execute reliability pseudo cost branching */
 static
 SCIP_RETCODE execRelpscost(
@@ -888,6 +912,21 @@ SCIP_RETCODE execRelpscost(
       int bestpscand;
       int bestsbcand;
       int bestuninitsbcand;
+      SCIP_VAR** batchvars = NULL;
+      SCIP_Real* batchdown = NULL;
+      SCIP_Real* batchup = NULL;
+      SCIP_Bool* batchdownvalid = NULL;
+      SCIP_Bool* batchupvalid = NULL;
+      SCIP_Bool* batchdowninf = NULL;
+      SCIP_Bool* batchupinf = NULL;
+      SCIP_Bool* batchdownconflict = NULL;
+      SCIP_Bool* batchupconflict = NULL;
+      SCIP_Bool* batchused = NULL;
+      SCIP_Bool batchlperror = FALSE;
+      int batchstart = 0;
+      int batchend = 0;
+      int sbnthreads;
+      int maxnthreads;
       int inititer;
       int nvars;
       int i;
@@ -1392,6 +1431,24 @@ SCIP_RETCODE execRelpscost(
                SCIP_CALL( SCIPallocBlockMemoryArray(scip, &newlbs, nvars) );
                SCIP_CALL( SCIPallocBlockMemoryArray(scip, &newubs, nvars) );
             }
+
+            /* create arrays for evaluating several candidates in parallel */
+            SCIP_CALL( SCIPgetIntParam(scip, "branching/sbnthreads", &sbnthreads) );
+            SCIP_CALL( SCIPgetIntParam(scip, "parallel/maxnthreads", &maxnthreads) );
+            sbnthreads = MIN(sbnthreads, maxnthreads);
+            if( !propagate && sbnthreads > 1 )
+            {
+               SCIP_CALL( SCIPallocBufferArray(scip, &batchvars, sbnthreads) );
+               SCIP_CALL( SCIPallocBufferArray(scip, &batchdown, sbnthreads) );
+               SCIP_CALL( SCIPallocBufferArray(scip, &batchup, sbnthreads) );
+               SCIP_CALL( SCIPallocBufferArray(scip, &batchdownvalid, sbnthreads) );
+               SCIP_CALL( SCIPallocBufferArray(scip, &batchupvalid, sbnthreads) );
+               SCIP_CALL( SCIPallocBufferArray(scip, &batchdowninf, sbnthreads) );
+               SCIP_CALL( SCIPallocBufferArray(scip, &batchupinf, sbnthreads) );
+               SCIP_CALL( SCIPallocBufferArray(scip, &batchdownconflict, sbnthreads) );
+               SCIP_CALL( SCIPallocBufferArray(scip, &batchupconflict, sbnthreads) );
+               SCIP_CALL( SCIPallocBufferArray(scip, &batchused, sbnthreads) );
+            }
          }
 
          if( propagate )
@@ -1401,6 +1458,51 @@ SCIP_RETCODE execRelpscost(
                   branchruledata->maxproprounds, &down, &up, &downvalid, &upvalid, &ndomredsdown, &ndomredsup, &downinf, &upinf,
                   &downconflict, &upconflict, &lperror, newlbs, newubs) );
          }
+         else if( batchvars != NULL )
+         {
+            int k;
+
+            /* if the candidate was not part of the last batch, apply strong branching in parallel on it and the next
+             * initialization candidates; the later candidates of a batch are evaluated before it is known whether the
+             * loop reaches them, such that results of candidates that are skipped or not reached anymore are discarded
+             * and only cost additional LP iterations; since the candidates are evaluated on copies of the LP, the
+             * values of iteration limited strong branching calls may differ from the sequential ones
+             */
+            if( i >= batchend )
+            {
+               SCIP_CALL( invalidateUnusedBatch(scip, batchvars, batchused, batchend - batchstart) );
+
+               batchstart = i;
+               batchend = MIN(i + sbnthreads, ninitcands);
+
+               for( k = batchstart; k < batchend; ++k )
+               {
+                  batchvars[k - batchstart] = branchcands[initcands[k]];
+                  batchused[k - batchstart] = FALSE;
+               }
+
+               SCIP_CALL( SCIPgetVarsStrongbranchesFrac(scip, batchvars, batchend - batchstart, inititer, batchdown,
+                     batchup, batchdownvalid, batchupvalid, batchdowninf, batchupinf, batchdownconflict, batchupconflict,
+                     &batchlperror) );
+            }
+
+            k = i - batchstart;
+            assert(0 <= k && k < sbnthreads);
+            assert(batchvars[k] == branchcands[c]);
+            batchused[k] = TRUE;
+
+            down = batchdown[k];
+            up = batchup[k];
+            downvalid = batchdownvalid[k];
+            upvalid = batchupvalid[k];
+            downinf = batchdowninf[k];
+            upinf = batchupinf[k];
+            downconflict = batchdownconflict[k];
+            upconflict = batchupconflict[k];
+            lperror = batchlperror;
+
+            ndomredsdown = ndomredsup = 0;
+         }
          else
          {
             /* apply strong branching */
@@ -1680,6 +1782,22 @@ SCIP_RETCODE execRelpscost(
 
       if( initstrongbranching )
       {
+         if( batchvars != NULL )
+         {
+            SCIP_CALL( invalidateUnusedBatch(scip, batchvars, batchused, batchend - batchstart) );
+
+            SCIPfreeBufferArray(scip, &batchused);
+            SCIPfreeBufferArray(scip, &batchupconflict);
+            SCIPfreeBufferArray(scip, &batchdownconflict);
+            SCIPfreeBufferArray(scip, &batchupinf);
+            SCIPfreeBufferArray(scip, &batchdowninf);
+            SCIPfreeBufferArray(scip, &batchupvalid);
+            SCIPfreeBufferArray(scip, &batchdownvalid);
+            SCIPfreeBufferArray(scip, &batchup);
+            SCIPfreeBufferArray(scip, &batchdown);
+            SCIPfreeBufferArray(scip, &batchvars);
+         }
+
          if( probingbounds )
          {
             assert(newlbs != NULL);
@@ -228,7 +228,9 @@ SCIP_RETCODE SCIPconcsolverCreateInstance(
    (*concsolver)->nsolsshared = 0;
    (*concsolver)->ntighterbnds = 0;
    (*concsolver)->ntighterintbnds = 0;
+   (*concsolver)->nsyncwaits = 0;
    SCIP_CALL( SCIPcreateWallClock(set->scip, &(*concsolver)->totalsynctime) );
+   SCIP_CALL( SCIPcreateWallClock(set->scip, &(*concsolver)->syncwaittime) );
 
    /* initialize synchronization fields */
    (*concsolver)->nsyncs = 0;
@@ -244,6 +246,12 @@ SCIP_RETCODE SCIPconcsolverCreateInstance(
 
    (*concsolver)->syncdata = NULL;
 
+   /* the solver works on the whole search tree unless split bounds are set */
+   (*concsolver)->splitvaridxs = NULL;
+   (*concsolver)->splitbndtypes = NULL;
+   (*concsolver)->splitbnds = NULL;
+   (*concsolver)->nsplitbnds = 0;
+
    SCIPdebugMessage("concsolver %s initialized sync freq to %f\n", (*concsolver)->name, (*concsolver)->syncfreq);
    /* register concurrent solver */
    (*concsolver)->idx = SCIPgetNConcurrentSolvers(set->scip);
@@ -267,7 +275,11 @@ SCIP_RETCODE SCIPconcsolverDestroyInstance(
    SCIP_CALL( (*concsolver)->type->concsolverdestroyinst(set->scip, *concsolver) );
    --(*concsolver)->type->ninstances;
 
+   SCIP_CALL( SCIPfreeClock(set->scip, &(*concsolver)->syncwaittime) );
    SCIP_CALL( SCIPfreeClock(set->scip, &(*concsolver)->totalsynctime) );
+   BMSfreeMemoryArrayNull(&(*concsolver)->splitbnds);
+   BMSfreeMemoryArrayNull(&(*concsolver)->splitbndtypes);
+   BMSfreeMemoryArrayNull(&(*concsolver)->splitvaridxs);
    BMSfreeMemoryArray(&(*concsolver)->name);
 
    BMSfreeMemory(concsolver);
@@ -489,7 +501,15 @@ SCIP_RETCODE SCIPconcsolverSync(
 
    while( syncdata != NULL )
    {
-      SCIP_CALL( SCIPsyncstoreEnsureAllSynced(syncstore, syncdata) );
+      /* wait for the solvers that have not yet written to the synchronization data */
+      if( !SCIPsyncstoreIsAllSynced(syncstore, syncdata) )
+      {
+         ++concsolver->nsyncwaits;
+         SCIP_CALL( SCIPstartClock(set->scip, concsolver->syncwaittime) );
+         SCIP_CALL( SCIPsyncstoreEnsureAllSynced(syncstore, syncdata) );
+         SCIP_CALL( SCIPstopClock(set->scip, concsolver->syncwaittime) );
+      }
+
       concsolver->syncdata = syncdata;
       SCIP_CALL( concsolvertype->concsolversyncread(concsolver, syncstore, syncdata, &nsols, &ntighterbnds, &ntighterintbnds) );
       concsolver->ntighterbnds += ntighterbnds;
@@ -559,6 +579,36 @@ SCIP_Real SCIPconcsolverGetSyncTime(
    return SCIPclockGetTime(concsolver->totalsynctime);
 }
 
+/** gets the time the concurrent solver spent waiting for other solvers during synchronization */
+SCIP_Real SCIPconcsolverGetSyncWaitTime(
+   SCIP_CONCSOLVER*      concsolver          /**< concurrent solver */
+   )
+{
+   assert(concsolver != NULL);
+
+   return SCIPclockGetTime(concsolver->syncwaittime);
+}
+
+/** gets the number of times the concurrent solver had to wait for other solvers during synchronization */
+SCIP_Longint SCIPconcsolverGetNSyncWaits(
+   SCIP_CONCSOLVER*      concsolver          /**< concurrent solver */
+   )
+{
+   assert(concsolver != NULL);
+
+   return concsolver->nsyncwaits;
+}
+
+/** gets the number of synchronizations the concurrent solver has taken part in */
+SCIP_Longint SCIPconcsolverGetNSyncs(
+   SCIP_CONCSOLVER*      concsolver          /**< concurrent solver */
+   )
+{
+   assert(concsolver != NULL);
+
+   return concsolver->nsyncs;
+}
+
 /** gets the number of lp iterations the concurrent solver used */
 SCIP_Longint SCIPconcsolverGetNLPIterations(
    SCIP_CONCSOLVER*      concsolver          /**< concurrent solver */
@@ -628,3 +678,54 @@ int SCIPconcsolverGetIdx(
 
    return concsolver->idx;
 }
+
+/** sets the bounds that restrict the concurrent solver to its part of a split search tree; the variables are given
+ *  by their index in the variable array of the main SCIP
+ */
+SCIP_RETCODE SCIPconcsolverSetSplitBounds(
+   SCIP_CONCSOLVER*      concsolver,         /**< concurrent solver */
+   int*                  varidxs,            /**< indices of the variables in the main SCIP */
+   SCIP_BOUNDTYPE*       bndtypes,           /**< types of the bounds */
+   SCIP_Real*            bnds,               /**< values of the bounds */
+   int                   nbnds               /**< number of bounds */
+   )
+{
+   assert(concsolver != NULL);
+   assert(nbnds == 0 || (varidxs != NULL && bndtypes != NULL && bnds != NULL));
+
+   BMSfreeMemoryArrayNull(&concsolver->splitbnds);
+   BMSfreeMemoryArrayNull(&concsolver->splitbndtypes);
+   BMSfreeMemoryArrayNull(&concsolver->splitvaridxs);
+   concsolver->nsplitbnds = 0;
+
+   if( nbnds == 0 )
+      return SCIP_OKAY;
+
+   SCIP_ALLOC( BMSduplicateMemoryArray(&concsolver->splitvaridxs, varidxs, nbnds) );
+   SCIP_ALLOC( BMSduplicateMemoryArray(&concsolver->splitbndtypes, bndtypes, nbnds) );
+   SCIP_ALLOC( BMSduplicateMemoryArray(&concsolver->splitbnds, bnds, nbnds) );
+   concsolver->nsplitbnds = nbnds;
+
+   return SCIP_OKAY;
+}
+
+/** gets the bounds that restrict the concurrent solver to its part of a split search tree */
+void SCIPconcsolverGetSplitBounds(
+   SCIP_CONCSOLVER*      concsolver,         /**< concurrent solver */
+   int**                 varidxs,            /**< pointer to store the indices of the variables in the main SCIP */
+   SCIP_BOUNDTYPE**      bndtypes,           /**< pointer to store the types of the bounds */
+   SCIP_Real**           bnds,               /**< pointer to store the values of the bounds */
+   int*                  nbnds               /**< pointer to store the number of bounds */
+   )
+{
+   assert(concsolver != NULL);
+   assert(varidxs != NULL);
+   assert(bndtypes != NULL);
+   assert(bnds != NULL);
+   assert(nbnds != NULL);
+
+   *varidxs = concsolver->splitvaridxs;
+   *bndtypes = concsolver->splitbndtypes;
+   *bnds = concsolver->splitbnds;
+   *nbnds = concsolver->nsplitbnds;
+}
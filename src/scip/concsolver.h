@@ -37,6 +37,7 @@
 #include "scip/type_retcode.h"
 #include "scip/type_set.h"
 #include "scip/type_concsolver.h"
+#include "scip/type_lp.h"
 #include "scip/type_syncstore.h"
 
 #ifdef __cplusplus
@@ -176,6 +177,21 @@ SCIP_Real SCIPconcsolverGetSyncTime(
    SCIP_CONCSOLVER*      concsolver          /**< concurrent solver */
    );
 
+/** gets the time the concurrent solver spent waiting for other solvers during synchronization */
+SCIP_Real SCIPconcsolverGetSyncWaitTime(
+   SCIP_CONCSOLVER*      concsolver          /**< concurrent solver */
+   );
+
+/** gets the number of times the concurrent solver had to wait for other solvers during synchronization */
+SCIP_Longint SCIPconcsolverGetNSyncWaits(
+   SCIP_CONCSOLVER*      concsolver          /**< concurrent solver */
+   );
+
+/** gets the number of synchronizations the concurrent solver has taken part in */
+SCIP_Longint SCIPconcsolverGetNSyncs(
+   SCIP_CONCSOLVER*      concsolver          /**< concurrent solver */
+   );
+
 /** gets the number of lp iterations the concurrent solver used */
 SCIP_Longint SCIPconcsolverGetNLPIterations(
    SCIP_CONCSOLVER*      concsolver          /**< concurrent solver */
@@ -211,6 +227,26 @@ int SCIPconcsolverGetIdx(
    SCIP_CONCSOLVER*      concsolver          /**< concurrent solver */
    );
 
+/** sets the bounds that restrict the concurrent solver to its part of a split search tree; the variables are given
+ *  by their index in the variable array of the main SCIP
+ */
+SCIP_RETCODE SCIPconcsolverSetSplitBounds(
+   SCIP_CONCSOLVER*      concsolver,         /**< concurrent solver */
+   int*                  varidxs,            /**< indices of the variables in the main SCIP */
+   SCIP_BOUNDTYPE*       bndtypes,           /**< types of the bounds */
+   SCIP_Real*            bnds,               /**< values of the bounds */
+   int                   nbnds               /**< number of bounds */
+   );
+
+/** gets the bounds that restrict the concurrent solver to its part of a split search tree */
+void SCIPconcsolverGetSplitBounds(
+   SCIP_CONCSOLVER*      concsolver,         /**< concurrent solver */
+   int**                 varidxs,            /**< pointer to store the indices of the variables in the main SCIP */
+   SCIP_BOUNDTYPE**      bndtypes,           /**< pointer to store the types of the bounds */
+   SCIP_Real**           bnds,               /**< pointer to store the values of the bounds */
+   int*                  nbnds               /**< pointer to store the number of bounds */
+   );
+
 #ifdef __cplusplus
 }
 #endif
@@ -56,6 +56,7 @@
 #include "scip/scip_solve.h"
 #include "scip/scip_solvingstats.h"
 #include "scip/scip_timing.h"
+#include "scip/scip_var.h"
 #include "scip/syncstore.h"
 #include <string.h>
 
@@ -197,6 +198,7 @@ struct SCIP_ConcSolverData
    SCIP*                 solverscip;         /**< the concurrent solvers private SCIP datastructure */
    SCIP_VAR**            vars;               /**< array of variables in the order of the main SCIP's variable array */
    int                   nvars;              /**< number of variables in the above arrays */
+   SCIP_Bool             treesplit;          /**< does the solver only search its own part of a split search tree? */
 };
 
 /** Disable dual reductions that might cut off optimal solutions. Although they keep at least
@@ -237,6 +239,27 @@ SCIP_RETCODE setChildSelRule(
    return SCIP_OKAY;
 }
 
+/** sets the algorithm for the initial LP based on the index of the concurrent solver, such that the solvers use the
+ *  dual simplex, the primal simplex, and the barrier in turn
+ */
+static
+SCIP_RETCODE setInitLPAlgorithm(
+   SCIP_CONCSOLVER*      concsolver          /**< the concurrent solver */
+   )
+{
+   SCIP_CONCSOLVERDATA*  data;
+   static const char lpalgo[] = { 'd', 'p', 'b' };
+
+   assert(concsolver != NULL);
+
+   data = SCIPconcsolverGetData(concsolver);
+   assert(data != NULL);
+
+   SCIP_CALL( SCIPsetCharParam(data->solverscip, "lp/initalgorithm", lpalgo[SCIPconcsolverGetIdx(concsolver) % 3]) );
+
+   return SCIP_OKAY;
+}
+
 /** initialize the concurrent SCIP solver, i.e. setup the copy of the problem and the
  *  mapping of the variables */
 static
@@ -312,6 +335,12 @@ SCIP_RETCODE initConcsolver(
       assert(stored);
    }
 
+   /* on a split search tree, global bound changes of one solver are not valid for the other solvers */
+   if( data->treesplit )
+   {
+      SCIP_CALL( SCIPsetBoolParam(data->solverscip, "concurrent/commvarbnds", FALSE) );
+   }
+
    /* create the concurrent data structure for the concurrent solver's SCIP */
    /* this assert fails on check/instances/Symmetry/packorb_1-FullIns_3.cip
     * assert(SCIPgetNOrigVars(data->solverscip) == data->nvars);
@@ -336,6 +365,9 @@ SCIP_DECL_CONCSOLVERCREATEINST(concsolverScipCreateInstance)
    char*                    prefix;
    char                     filename[SCIP_MAXSTRLEN];
    SCIP_Bool                changechildsel;
+   SCIP_Bool                changelpalgo;
+   SCIP_Bool                presolvebefore;
+   SCIP_Bool                presolvecopies;
 
    assert(scip != NULL);
    assert(concsolvertype != NULL);
@@ -346,6 +378,8 @@ SCIP_DECL_CONCSOLVERCREATEINST(concsolverScipCreateInstance)
    SCIP_ALLOC( BMSallocMemory(&data) );
    SCIPconcsolverSetData(concsolver, data);
 
+   SCIP_CALL( SCIPgetBoolParam(scip, "concurrent/treesplit", &data->treesplit) );
+
    SCIP_CALL( initConcsolver(scip, concsolver) );
 
    /* check if emphasis setting should be loaded */
@@ -389,6 +423,14 @@ SCIP_DECL_CONCSOLVERCREATEINST(concsolverScipCreateInstance)
       SCIPfreeBufferArray(data->solverscip, &fixedparams);
    }
 
+   /* the problem was already presolved by the main SCIP; only repeat presolving in the copies if requested */
+   SCIP_CALL( SCIPgetBoolParam(scip, "concurrent/presolvebefore", &presolvebefore) );
+   SCIP_CALL( SCIPgetBoolParam(scip, "concurrent/presolvecopies", &presolvecopies) );
+   if( presolvebefore && !presolvecopies )
+   {
+      SCIP_CALL( SCIPsetPresolving(data->solverscip, SCIP_PARAMSETTING_OFF, TRUE) );
+   }
+
    /* load settings file if it exists */
    SCIP_CALL( SCIPgetStringParam(scip, "concurrent/paramsetprefix", &prefix) );
    (void) SCIPsnprintf(filename, SCIP_MAXSTRLEN, "%s%s.set", prefix, SCIPconcsolverGetName(concsolver));
@@ -431,6 +473,13 @@ SCIP_DECL_CONCSOLVERCREATEINST(concsolverScipCreateInstance)
       SCIP_CALL( setChildSelRule(concsolver) );
    }
 
+   /* use different algorithms for the initial LP if corresponding parameter is TRUE */
+   SCIP_CALL( SCIPgetBoolParam(scip, "concurrent/changelpalgo", &changelpalgo) );
+   if( changelpalgo )
+   {
+      SCIP_CALL( setInitLPAlgorithm(concsolver) );
+   }
+
    return SCIP_OKAY;
 }
 
@@ -543,6 +592,12 @@ SCIP_DECL_CONCSOLVERCOPYSOLVINGDATA(concsolverGetSolvingData)
    /* free the buffer array */
    SCIPfreeBufferArray(scip, &solvals);
 
+   /* on a split search tree, the status and dual bound of a solver are only valid for the whole problem if it is the
+    * winner, i.e., the solver with the smallest dual bound
+    */
+   if( data->treesplit && SCIPsyncstoreGetWinner(SCIPgetSyncstore(scip)) != SCIPconcsolverGetIdx(concsolver) )
+      return SCIP_OKAY;
+
    /* copy solving statistics and status from the solver SCIP to the given SCIP */
    SCIP_CALL( SCIPcopyConcurrentSolvingStats(data->solverscip, scip) );
 
@@ -562,6 +617,32 @@ SCIP_DECL_CONCSOLVEREXEC(concsolverScipExec)
    data = SCIPconcsolverGetData(concsolver);
    assert(data != NULL);
 
+   /* restrict the solver to its part of a split search tree before the problem is transformed */
+   if( SCIPgetStage(data->solverscip) == SCIP_STAGE_PROBLEM )
+   {
+      SCIP_BOUNDTYPE* bndtypes;
+      SCIP_Real* bnds;
+      int* varidxs;
+      int nbnds;
+      int i;
+
+      SCIPconcsolverGetSplitBounds(concsolver, &varidxs, &bndtypes, &bnds, &nbnds);
+
+      for( i = 0; i < nbnds; ++i )
+      {
+         assert(varidxs[i] >= 0 && varidxs[i] < data->nvars);
+
+         if( bndtypes[i] == SCIP_BOUNDTYPE_LOWER )
+         {
+            SCIP_CALL( SCIPchgVarLb(data->solverscip, data->vars[varidxs[i]], bnds[i]) );
+         }
+         else
+         {
+            SCIP_CALL( SCIPchgVarUb(data->solverscip, data->vars[varidxs[i]], bnds[i]) );
+         }
+      }
+   }
+
    /* print info message that solving has started */
    SCIPinfoMessage(data->solverscip, NULL, "starting solve in concurrent solver '%s'\n", SCIPconcsolverGetName(concsolver));
 
@@ -613,9 +694,30 @@ SCIP_DECL_CONCSOLVERSYNCWRITE(concsolverScipSyncWrite)
    concsolverid = SCIPconcsolverGetIdx(concsolver);
    solverstatus = SCIPgetStatus(data->solverscip);
 
-   SCIPsyncdataSetStatus(syncdata, solverstatus, concsolverid);
-   SCIPsyncdataSetLowerbound(syncdata, SCIPgetDualbound(data->solverscip));
-   SCIPsyncdataSetUpperbound(syncdata, SCIPgetPrimalbound(data->solverscip));
+   if( data->treesplit )
+   {
+      SCIP_Real upperbound;
+      SCIP_Bool finished;
+
+      /* a solver that has solved its part of the tree is finished, any other final status ends the whole solve; the
+       * primal bound might be an objective limit received from the other solvers, so only solutions count here
+       */
+      finished = (solverstatus == SCIP_STATUS_OPTIMAL || solverstatus == SCIP_STATUS_INFEASIBLE);
+      upperbound = SCIPgetNSols(data->solverscip) > 0 ? SCIPgetSolOrigObj(data->solverscip, SCIPgetBestSol(data->solverscip))
+         : SCIPinfinity(data->solverscip);
+
+      if( solverstatus != SCIP_STATUS_UNKNOWN && !finished )
+         SCIPsyncdataSetStatus(syncdata, solverstatus, concsolverid);
+
+      SCIPsyncdataSetSubtreeBounds(syncdata, SCIPgetDualbound(data->solverscip), upperbound, finished, concsolverid);
+      SCIPsyncdataSetUpperbound(syncdata, upperbound);
+   }
+   else
+   {
+      SCIPsyncdataSetStatus(syncdata, solverstatus, concsolverid);
+      SCIPsyncdataSetLowerbound(syncdata, SCIPgetDualbound(data->solverscip));
+      SCIPsyncdataSetUpperbound(syncdata, SCIPgetPrimalbound(data->solverscip));
+   }
 
    *nsolsshared = 0;
 
@@ -686,6 +788,28 @@ SCIP_DECL_CONCSOLVERSYNCREAD(concsolverScipSyncRead)
 
    concsolverid = SCIPconcsolverGetIdx(concsolver);
 
+   /* on a split search tree, the solutions of the other solvers violate the bounds of this solver's part, so only the
+    * best objective value is used as objective limit
+    */
+   if( data->treesplit )
+   {
+      SCIP_Real upperbound;
+
+      *nsolsrecvd = 0;
+      *ntighterbnds = 0;
+      *ntighterintbnds = 0;
+
+      upperbound = SCIPsyncdataGetUpperbound(syncdata);
+
+      if( !SCIPisInfinity(data->solverscip, upperbound) && SCIPgetStage(data->solverscip) >= SCIP_STAGE_TRANSFORMED
+         && SCIPisLT(data->solverscip, upperbound, SCIPgetPrimalbound(data->solverscip)) )
+      {
+         SCIP_CALL( SCIPaddConcurrentObjlimit(data->solverscip, upperbound) );
+      }
+
+      return SCIP_OKAY;
+   }
+
    /* get solutions from synchronization data */
    SCIPsyncdataGetSolutions(syncdata, &solvals, &concsolverids, &nsols);
    *nsolsrecvd = 0;
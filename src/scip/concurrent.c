@@ -383,6 +383,22 @@ SCIP_RETCODE SCIPaddConcurrentSol(
    return SCIP_OKAY;
 }
 
+/** pass an objective limit to the given SCIP instance that was received via synchronization by using the sync
+ *  heuristic
+ */
+SCIP_RETCODE SCIPaddConcurrentObjlimit(
+   SCIP*                 scip,               /**< SCIP datastructure */
+   SCIP_Real             objlimit            /**< objective limit in the original objective space of the given SCIP */
+   )
+{
+   assert(scip != NULL);
+   assert(scip->concurrent != NULL);
+
+   SCIP_CALL( SCIPheurSyncPassObjlimit(scip, scip->concurrent->heursync, objlimit) );
+
+   return SCIP_OKAY;
+}
+
 /** adds a global boundchange to the given SCIP, by passing it to the sync propagator */
 SCIP_RETCODE SCIPaddConcurrentBndchg(
    SCIP*                 scip,               /**< SCIP data structure */
@@ -462,20 +478,179 @@ SCIP_BOUNDSTORE* SCIPgetConcurrentGlobalBoundChanges(
    return NULL;
 }
 
-/** executes the concurrent solver corresponding to the current thread */
+/** data of the job executing a concurrent solver */
+struct SCIP_ConcsolverJob
+{
+   SCIP*                 scip;               /**< SCIP data structure */
+   SCIP_CONCSOLVER*      concsolver;         /**< the concurrent solver to execute */
+};
+typedef struct SCIP_ConcsolverJob SCIP_CONCSOLVERJOB;
+
+/** executes a concurrent solver
+ *
+ *  The solver is passed with the job instead of being looked up by the number of the executing thread, since the
+ *  threads of the task processing interface are shared with other parallel steps and may outnumber the solvers.
+ */
 static
 SCIP_RETCODE execConcsolver(
-   void*                 args                /**< SCIP data structure passed in as a void pointer */
+   void*                 args                /**< concurrent solver job data passed in as a void pointer */
    )
 {
+   SCIP_CONCSOLVERJOB* jobdata;
+   SCIP_CONCSOLVER* concsolver;
    SCIP* scip;
 
    assert(args != NULL);
 
-   scip = (SCIP*) args;
+   jobdata = (SCIP_CONCSOLVERJOB*) args;
+   scip = jobdata->scip;
+   concsolver = jobdata->concsolver;
+
+   SCIP_CALL( SCIPconcsolverExec(concsolver) );
+   SCIP_CALL( SCIPconcsolverSync(concsolver, scip->set) );
+
+   /* on a split search tree, a solver that has finished its part keeps taking part in the synchronization until all
+    * parts are finished, since a synchronization is only complete once all solvers have written to it; in between, it
+    * blocks until the other solvers have completed its last synchronization instead of running ahead of them
+    */
+   if( scip->set->concurrent_treesplit )
+   {
+      SCIP_SYNCSTORE* syncstore;
+
+      syncstore = SCIPgetSyncstore(scip);
+
+      while( !SCIPsyncstoreSolveIsStopped(syncstore) )
+      {
+         SCIP_CALL( SCIPsyncstoreWaitSync(syncstore, SCIPconcsolverGetNSyncs(concsolver) - 1) );
+
+         if( SCIPsyncstoreSolveIsStopped(syncstore) )
+            break;
+
+         SCIP_CALL( SCIPconcsolverSync(concsolver, scip->set) );
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** splits the search tree among the concurrent solvers
+ *
+ *  The solvers are recursively divided into two groups, and the domain of one variable per level is halved between
+ *  them, until each group consists of a single solver. The split variables are the integer variables with the largest
+ *  number of locks in the presolved problem, so the split only depends on the problem and the number of solvers.
+ */
+static
+SCIP_RETCODE splitConcurrentTree(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   SCIP_CONCSOLVER** concsolvers;
+   SCIP_BOUNDTYPE* bndtypes;
+   SCIP_VAR** vars;
+   SCIP_Real* scores;
+   SCIP_Real* bnds;
+   int* varidxs;
+   int* cands;
+   int nconcsolvers;
+   int nlevels;
+   int ncands;
+   int nvars;
+   int i;
+
+   assert(scip != NULL);
+
+   concsolvers = scip->set->concsolvers;
+   nconcsolvers = scip->set->nconcsolvers;
+   vars = SCIPgetVars(scip);
+   nvars = SCIPgetNVars(scip);
+
+   nlevels = 0;
+   while( (1 << nlevels) < nconcsolvers )
+      ++nlevels;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &cands, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &scores, nvars) );
+
+   /* collect the unfixed integer variables with finite bounds and sort them by their number of locks */
+   ncands = 0;
+   for( i = 0; i < nvars; ++i )
+   {
+      SCIP_VAR* var = vars[i];
+
+      if( SCIPvarGetType(var) > SCIP_VARTYPE_INTEGER || SCIPisInfinity(scip, -SCIPvarGetLbGlobal(var))
+         || SCIPisInfinity(scip, SCIPvarGetUbGlobal(var)) || SCIPvarGetUbGlobal(var) - SCIPvarGetLbGlobal(var) < 0.5 )
+         continue;
+
+      assert(SCIPvarGetProbindex(var) == i);
+
+      cands[ncands] = i;
+      scores[ncands] = (SCIP_Real) SCIPvarGetNLocksDownType(var, SCIP_LOCKTYPE_MODEL)
+         + (SCIP_Real) SCIPvarGetNLocksUpType(var, SCIP_LOCKTYPE_MODEL);
+      ++ncands;
+   }
+
+   SCIPsortDownRealInt(scores, cands, ncands);
+   nlevels = MIN(nlevels, ncands);
+
+   if( nlevels == 0 )
+   {
+      SCIPwarningMessage(scip, "no variable to split the search tree on, concurrent solvers work on the whole tree\n");
+
+      SCIPfreeBufferArray(scip, &scores);
+      SCIPfreeBufferArray(scip, &cands);
+
+      return SCIP_OKAY;
+   }
+
+   SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL, "splitting search tree among %d concurrent solvers on %d variables\n",
+      nconcsolvers, nlevels);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &varidxs, nlevels) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &bndtypes, nlevels) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &bnds, nlevels) );
+
+   for( i = 0; i < nconcsolvers; ++i )
+   {
+      int first = 0;
+      int last = nconcsolvers;
+      int nbnds = 0;
+      int d;
+
+      /* if the solvers cannot be separated completely, several solvers race on the same part of the tree */
+      for( d = 0; d < nlevels && last - first > 1; ++d )
+      {
+         SCIP_VAR* var;
+         SCIP_Real split;
+         int mid;
+
+         var = vars[cands[d]];
+         split = SCIPfloor(scip, (SCIPvarGetLbGlobal(var) + SCIPvarGetUbGlobal(var)) / 2.0);
+         mid = first + (last - first + 1) / 2;
+
+         varidxs[nbnds] = cands[d];
+         if( i < mid )
+         {
+            bndtypes[nbnds] = SCIP_BOUNDTYPE_UPPER;
+            bnds[nbnds] = split;
+            last = mid;
+         }
+         else
+         {
+            bndtypes[nbnds] = SCIP_BOUNDTYPE_LOWER;
+            bnds[nbnds] = split + 1.0;
+            first = mid;
+         }
+         ++nbnds;
+      }
+
+      SCIP_CALL( SCIPconcsolverSetSplitBounds(concsolvers[i], varidxs, bndtypes, bnds, nbnds) );
+   }
 
-   SCIP_CALL( SCIPconcsolverExec(scip->set->concsolvers[SCIPtpiGetThreadNum()]) );
-   SCIP_CALL( SCIPconcsolverSync(scip->set->concsolvers[SCIPtpiGetThreadNum()], scip->set) );
+   SCIPfreeBufferArray(scip, &bnds);
+   SCIPfreeBufferArray(scip, &bndtypes);
+   SCIPfreeBufferArray(scip, &varidxs);
+   SCIPfreeBufferArray(scip, &scores);
+   SCIPfreeBufferArray(scip, &cands);
 
    return SCIP_OKAY;
 }
@@ -486,6 +661,7 @@ SCIP_RETCODE SCIPconcurrentSolve(
    )
 {
    SCIP_SYNCSTORE*   syncstore;
+   SCIP_CONCSOLVERJOB* jobdata;
    int               idx;
    int               jobid;
    int               i;
@@ -503,6 +679,14 @@ SCIP_RETCODE SCIPconcurrentSolve(
    assert(SCIPsyncstoreGetNSolvers(syncstore) == nconcsolvers);
 
    SCIPsyncstoreSetSolveIsStopped(syncstore, FALSE);
+
+   if( scip->set->concurrent_treesplit )
+   {
+      SCIP_CALL( splitConcurrentTree(scip) );
+   }
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &jobdata, nconcsolvers) );
+
    jobid = SCIPtpiGetNewJobID();
 
    TPI_PARA
@@ -515,7 +699,10 @@ SCIP_RETCODE SCIPconcurrentSolve(
             SCIP_JOB*         job;
             SCIP_SUBMITSTATUS status;
 
-            SCIP_CALL_ABORT( SCIPtpiCreateJob(&job, jobid, execConcsolver, scip) );
+            jobdata[i].scip = scip;
+            jobdata[i].concsolver = concsolvers[i];
+
+            SCIP_CALL_ABORT( SCIPtpiCreateJob(&job, jobid, execConcsolver, (void*) &jobdata[i]) );
             SCIP_CALL_ABORT( SCIPtpiSubmitJob(job, &status) );
 
             assert(status == SCIP_SUBMIT_SUCCESS);
@@ -524,6 +711,9 @@ SCIP_RETCODE SCIPconcurrentSolve(
    }
 
    retcode = SCIPtpiCollectJobs(jobid);
+
+   SCIPfreeBufferArray(scip, &jobdata);
+
    idx = SCIPsyncstoreGetWinner(syncstore);
    assert(idx >= 0 && idx < nconcsolvers);
 
@@ -531,6 +721,18 @@ SCIP_RETCODE SCIPconcurrentSolve(
    if( idx < 0 || idx >= nconcsolvers )
       idx = 0;
 
+   /* on a split search tree, every solver contributes its solutions, but only the winner its solving statistics */
+   if( scip->set->concurrent_treesplit )
+   {
+      for( i = 0; i < nconcsolvers; ++i )
+      {
+         if( i != idx )
+         {
+            SCIP_CALL( SCIPconcsolverGetSolvingData(concsolvers[i], scip) );
+         }
+      }
+   }
+
    SCIP_CALL( SCIPconcsolverGetSolvingData(concsolvers[idx], scip) );
 
    return retcode;
@@ -91,6 +91,14 @@ SCIP_RETCODE SCIPaddConcurrentSol(
    SCIP_SOL*             sol                 /**< solution */
    );
 
+/** pass an objective limit to the given SCIP instance that was received via synchronization by using the sync
+ *  heuristic
+ */
+SCIP_RETCODE SCIPaddConcurrentObjlimit(
+   SCIP*                 scip,               /**< SCIP datastructure */
+   SCIP_Real             objlimit            /**< objective limit in the original objective space of the given SCIP */
+   );
+
 /** adds a global boundchange to the given SCIP, by passing it to the sync propagator */
 SCIP_RETCODE SCIPaddConcurrentBndchg(
    SCIP*                 scip,               /**< SCIP data structure */
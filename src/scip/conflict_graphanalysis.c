@@ -1617,10 +1617,11 @@ SCIP_RETCODE conflictEnsureTmpbdchginfosMem(
    return SCIP_OKAY;
 }
 
-/** creates a temporary bound change information object that is destroyed after the conflict sets are flushed */
+/** creates a temporary bound change information object that is destroyed after the conflict sets are flushed; the
+ *  object itself lives in node memory, which is freed at once when the focus node changes
+ */
 SCIP_RETCODE conflictCreateTmpBdchginfo(
    SCIP_CONFLICT*        conflict,           /**< conflict analysis data */
-   BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_VAR*             var,                /**< active variable that changed the bounds */
    SCIP_BOUNDTYPE        boundtype,          /**< type of bound for var: lower or upper bound */
@@ -1632,7 +1633,7 @@ SCIP_RETCODE conflictCreateTmpBdchginfo(
    assert(conflict != NULL);
 
    SCIP_CALL( conflictEnsureTmpbdchginfosMem(conflict, set, conflict->ntmpbdchginfos+1) );
-   SCIP_CALL( SCIPbdchginfoCreate(&conflict->tmpbdchginfos[conflict->ntmpbdchginfos], blkmem,
+   SCIP_CALL( SCIPbdchginfoCreate(&conflict->tmpbdchginfos[conflict->ntmpbdchginfos], set->nodemem,
          var, boundtype, oldbound, newbound) );
    *bdchginfo = conflict->tmpbdchginfos[conflict->ntmpbdchginfos];
    conflict->ntmpbdchginfos++;
@@ -1640,19 +1641,14 @@ SCIP_RETCODE conflictCreateTmpBdchginfo(
    return SCIP_OKAY;
 }
 
-/** frees all temporarily created bound change information data */
+/** frees all temporarily created bound change information data; their memory is released with the node memory */
 static
 void conflictFreeTmpBdchginfos(
-   SCIP_CONFLICT*        conflict,           /**< conflict analysis data */
-   BMS_BLKMEM*           blkmem              /**< block memory */
+   SCIP_CONFLICT*        conflict            /**< conflict analysis data */
    )
 {
-   int i;
-
    assert(conflict != NULL);
 
-   for( i = 0; i < conflict->ntmpbdchginfos; ++i )
-      SCIPbdchginfoFree(&conflict->tmpbdchginfos[i], blkmem);
    conflict->ntmpbdchginfos = 0;
 }
 
@@ -2116,7 +2112,7 @@ SCIP_RETCODE SCIPconflictFlushConss(
    }
 
    /* free all temporarily created bound change information data */
-   conflictFreeTmpBdchginfos(conflict, blkmem);
+   conflictFreeTmpBdchginfos(conflict);
 
    return SCIP_OKAY;
 }
@@ -2583,13 +2579,13 @@ SCIP_RETCODE SCIPconflictAnalyzeRemainingBdchgs(
           */
          if( lbchginfoposs[v] == var->nlbchginfos )
          {
-            SCIP_CALL( conflictCreateTmpBdchginfo(conflict, blkmem, set, var, SCIP_BOUNDTYPE_LOWER,
+            SCIP_CALL( conflictCreateTmpBdchginfo(conflict, set, var, SCIP_BOUNDTYPE_LOWER,
                   SCIPvarGetLbLocal(var), SCIPvarGetLbLP(var, set), &bdchginfo) );
             relaxedbd = SCIPvarGetLbLP(var, set);
          }
          else
          {
-            SCIP_CALL( conflictCreateTmpBdchginfo(conflict, blkmem, set, var, SCIP_BOUNDTYPE_UPPER,
+            SCIP_CALL( conflictCreateTmpBdchginfo(conflict, set, var, SCIP_BOUNDTYPE_UPPER,
                   SCIPvarGetUbLocal(var), SCIPvarGetUbLP(var, set), &bdchginfo) );
             relaxedbd = SCIPvarGetUbLP(var, set);
          }
@@ -3505,7 +3501,7 @@ SCIP_RETCODE conflictCreateReconvergenceConss(
          assert(SCIPsetIsIntegral(set, oppositeuipbound));
          oppositeuipbound += (oppositeuipboundtype == SCIP_BOUNDTYPE_LOWER ? +1.0 : -1.0);
       }
-      SCIP_CALL( conflictCreateTmpBdchginfo(conflict, blkmem, set, uipvar, oppositeuipboundtype, \
+      SCIP_CALL( conflictCreateTmpBdchginfo(conflict, set, uipvar, oppositeuipboundtype, \
             oppositeuipboundtype == SCIP_BOUNDTYPE_LOWER ? SCIP_REAL_MIN : SCIP_REAL_MAX, oppositeuipbound, &oppositeuip) );
 
       /* put the negated UIP into the conflict set */
@@ -279,10 +279,11 @@ SCIP_Bool SCIPconflictApplicable(
    SCIP_SET*             set                 /**< global SCIP settings */
    );
 
-/** creates a temporary bound change information object that is destroyed after the conflict sets are flushed */
+/** creates a temporary bound change information object that is destroyed after the conflict sets are flushed; the
+ *  object itself lives in node memory, which is freed at once when the focus node changes
+ */
 SCIP_RETCODE conflictCreateTmpBdchginfo(
    SCIP_CONFLICT*        conflict,           /**< conflict analysis data */
-   BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_VAR*             var,                /**< active variable that changed the bounds */
    SCIP_BOUNDTYPE        boundtype,          /**< type of bound for var: lower or upper bound */
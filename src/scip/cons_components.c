@@ -45,6 +45,7 @@
 #include "scip/pub_sol.h"
 #include "scip/pub_tree.h"
 #include "scip/pub_var.h"
+#include "scip/scip_concurrent.h"
 #include "scip/scip_cons.h"
 #include "scip/scip_copy.h"
 #include "scip/scip_datastructures.h"
@@ -63,6 +64,7 @@
 #include "scip/scip_timing.h"
 #include "scip/scip_tree.h"
 #include "scip/scip_var.h"
+#include "tpi/tpi.h"
 #include <string.h>
 
 #define CONSHDLR_NAME          "components"
@@ -87,6 +89,7 @@
 #define DEFAULT_NODELIMIT       10000LL      /**< maximum number of nodes to be solved in subproblems during presolving */
 #define DEFAULT_INTFACTOR           1.0      /**< the weight of an integer variable compared to binary variables */
 #define DEFAULT_FEASTOLFACTOR       1.0      /**< default value for parameter to increase the feasibility tolerance in all sub-SCIPs */
+#define DEFAULT_NTHREADS              1      /**< number of threads used to solve components in parallel during presolving */
 
 /*
  * Data structures
@@ -157,8 +160,33 @@ struct SCIP_ConshdlrData
                                               *   individually during branch-and-bound */
    int                   subscipdepth;       /**< depth offset of the current (sub-)problem compared to the original
                                               *   problem */
+   int                   nthreads;           /**< number of threads used to solve components in parallel during
+                                              *   presolving (1: sequential) */
 };
 
+/** data shared by the jobs that solve components during presolving */
+typedef struct ComponentShared
+{
+   SCIP*                 scip;               /**< main SCIP */
+   SCIP_LOCK*            lock;               /**< lock protecting the node budget */
+   SCIP_Longint          nodesleft;          /**< nodes of the node budget that are not handed out (-1: no limit) */
+   int                   njobsleft;          /**< number of jobs that have not taken their share of the node budget */
+   int                   nlive;              /**< number of sub-SCIPs that are not freed yet, accessed atomically */
+   int                   stop;               /**< flag (accessed atomically) whether unsolved components are skipped */
+} COMPONENTSHARED;
+
+/** data of a job that solves a component during presolving */
+typedef struct ComponentJob
+{
+   SCIP*                 subscip;            /**< sub-SCIP of the component, or NULL if it could not be copied */
+   SCIP_VAR**            subvars;            /**< variables of the sub-SCIP corresponding to the component variables */
+   COMPONENTSHARED*      shared;             /**< data shared by all jobs */
+   SCIP_Longint          nodelimit;          /**< nodes taken from the node budget by the job */
+   int                   comp;               /**< index of the component */
+   int                   jobid;              /**< id of the job solving the component, or -1 if it was not submitted */
+   SCIP_Bool             solve;              /**< should the sub-SCIP be solved, i.e., are there enough resources left? */
+} COMPONENTJOB;
+
 
 /** comparison method for sorting components */
 static
@@ -659,13 +687,16 @@ SCIP_RETCODE componentCreateSubscip(
    return SCIP_OKAY;
 }
 
-/** solve a given sub-SCIP up to the given limits */
+/** sets the limits of a given sub-SCIP; success is FALSE if the sub-SCIP should not be solved, because there is not
+ *  enough time or memory left
+ */
 static
-SCIP_RETCODE solveSubscip(
+SCIP_RETCODE setSubscipLimits(
    SCIP*                 scip,               /**< main SCIP */
    SCIP*                 subscip,            /**< sub-SCIP to solve */
    SCIP_Longint          nodelimit,          /**< node limit */
-   SCIP_Real             gaplimit            /**< gap limit */
+   SCIP_Real             gaplimit,           /**< gap limit */
+   SCIP_Bool*            success             /**< pointer to store whether the sub-SCIP should be solved */
    )
 {
    SCIP_Real timelimit;
@@ -674,6 +705,9 @@ SCIP_RETCODE solveSubscip(
 
    assert(scip != NULL);
    assert(subscip != NULL);
+   assert(success != NULL);
+
+   *success = FALSE;
 
    /* set time limit */
    SCIP_CALL( SCIPgetRealParam(scip, "limits/time", &timelimit) );
@@ -739,6 +773,27 @@ SCIP_RETCODE solveSubscip(
    /* set node limit */
    SCIP_CALL( SCIPsetLongintParam(subscip, "limits/nodes", nodelimit) );
 
+   *success = TRUE;
+
+   return SCIP_OKAY;
+}
+
+/** solve a given sub-SCIP up to the given limits */
+static
+SCIP_RETCODE solveSubscip(
+   SCIP*                 scip,               /**< main SCIP */
+   SCIP*                 subscip,            /**< sub-SCIP to solve */
+   SCIP_Longint          nodelimit,          /**< node limit */
+   SCIP_Real             gaplimit            /**< gap limit */
+   )
+{
+   SCIP_Bool success;
+
+   SCIP_CALL( setSubscipLimits(scip, subscip, nodelimit, gaplimit, &success) );
+
+   if( !success )
+      return SCIP_OKAY;
+
    /* solve the subproblem */
    SCIP_CALL( SCIPsolve(subscip) );
 
@@ -750,12 +805,11 @@ SCIP_RETCODE solveSubscip(
    return SCIP_OKAY;
 }
 
-/** solve a connected component during presolving and evaluate the result */
+/** evaluate the result of solving a connected component during presolving */
 static
-SCIP_RETCODE solveAndEvalSubscip(
+SCIP_RETCODE evalSubscip(
    SCIP*                 scip,               /**< SCIP main data structure */
-   SCIP_CONSHDLRDATA*    conshdlrdata,       /**< the components constraint handler data */
-   SCIP*                 subscip,            /**< sub-SCIP to be solved */
+   SCIP*                 subscip,            /**< sub-SCIP that was solved */
    SCIP_VAR**            vars,               /**< array of variables copied to this component */
    SCIP_VAR**            subvars,            /**< array of sub-SCIP variables corresponding to the vars array */
    SCIP_CONS**           conss,              /**< array of constraints copied to this component */
@@ -771,7 +825,6 @@ SCIP_RETCODE solveAndEvalSubscip(
    int i;
 
    assert(scip != NULL);
-   assert(conshdlrdata != NULL);
    assert(subscip != NULL);
    assert(vars != NULL);
    assert(conss != NULL);
@@ -782,8 +835,6 @@ SCIP_RETCODE solveAndEvalSubscip(
 
    *solved  = FALSE;
 
-   SCIP_CALL( solveSubscip(scip, subscip, conshdlrdata->nodelimit, 0.0) );
-
    if( SCIPgetStatus(subscip) == SCIP_STATUS_OPTIMAL )
    {
       SCIP_SOL* sol;
@@ -1007,6 +1058,414 @@ SCIP_RETCODE solveAndEvalSubscip(
    return SCIP_OKAY;
 }
 
+/** solve a connected component during presolving and evaluate the result */
+static
+SCIP_RETCODE solveAndEvalSubscip(
+   SCIP*                 scip,               /**< SCIP main data structure */
+   SCIP_CONSHDLRDATA*    conshdlrdata,       /**< the components constraint handler data */
+   SCIP*                 subscip,            /**< sub-SCIP to be solved */
+   SCIP_VAR**            vars,               /**< array of variables copied to this component */
+   SCIP_VAR**            subvars,            /**< array of sub-SCIP variables corresponding to the vars array */
+   SCIP_CONS**           conss,              /**< array of constraints copied to this component */
+   int                   nvars,              /**< number of variables copied to this component */
+   int                   nconss,             /**< number of constraints copied to this component */
+   int*                  ndeletedconss,      /**< pointer to store the number of deleted constraints */
+   int*                  nfixedvars,         /**< pointer to store the number of fixed variables */
+   int*                  ntightenedbounds,   /**< pointer to store the number of bound tightenings */
+   SCIP_RESULT*          result,             /**< pointer to store the result of the component solving */
+   SCIP_Bool*            solved              /**< pointer to store if the problem was solved to optimality */
+   )
+{
+   assert(conshdlrdata != NULL);
+
+   SCIP_CALL( solveSubscip(scip, subscip, conshdlrdata->nodelimit, 0.0) );
+
+   SCIP_CALL( evalSubscip(scip, subscip, vars, subvars, conss, nvars, nconss, ndeletedconss, nfixedvars,
+         ntightenedbounds, result, solved) );
+
+   return SCIP_OKAY;
+}
+
+/** sets the limits of a sub-SCIP when its job starts
+ *
+ *  The time limit is computed from the time that is left in the main SCIP at this point, such that components that
+ *  wait for a free thread do not start with the time that was left when they were submitted. The memory that is left
+ *  is divided by the number of sub-SCIPs that still exist, and the job takes its share of the node budget that is left.
+ */
+static
+SCIP_RETCODE componentJobSetLimits(
+   COMPONENTJOB*         job,                /**< the component job */
+   SCIP_Bool*            success             /**< pointer to store whether the sub-SCIP should be solved */
+   )
+{
+   COMPONENTSHARED* shared;
+   SCIP* scip;
+   SCIP_Real timelimit;
+   SCIP_Real memorylimit;
+   int nlive;
+
+   assert(job != NULL);
+   assert(job->subscip != NULL);
+   assert(success != NULL);
+
+   shared = job->shared;
+   scip = shared->scip;
+
+   *success = FALSE;
+
+   SCIP_CALL( SCIPgetRealParam(scip, "limits/time", &timelimit) );
+   if( !SCIPisInfinity(scip, timelimit) )
+   {
+      timelimit -= SCIPgetSolvingTime(scip);
+      timelimit += SCIPgetSolvingTime(job->subscip);
+
+      if( timelimit <= 0.0 )
+      {
+         SCIPdebugMessage("--> component %d not solved (not enough time left)\n", job->comp);
+         return SCIP_OKAY;
+      }
+
+      SCIP_CALL( SCIPsetRealParam(job->subscip, "limits/time", timelimit) );
+   }
+
+   if( SCIPgetParam(scip, "limits/softtime") != NULL )
+   {
+      SCIP_Real softtimelimit;
+
+      SCIP_CALL( SCIPgetRealParam(scip, "limits/softtime", &softtimelimit) );
+      if( softtimelimit > -0.5 )
+      {
+         softtimelimit -= SCIPgetSolvingTime(scip);
+         softtimelimit += SCIPgetSolvingTime(job->subscip);
+         softtimelimit = MAX(softtimelimit, 0.0);
+
+         SCIP_CALL( SCIPsetRealParam(job->subscip, "limits/softtime", softtimelimit) );
+      }
+   }
+
+   /* the memory limit was set to the memory left in the main SCIP when the sub-SCIP was created */
+   SCIP_CALL( SCIPgetRealParam(job->subscip, "limits/memory", &memorylimit) );
+   nlive = SCIPtpiAtomicLoadInt(&shared->nlive);
+   if( !SCIPisInfinity(scip, memorylimit) && nlive > 1 )
+   {
+      SCIP_CALL( SCIPsetRealParam(job->subscip, "limits/memory", memorylimit / nlive) );
+   }
+
+   SCIP_CALL( SCIPtpiAcquireLock(shared->lock) );
+   assert(shared->njobsleft > 0);
+   job->nodelimit = shared->nodesleft < 0 ? -1LL : shared->nodesleft / shared->njobsleft;
+   if( shared->nodesleft >= 0 )
+      shared->nodesleft -= job->nodelimit;
+   --shared->njobsleft;
+   SCIP_CALL( SCIPtpiReleaseLock(shared->lock) );
+
+   SCIP_CALL( SCIPsetLongintParam(job->subscip, "limits/nodes", job->nodelimit) );
+
+   *success = TRUE;
+
+   return SCIP_OKAY;
+}
+
+/** execution method of a job that solves a component during presolving */
+static
+SCIP_RETCODE componentJobExec(
+   void*                 args                /**< the component job */
+   )
+{
+   COMPONENTJOB* job;
+   COMPONENTSHARED* shared;
+   SCIP_Bool success;
+
+   job = (COMPONENTJOB*) args;
+   assert(job != NULL);
+
+   shared = job->shared;
+
+   /* skip the component if the result of another component already decided the problem */
+   if( job->subscip == NULL || !job->solve || SCIPtpiAtomicLoadInt(&shared->stop) != 0 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( componentJobSetLimits(job, &success) );
+
+   if( !success )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPsolve(job->subscip) );
+
+   /* return the nodes that were not needed to the budget of the components that did not start yet */
+   if( job->nodelimit >= 0 && SCIPgetNNodes(job->subscip) < job->nodelimit )
+   {
+      SCIP_CALL( SCIPtpiAcquireLock(shared->lock) );
+      shared->nodesleft += job->nodelimit - SCIPgetNNodes(job->subscip);
+      SCIP_CALL( SCIPtpiReleaseLock(shared->lock) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** submits the job of a component to the TPI */
+static
+SCIP_RETCODE componentJobSubmit(
+   COMPONENTJOB*         job                 /**< the component job */
+   )
+{
+   SCIP_SUBMITSTATUS status;
+   SCIP_JOB* tpijob;
+   int jobid;
+
+   assert(job != NULL);
+   assert(job->jobid == -1);
+
+   jobid = SCIPtpiGetNewJobID();
+   SCIP_CALL( SCIPtpiCreateJob(&tpijob, jobid, componentJobExec, (void*) job) );
+   SCIP_CALL( SCIPtpiSubmitJob(tpijob, &status) );
+
+   if( status != SCIP_SUBMIT_SUCCESS )
+      return SCIP_ERROR;
+
+   job->jobid = jobid;
+
+   return SCIP_OKAY;
+}
+
+/** frees the sub-SCIP of a component job */
+static
+SCIP_RETCODE componentJobFree(
+   SCIP*                 scip,               /**< SCIP main data structure */
+   COMPONENTJOB*         job,                /**< the component job */
+   int*                  compstartsvars      /**< start positions of the components in the sortedvars array */
+   )
+{
+   assert(job != NULL);
+
+   if( job->subscip == NULL )
+      return SCIP_OKAY;
+
+   SCIPfreeBlockMemoryArray(scip, &job->subvars, compstartsvars[job->comp + 1] - compstartsvars[job->comp]);
+   SCIP_CALL( SCIPfree(&job->subscip) );
+
+   (void) SCIPtpiAtomicFetchAddInt(&job->shared->nlive, -1);
+
+   return SCIP_OKAY;
+}
+
+/** solves the small components found during presolving in parallel and evaluates the results
+ *
+ *  All sub-SCIPs are created and copied first, since this modifies the main SCIP. Then they are solved by the TPI, with
+ *  the largest components submitted first to shorten the makespan; the limits of each sub-SCIP are set when its job
+ *  starts. The results are evaluated in the order of the components as soon as the corresponding job is finished, such
+ *  that the reductions do not depend on the timing of the threads. As in the sequential solve, the last component is
+ *  left to the main SCIP if all other components are solved to optimality, so its job is only submitted once this is
+ *  known.
+ */
+static
+SCIP_RETCODE solveComponentsParallel(
+   SCIP*                 scip,               /**< SCIP main data structure */
+   SCIP_CONSHDLRDATA*    conshdlrdata,       /**< the components constraint handler data */
+   SCIP_VAR**            sortedvars,         /**< variables sorted by components */
+   SCIP_CONS**           sortedconss,        /**< constraints sorted by components */
+   int*                  compstartsvars,     /**< start positions of the components in the sortedvars array */
+   int*                  compstartsconss,    /**< start positions of the components in the sortedconss array */
+   int                   nsortedconss,       /**< number of sorted constraints */
+   int                   ncomponents,        /**< number of components */
+   int                   ncompsmaxsize,      /**< number of (small) components that should be solved */
+   int*                  ndeletedconss,      /**< pointer to store the number of deleted constraints */
+   int*                  nfixedvars,         /**< pointer to store the number of fixed variables */
+   int*                  ntightenedbounds,   /**< pointer to store the number of bound tightenings */
+   SCIP_RESULT*          result              /**< pointer to store the result of the component solving */
+   )
+{
+   char name[SCIP_MAXSTRLEN];
+   COMPONENTSHARED shared;
+   COMPONENTJOB* jobs;
+   SCIP_HASHMAP* consmap;
+   SCIP_RETCODE retcode;
+   int* sizes;
+   int* order;
+   int maxnthreads;
+   int nthreads;
+   int nsubmit;
+   int njobs;
+   int nsolved;
+   int i;
+
+   assert(scip != NULL);
+   assert(conshdlrdata != NULL);
+   assert(result != NULL);
+   assert(ncompsmaxsize > 0);
+
+   /* count the components to solve; components without constraints are left to duality fixing */
+   njobs = 0;
+   for( i = 0; i < ncompsmaxsize; ++i )
+   {
+      if( compstartsconss[i + 1] == compstartsconss[i] )
+      {
+         assert(compstartsvars[i + 1] - compstartsvars[i] == 1);
+         continue;
+      }
+
+      ++njobs;
+   }
+
+   if( njobs == 0 )
+      return SCIP_OKAY;
+
+   /* if all components would be solved, the last one is held back, since it is left to the main SCIP if the others
+    * are solved to optimality
+    */
+   nsubmit = (njobs == ncomponents ? njobs - 1 : njobs);
+
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &jobs, njobs) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &sizes, njobs) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &order, njobs) );
+
+   /* hashmap mapping from original constraints to constraints in the sub-SCIPs (for performance reasons) */
+   SCIP_CALL( SCIPhashmapCreate(&consmap, SCIPblkmem(scip), nsortedconss) );
+
+   SCIP_CALL( SCIPgetIntParam(scip, "parallel/maxnthreads", &maxnthreads) );
+   nthreads = MIN3(conshdlrdata->nthreads, maxnthreads, njobs);
+
+   shared.scip = scip;
+   shared.lock = NULL;
+   shared.njobsleft = njobs;
+   shared.nlive = 0;
+   shared.stop = 0;
+
+   /* the components share a budget of the node limit per component */
+   if( conshdlrdata->nodelimit < 0 )
+      shared.nodesleft = -1LL;
+   else if( conshdlrdata->nodelimit > SCIP_LONGINT_MAX / njobs )
+      shared.nodesleft = SCIP_LONGINT_MAX;
+   else
+      shared.nodesleft = conshdlrdata->nodelimit * njobs;
+
+   /* create the sub-SCIPs in the order of the components; this modifies the main SCIP and is done sequentially */
+   njobs = 0;
+   for( i = 0; i < ncompsmaxsize; ++i )
+   {
+      COMPONENTJOB* job;
+      SCIP_HASHMAP* varmap;
+      SCIP_Bool success;
+      int ncompvars;
+
+      if( compstartsconss[i + 1] == compstartsconss[i] )
+         continue;
+
+      ncompvars = compstartsvars[i + 1] - compstartsvars[i];
+
+      job = &jobs[njobs];
+      job->subscip = NULL;
+      job->subvars = NULL;
+      job->shared = &shared;
+      job->nodelimit = -1LL;
+      job->comp = i;
+      job->jobid = -1;
+      job->solve = FALSE;
+
+      order[njobs] = njobs;
+      sizes[njobs] = ncompvars;
+      ++njobs;
+
+      if( SCIPisStopped(scip) )
+         continue;
+
+      SCIP_CALL( createSubscip(scip, conshdlrdata, &job->subscip) );
+
+      if( job->subscip == NULL )
+         continue;
+
+      SCIP_CALL( SCIPsetBoolParam(job->subscip, "misc/usesmalltables", TRUE) );
+      SCIP_CALL( SCIPsetIntParam(job->subscip, "constraints/" CONSHDLR_NAME "/propfreq", -1) );
+
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &job->subvars, ncompvars) );
+      SCIP_CALL( SCIPhashmapCreate(&varmap, SCIPblkmem(scip), ncompvars) );
+
+      /* get name of the original problem and add "comp_nr" */
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "%s_comp_%d", SCIPgetProbName(scip), i);
+
+      SCIP_CALL( copyToSubscip(scip, job->subscip, name, &sortedvars[compstartsvars[i]], job->subvars,
+            &sortedconss[compstartsconss[i]], varmap, consmap, ncompvars,
+            compstartsconss[i + 1] - compstartsconss[i], &success) );
+
+      SCIPhashmapFree(&varmap);
+
+      ++shared.nlive;
+
+      if( !success )
+      {
+         SCIP_CALL( componentJobFree(scip, job, compstartsvars) );
+         continue;
+      }
+
+      /* check whether there are enough resources left; the time and node limits are set again when the job starts */
+      SCIP_CALL( setSubscipLimits(scip, job->subscip, conshdlrdata->nodelimit, 0.0, &job->solve) );
+   }
+
+   /* submit the largest components first */
+   SCIPsortDownIntInt(sizes, order, nsubmit);
+
+   SCIP_CALL( SCIPtpiInitLock(&shared.lock) );
+   SCIP_CALL( SCIPinitTpi(scip, nthreads) );
+
+   retcode = SCIP_OKAY;
+   for( i = 0; i < nsubmit && retcode == SCIP_OKAY; ++i )
+   {
+      if( jobs[order[i]].solve )
+         retcode = componentJobSubmit(&jobs[order[i]]);
+   }
+
+   /* evaluate the components in their order; all submitted jobs are collected, even after an error */
+   nsolved = 0;
+   for( i = 0; i < njobs; ++i )
+   {
+      SCIP_Bool solved;
+      int comp;
+
+      /* the held back component is only solved if not all other components are solved to optimality */
+      if( i == nsubmit && jobs[i].solve && retcode == SCIP_OKAY && shared.stop == 0 && nsolved < ncomponents - 1 )
+         retcode = componentJobSubmit(&jobs[i]);
+
+      if( jobs[i].jobid >= 0 )
+         retcode = MIN(retcode, SCIPtpiCollectJobs(jobs[i].jobid));
+
+      if( retcode != SCIP_OKAY || shared.stop != 0 || jobs[i].jobid < 0 )
+         continue;
+
+      comp = jobs[i].comp;
+
+      retcode = evalSubscip(scip, jobs[i].subscip, &sortedvars[compstartsvars[comp]], jobs[i].subvars,
+            &sortedconss[compstartsconss[comp]], compstartsvars[comp + 1] - compstartsvars[comp],
+            compstartsconss[comp + 1] - compstartsconss[comp], ndeletedconss, nfixedvars, ntightenedbounds, result,
+            &solved);
+
+      if( solved )
+         ++nsolved;
+
+      /* the memory of the evaluated component is available to the components that did not start yet */
+      if( retcode == SCIP_OKAY )
+         retcode = componentJobFree(scip, &jobs[i], compstartsvars);
+
+      /* if the component is unbounded or infeasible, this holds for the complete problem as well */
+      if( retcode == SCIP_OKAY && (*result == SCIP_UNBOUNDED || *result == SCIP_CUTOFF) )
+         SCIPtpiAtomicStoreInt(&shared.stop, 1);
+   }
+
+   SCIPdebugMsg(scip, "solved %d of %d components with %d threads\n", nsolved, njobs, nthreads);
+
+   for( i = njobs - 1; i >= 0; --i )
+   {
+      SCIP_CALL( componentJobFree(scip, &jobs[i], compstartsvars) );
+   }
+
+   SCIPtpiDestroyLock(&shared.lock);
+   SCIPhashmapFree(&consmap);
+   SCIPfreeBufferArray(scip, &order);
+   SCIPfreeBufferArray(scip, &sizes);
+   SCIPfreeBlockMemoryArray(scip, &jobs, njobs);
+
+   return retcode;
+}
+
 /** (continues) solving a connected component */
 static
 SCIP_RETCODE solveComponent(
@@ -2343,6 +2802,17 @@ SCIP_DECL_CONSPRESOL(consPresolComponents)
    SCIP_CALL( findComponents(scip, conshdlrdata, NULL, sortedvars, sortedconss, compstartsvars,
          compstartsconss, &nsortedvars, &nsortedconss, &ncomponents, &ncompsminsize, &ncompsmaxsize) );
 
+#ifndef WITH_DEBUG_SOLUTION
+   /* the debug solution is not thread-safe, so the components are only solved in parallel without it */
+   if( ncompsmaxsize > 0 && conshdlrdata->nthreads > 1 && SCIPtpiIsAvailable() )
+   {
+      SCIPdebugMsg(scip, "found %d components (%d with small size) during presolving\n", ncomponents, ncompsmaxsize);
+
+      SCIP_CALL( solveComponentsParallel(scip, conshdlrdata, sortedvars, sortedconss, compstartsvars, compstartsconss,
+            nsortedconss, ncomponents, ncompsmaxsize, ndelconss, nfixedvars, nchgbds, result) );
+   }
+   else
+#endif
    if( ncompsmaxsize > 0 )
    {
       char name[SCIP_MAXSTRLEN];
@@ -2610,6 +3080,10 @@ SCIP_RETCODE SCIPincludeConshdlrComponents(
          "constraints/" CONSHDLR_NAME "/feastolfactor",
          "factor to increase the feasibility tolerance of the main SCIP in all sub-SCIPs, default value 1.0",
          &conshdlrdata->feastolfactor, TRUE, DEFAULT_FEASTOLFACTOR, 0.0, 1000000.0, NULL, NULL) );
+   SCIP_CALL( SCIPaddIntParam(scip,
+         "constraints/" CONSHDLR_NAME "/nthreads",
+         "number of threads used to solve components in parallel during presolving, at most parallel/maxnthreads (1: sequential)",
+         &conshdlrdata->nthreads, TRUE, DEFAULT_NTHREADS, 1, 64, NULL, NULL) );
 
    return SCIP_OKAY;
 }
@@ -318,6 +318,7 @@ extern "C" {
 
 #define SCIP_DEFAULT_MEM_ARRAYGROWFAC   1.2 /**< memory growing factor for dynamically allocated arrays */
 #define SCIP_DEFAULT_MEM_ARRAYGROWINIT    4 /**< initial size of dynamically allocated arrays */
+#define SCIP_DEFAULT_MEM_NODEBLOCKSIZE 65536 /**< initial size of the memory blocks of the node memory in bytes */
 
 #define SCIP_MEM_NOLIMIT (SCIP_Longint)(SCIP_LONGINT_MAX >> 20)/**< initial size of dynamically allocated arrays */
 
@@ -0,0 +1 @@
+#define SCIP_GITHASH "c21496b-dirty"
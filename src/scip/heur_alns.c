@@ -49,6 +49,7 @@
 #include "scip/pub_var.h"
 #include "scip/scip_bandit.h"
 #include "scip/scip_branch.h"
+#include "scip/scip_concurrent.h"
 #include "scip/scip_cons.h"
 #include "scip/scip_copy.h"
 #include "scip/scip_event.h"
@@ -69,6 +70,8 @@
 #include "scip/scip_timing.h"
 #include "scip/scip_tree.h"
 #include "scip/scip_var.h"
+#include "scip/type_syncstore.h"
+#include "tpi/tpi.h"
 #include <string.h>
 
 #if !defined(_WIN32) && !defined(_WIN64)
@@ -104,6 +107,7 @@
 #define LPLIMFAC                 4.0
 #define DEFAULT_INITDURINGROOT FALSE
 #define DEFAULT_MAXCALLSSAMESOL  -1   /**< number of allowed executions of the heuristic on the same incumbent solution */
+#define DEFAULT_NTHREADS         1    /**< number of threads to run several neighborhoods in parallel (1: sequential) */
 
 /*
  * parameters for the minimum improvement
@@ -455,6 +459,7 @@ struct SCIP_HeurData
    int                   ndelayedcalls;      /**< the number of delayed calls */
    int                   maxcallssamesol;    /**< number of allowed executions of the heuristic on the same incumbent solution
                                               *   (-1: no limit, 0: number of active neighborhoods) */
+   int                   nthreads;           /**< number of threads to run several neighborhoods in parallel (1: sequential) */
    SCIP_Longint          firstcallthissol;   /**< counter for the number of calls on this incumbent */
    char                  banditalgo;         /**< the bandit algorithm: (u)pper confidence bounds, (e)xp.3, epsilon (g)reedy */
    SCIP_Bool             useredcost;         /**< should reduced cost scores be used for variable prioritization? */
@@ -485,6 +490,10 @@ struct SCIP_EventData
    SCIP_Real             lplimfac;           /**< limit fraction of LPs per node to interrupt sub-SCIP */
    NH_STATS*             runstats;           /**< run statistics for the current neighborhood */
    SCIP_Bool             allrewardsmode;     /**< true if solutions should only be checked for reward comparisons */
+   int*                  nimprovingruns;     /**< counter of parallel runs that found an improving solution, or NULL if
+                                              *   the sub-SCIP is solved sequentially */
+   SCIP_Bool             cancellosers;       /**< should the run be interrupted once another parallel run was successful? */
+   SCIP_Bool             foundsol;           /**< did the parallel run find an improving solution? */
 };
 
 /** represents limits for the sub-SCIP solving process */
@@ -498,6 +507,21 @@ struct SolveLimits
 
 typedef struct SolveLimits SOLVELIMITS;
 
+/** a neighborhood that is solved on a worker thread */
+struct AlnsJob
+{
+   SCIP*                 subscip;            /**< sub-SCIP of the neighborhood, or NULL if no sub-SCIP is solved */
+   SCIP_VAR**            subvars;            /**< sub-SCIP variables in the order of the main SCIP, or NULL */
+   SCIP_EVENTDATA        eventdata;          /**< event handler data of the sub-SCIP */
+   NH_STATS              runstats;           /**< run statistics of the neighborhood */
+   SCIP_Real             minfixingrate;      /**< minimum fixing rate after presolving that is required to solve the sub-SCIP */
+   int                   neighborhoodidx;    /**< index of the neighborhood */
+   int                   jobid;              /**< TPI job id, or -1 if the job was not submitted */
+   SCIP_Bool             update;             /**< should the statistics and the bandit algorithm be updated for this run? */
+};
+
+typedef struct AlnsJob ALNSJOB;
+
 /** data structure that can be used for variable prioritization for additional fixings */
 struct VarPrio
 {
@@ -928,21 +952,19 @@ SCIP_RETCODE neighborhoodExit(
 static
 SCIP_RETCODE transferSolution(
    SCIP*                 subscip,            /**< SCIP data structure of the subproblem */
+   SCIP_SOL*             subsol,             /**< solution of the subproblem */
    SCIP_EVENTDATA*       eventdata           /**< event handler data */
    )
 {
    SCIP*      sourcescip;         /* original SCIP data structure */
    SCIP_VAR** subvars;            /* the variables of the subproblem */
    SCIP_HEUR* heur;               /* alns heuristic structure */
-   SCIP_SOL*  subsol;             /* solution of the subproblem */
    SCIP_SOL*  newsol;             /* solution to be created for the original problem */
    SCIP_Bool  success;
    NH_STATS*  runstats;
    SCIP_SOL*  oldbestsol;
 
    assert(subscip != NULL);
-
-   subsol = SCIPgetBestSol(subscip);
    assert(subsol != NULL);
 
    sourcescip = eventdata->sourcescip;
@@ -1016,8 +1038,21 @@ SCIP_DECL_EVENTEXEC(eventExecAlns)
    {
    case SCIP_EVENTTYPE_SOLFOUND:
    case SCIP_EVENTTYPE_BESTSOLFOUND:
+      /* in parallel mode, the main SCIP must not be touched; solutions are transferred after all runs finished, and
+       * every solution of the sub-SCIP improves the incumbent because of the objective cutoff
+       */
+      if( eventdata->nimprovingruns != NULL )
+      {
+         if( ! eventdata->foundsol )
+         {
+            eventdata->foundsol = TRUE;
+            (void) SCIPtpiAtomicFetchAddInt(eventdata->nimprovingruns, 1);
+         }
+         break;
+      }
+
       /* try to transfer the solution to the original SCIP */
-      SCIP_CALL( transferSolution(scip, eventdata) );
+      SCIP_CALL( transferSolution(scip, SCIPgetBestSol(scip), eventdata) );
       break;
    case SCIP_EVENTTYPE_LPSOLVED:
       /* interrupt solution process of sub-SCIP */
@@ -1026,6 +1061,12 @@ SCIP_DECL_EVENTEXEC(eventExecAlns)
          SCIPdebugMsg(scip, "interrupt after  %" SCIP_LONGINT_FORMAT " LPs\n", SCIPgetNLPs(scip));
          SCIP_CALL( SCIPinterruptSolve(scip) );
       }
+      /* interrupt an unsuccessful parallel run once another run found an improving solution */
+      else if( eventdata->cancellosers && ! eventdata->foundsol && SCIPtpiAtomicLoadInt(eventdata->nimprovingruns) > 0 )
+      {
+         SCIPdebugMsg(scip, "interrupt after another neighborhood found an improving solution\n");
+         SCIP_CALL( SCIPinterruptSolve(scip) );
+      }
       break;
    default:
       break;
@@ -2169,6 +2210,59 @@ SCIP_RETCODE updateBanditAlgorithm(
    return SCIP_OKAY;
 }
 
+/** updates the statistics, the fixing rate, the minimum improvement, the target node limit, and the bandit algorithm
+ *  after a neighborhood has been run
+ */
+static
+SCIP_RETCODE updateAfterRun(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_HEUR*            heur,               /**< the ALNS heuristic */
+   SCIP_HEURDATA*        heurdata,           /**< heuristic data of the ALNS neighborhood */
+   NH_STATS*             runstats,           /**< run statistics of the neighborhood */
+   SCIP_STATUS           subscipstatus,      /**< status of the sub-SCIP run */
+   SCIP_Real             reward,             /**< measured reward */
+   int                   neighborhoodidx,    /**< the neighborhood that was run */
+   SCIP_Bool             allrewardsmode      /**< is the heuristic in all rewards mode? */
+   )
+{
+   NH* neighborhood;
+
+   neighborhood = heurdata->neighborhoods[neighborhoodidx];
+
+   heurdata->usednodes += runstats->usednodes;
+
+   /* determine the success of this neighborhood, and update the target fixing rate for the next time */
+   updateNeighborhoodStats(runstats, neighborhood, subscipstatus);
+
+   /* adjust the fixing rate for this neighborhood
+    * make no adjustments in all rewards mode, because this only affects 1 of 8 heuristics
+    */
+   if( heurdata->adjustfixingrate && ! allrewardsmode )
+   {
+      SCIPdebugMsg(scip, "Update fixing rate: %.2f\n", neighborhood->fixingrate.targetfixingrate);
+      updateFixingRate(neighborhood, subscipstatus, runstats);
+      SCIPdebugMsg(scip, "New fixing rate: %.2f\n", neighborhood->fixingrate.targetfixingrate);
+   }
+   /* similarly, update the minimum improvement for the ALNS heuristic */
+   if( heurdata->adjustminimprove )
+   {
+      SCIPdebugMsg(scip, "Update Minimum Improvement: %.4f\n", heurdata->minimprove);
+      updateMinimumImprovement(heurdata, subscipstatus, runstats);
+      SCIPdebugMsg(scip, "--> %.4f\n", heurdata->minimprove);
+   }
+
+   /* update the target node limit based on the status of the selected algorithm */
+   if( heurdata->adjusttargetnodes && SCIPheurGetNCalls(heur) >= heurdata->nactiveneighborhoods )
+   {
+      updateTargetNodeLimit(heurdata, runstats, subscipstatus);
+   }
+
+   /* update the bandit algorithm by the measured reward */
+   SCIP_CALL( updateBanditAlgorithm(scip, heurdata, reward, neighborhoodidx) );
+
+   return SCIP_OKAY;
+}
+
 /** set up the sub-SCIP parameters, objective cutoff, and solution limits */
 static
 SCIP_RETCODE setupSubScip(
@@ -2320,6 +2414,339 @@ SCIP_RETCODE setupSubScip(
    return SCIP_OKAY;
 }
 
+/** presolves and solves the sub-SCIP of a neighborhood on a worker thread */
+static
+SCIP_RETCODE alnsJobExec(
+   void*                 args                /**< the neighborhood job */
+   )
+{
+   ALNSJOB* job;
+   SCIP_Real allfixingrate;
+
+   job = (ALNSJOB*) args;
+   assert(job != NULL);
+   assert(job->subscip != NULL);
+
+   SCIP_CALL( SCIPpresolve(job->subscip) );
+
+   /* was presolving successful enough regarding fixings? otherwise, terminate */
+   allfixingrate = (SCIPgetNOrigVars(job->subscip) - SCIPgetNVars(job->subscip)) / (SCIP_Real)SCIPgetNOrigVars(job->subscip);
+   allfixingrate = MAX(allfixingrate, 0.0);
+
+   if( allfixingrate >= job->minfixingrate )
+   {
+      SCIP_CALL( SCIPsolve(job->subscip) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** runs several distinct neighborhoods in parallel
+ *
+ *  The neighborhoods are selected by repeated draws from the bandit algorithm, and their sub-SCIPs are set up
+ *  sequentially. Only presolving and solving run on the worker threads. In opportunistic parallel mode, the remaining
+ *  runs are interrupted once one of them found an improving solution. Afterwards, the solutions are transferred and all
+ *  neighborhoods are rewarded in the order of their selection.
+ */
+static
+SCIP_RETCODE runNeighborhoodsParallel(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_HEUR*            heur,               /**< the ALNS heuristic */
+   SCIP_HEURDATA*        heurdata,           /**< heuristic data of the ALNS neighborhood */
+   SOLVELIMITS*          solvelimits,        /**< solving limits of a single neighborhood run */
+   int                   nthreads,           /**< number of threads to use */
+   SCIP_RESULT*          result              /**< pointer to store the result of the heuristic call */
+   )
+{
+   ALNSJOB* jobs;
+   SCIP_VAR** vars;
+   SCIP_VAR** varbuf;
+   SCIP_Real* valbuf;
+   SCIP_Bool* selected;
+   SOLVELIMITS joblimits;
+   SCIP_RETCODE retcode;
+   int nimprovingruns;
+   int parallelmode;
+   int nvars;
+   int njobs;
+   int nselected;
+   int idx;
+   int j;
+
+   assert(nthreads > 1);
+   assert(heurdata->currneighborhood == -1);
+
+   njobs = MIN(nthreads, heurdata->nactiveneighborhoods);
+   assert(njobs > 1);
+
+   SCIP_CALL( SCIPgetIntParam(scip, "parallel/mode", &parallelmode) );
+   SCIP_CALL( SCIPgetVarsData(scip, &vars, &nvars, NULL, NULL, NULL, NULL) );
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &jobs, njobs) );
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &selected, heurdata->nactiveneighborhoods) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &varbuf, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &valbuf, nvars) );
+
+   /* draw distinct neighborhoods; if the bandit algorithm keeps selecting the same ones, use the remaining
+    * neighborhoods in the order of their indices
+    */
+   nselected = 0;
+   for( j = 0; j < 2 * heurdata->nactiveneighborhoods && nselected < njobs; ++j )
+   {
+      SCIP_CALL( selectNeighborhood(scip, heurdata, &idx) );
+
+      if( ! selected[idx] )
+      {
+         selected[idx] = TRUE;
+         jobs[nselected++].neighborhoodidx = idx;
+      }
+   }
+   for( idx = 0; idx < heurdata->nactiveneighborhoods && nselected < njobs; ++idx )
+   {
+      if( ! selected[idx] )
+      {
+         selected[idx] = TRUE;
+         jobs[nselected++].neighborhoodidx = idx;
+      }
+   }
+   assert(nselected == njobs);
+
+   /* all sub-SCIPs are in memory at the same time */
+   joblimits = *solvelimits;
+   joblimits.memorylimit /= njobs;
+
+   nimprovingruns = 0;
+
+   /* set up the sub-SCIPs sequentially, because the neighborhoods access the main SCIP */
+   for( j = 0; j < njobs; ++j )
+   {
+      SCIP_HASHMAP* varmapf;
+      SCIP_EVENTHDLR* eventhdlr;
+      ALNSJOB* job;
+      NH* neighborhood;
+      char probnamesuffix[SCIP_MAXSTRLEN];
+      SCIP_RESULT fixresult;
+      SCIP_Bool success;
+      int nfixings;
+      int ndomchgs;
+      int nchgobjs;
+      int naddedconss;
+      int v;
+
+      job = &jobs[j];
+      job->subscip = NULL;
+      job->subvars = NULL;
+      job->jobid = -1;
+      job->update = FALSE;
+      initRunStats(scip, &job->runstats);
+
+      neighborhood = heurdata->neighborhoods[job->neighborhoodidx];
+      SCIPdebugMsg(scip, "Set up '%s' neighborhood %d for a parallel run\n", neighborhood->name, job->neighborhoodidx);
+
+      SCIP_CALL( SCIPstartClock(scip, neighborhood->stats.setupclock) );
+
+      /* determine variable fixings and objective coefficients of this neighborhood */
+      SCIP_CALL( neighborhoodFixVariables(scip, heurdata, neighborhood, varbuf, valbuf, &nfixings, &fixresult) );
+
+      /* a neighborhood that cannot run gets a zero reward, a delayed neighborhood is simply skipped in this call, and
+       * a neighborhood that misses its fixing rate is penalized as in the sequential mode
+       */
+      if( fixresult != SCIP_SUCCESS )
+      {
+         SCIP_CALL( SCIPstopClock(scip, neighborhood->stats.setupclock) );
+
+         if( fixresult == SCIP_DIDNOTRUN )
+         {
+            SCIP_CALL( updateBanditAlgorithm(scip, heurdata, 0.0, job->neighborhoodidx) );
+         }
+         else if( fixresult == SCIP_DIDNOTFIND )
+         {
+            job->update = TRUE;
+            *result = SCIP_DIDNOTFIND;
+         }
+
+         continue;
+      }
+
+      *result = SCIP_DIDNOTFIND;
+      job->update = TRUE;
+
+      neighborhood->stats.nfixings += nfixings;
+      job->runstats.nfixings = nfixings;
+
+      SCIP_CALL( SCIPcreate(&job->subscip) );
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &job->subvars, nvars) );
+      SCIP_CALL( SCIPhashmapCreate(&varmapf, SCIPblkmem(scip), nvars) );
+      (void) SCIPsnprintf(probnamesuffix, SCIP_MAXSTRLEN, "alns_%s", neighborhood->name);
+
+      SCIP_CALL( SCIPcopyLargeNeighborhoodSearch(scip, job->subscip, varmapf, probnamesuffix, varbuf, valbuf, nfixings,
+            FALSE, heurdata->copycuts, &success, NULL) );
+
+      /* store sub-SCIP variables in array for faster access */
+      for( v = 0; v < nvars; ++v )
+      {
+         job->subvars[v] = (SCIP_VAR*)SCIPhashmapGetImage(varmapf, (void *)vars[v]);
+      }
+
+      SCIPhashmapFree(&varmapf);
+
+      /* let the neighborhood add additional constraints, or restrict domains */
+      SCIP_CALL( neighborhoodChangeSubscip(scip, job->subscip, neighborhood, job->subvars, &ndomchgs, &nchgobjs,
+            &naddedconss, &success) );
+
+      if( ! success )
+      {
+         SCIP_CALL( SCIPstopClock(scip, neighborhood->stats.setupclock) );
+         SCIP_CALL( SCIPfree(&job->subscip) );
+
+         continue;
+      }
+
+      /* set up sub-SCIP parameters */
+      SCIP_CALL( setupSubScip(scip, job->subscip, job->subvars, &joblimits, heur, nchgobjs > 0) );
+
+      job->eventdata.nodelimit = joblimits.nodelimit;
+      job->eventdata.lplimfac = heurdata->lplimfac;
+      job->eventdata.heur = heur;
+      job->eventdata.sourcescip = scip;
+      job->eventdata.subvars = job->subvars;
+      job->eventdata.runstats = &job->runstats;
+      job->eventdata.allrewardsmode = FALSE;
+      job->eventdata.nimprovingruns = &nimprovingruns;
+      job->eventdata.cancellosers = (parallelmode == (int)SCIP_PARA_OPPORTUNISTIC);
+      job->eventdata.foundsol = FALSE;
+
+      /* include an event handler to record new solutions and to interrupt the run */
+      SCIP_CALL( SCIPincludeEventhdlrBasic(job->subscip, &eventhdlr, EVENTHDLR_NAME, EVENTHDLR_DESC, eventExecAlns, NULL) );
+
+      /* transform the problem before catching the events */
+      SCIP_CALL( SCIPtransformProb(job->subscip) );
+      SCIP_CALL( SCIPcatchEvent(job->subscip, SCIP_EVENTTYPE_ALNS, eventhdlr, &job->eventdata, NULL) );
+
+      job->minfixingrate = neighborhood->fixingrate.targetfixingrate / 2.0;
+
+      SCIP_CALL( SCIPstopClock(scip, neighborhood->stats.setupclock) );
+   }
+
+   SCIP_CALL( SCIPinitTpi(scip, njobs) );
+
+   /* start the clocks before the first job is submitted, such that no error can occur while jobs are pending */
+   for( j = 0; j < njobs; ++j )
+   {
+      if( jobs[j].subscip != NULL )
+      {
+         SCIP_CALL( SCIPstartClock(scip, heurdata->neighborhoods[jobs[j].neighborhoodidx]->stats.submipclock) );
+      }
+   }
+
+   /* submit one job per sub-SCIP */
+   retcode = SCIP_OKAY;
+   for( j = 0; j < njobs && retcode == SCIP_OKAY; ++j )
+   {
+      SCIP_SUBMITSTATUS status;
+      SCIP_JOB* job;
+      int jobid;
+
+      if( jobs[j].subscip == NULL )
+         continue;
+
+      jobid = SCIPtpiGetNewJobID();
+      retcode = SCIPtpiCreateJob(&job, jobid, alnsJobExec, (void*) &jobs[j]);
+
+      if( retcode == SCIP_OKAY )
+      {
+         retcode = SCIPtpiSubmitJob(job, &status);
+
+         if( retcode == SCIP_OKAY )
+         {
+            if( status == SCIP_SUBMIT_SUCCESS )
+               jobs[j].jobid = jobid;
+            else
+               retcode = SCIP_ERROR;
+         }
+      }
+   }
+
+   /* collect all submitted jobs, even after an error */
+   for( j = 0; j < njobs; ++j )
+   {
+      if( jobs[j].jobid >= 0 )
+         retcode = MIN(retcode, SCIPtpiCollectJobs(jobs[j].jobid));
+   }
+
+
+   SCIPdebugMsg(scip, "%d of %d parallel neighborhood runs found an improving solution\n", nimprovingruns, njobs);
+
+   /* transfer the solutions and reward the neighborhoods in the order of their selection */
+   for( j = 0; j < njobs; ++j )
+   {
+      ALNSJOB* job;
+      NH* neighborhood;
+      SCIP_Real rewards[NREWARDTYPES] = {0};
+      SCIP_STATUS subscipstatus;
+
+      job = &jobs[j];
+      neighborhood = heurdata->neighborhoods[job->neighborhoodidx];
+
+      if( job->subscip != NULL )
+      {
+         SCIP_CALL( SCIPstopClock(scip, neighborhood->stats.submipclock) );
+      }
+
+      if( retcode != SCIP_OKAY || ! job->update )
+         continue;
+
+      subscipstatus = SCIP_STATUS_UNKNOWN;
+
+      if( job->subscip != NULL )
+      {
+         SCIP_SOL** subsols;
+         int nsubsols;
+         int s;
+
+         /* update statistics based on the sub-SCIP run results */
+         updateRunStats(&job->runstats, job->subscip);
+         subscipstatus = SCIPgetStatus(job->subscip);
+         SCIPdebugMsg(scip, "Status of sub-SCIP run of neighborhood %d: %d\n", job->neighborhoodidx, subscipstatus);
+
+         /* try the best solutions of the sub-SCIP in the main SCIP */
+         subsols = SCIPgetSols(job->subscip);
+         nsubsols = MIN(SCIPgetNSols(job->subscip), heurdata->nsolslim);
+
+         for( s = 0; s < nsubsols; ++s )
+         {
+            SCIP_CALL( transferSolution(job->subscip, subsols[s], &job->eventdata) );
+         }
+
+         SCIP_CALL( getReward(scip, heurdata, &job->runstats, rewards) );
+      }
+
+      /* decrease the number of neighborhoods that have not been initialized */
+      if( neighborhood->stats.nruns == 0 )
+         --heurdata->ninitneighborhoods;
+
+      SCIP_CALL( updateAfterRun(scip, heur, heurdata, &job->runstats, subscipstatus, rewards[REWARDTYPE_TOTAL],
+            job->neighborhoodidx, FALSE) );
+   }
+
+   for( j = njobs - 1; j >= 0; --j )
+   {
+      if( jobs[j].subscip != NULL )
+      {
+         SCIP_CALL( SCIPfree(&jobs[j].subscip) );
+      }
+
+      SCIPfreeBlockMemoryArrayNull(scip, &jobs[j].subvars, nvars);
+   }
+
+   SCIPfreeBufferArray(scip, &valbuf);
+   SCIPfreeBufferArray(scip, &varbuf);
+   SCIPfreeBufferArray(scip, &selected);
+   SCIPfreeBufferArray(scip, &jobs);
+
+   return retcode;
+}
+
 /** execution method of primal heuristic */
 static
 SCIP_DECL_HEUREXEC(heurExecAlns)
@@ -2428,6 +2855,23 @@ SCIP_DECL_HEUREXEC(heurExecAlns)
       }
    }
 
+   /* run several neighborhoods in parallel; the all rewards mode and delayed neighborhoods are handled sequentially */
+   if( heurdata->nthreads > 1 && heurdata->nactiveneighborhoods > 1 && ! allrewardsmode
+      && heurdata->currneighborhood == -1 && SCIPtpiIsAvailable() )
+   {
+      int maxnthreads;
+
+      SCIP_CALL( SCIPgetIntParam(scip, "parallel/maxnthreads", &maxnthreads) );
+
+      if( maxnthreads > 1 )
+      {
+         SCIP_CALL( runNeighborhoodsParallel(scip, heur, heurdata, &solvelimits, MIN(heurdata->nthreads, maxnthreads),
+               result) );
+
+         return SCIP_OKAY;
+      }
+   }
+
    /* use the neighborhood that requested a delay or select the next neighborhood to run based on the selected bandit algorithm */
    if( heurdata->currneighborhood >= 0 )
    {
@@ -2604,6 +3048,9 @@ SCIP_DECL_HEUREXEC(heurExecAlns)
       eventdata.subvars = subvars;
       eventdata.runstats = &runstats[neighborhoodidx];
       eventdata.allrewardsmode = allrewardsmode;
+      eventdata.nimprovingruns = NULL;
+      eventdata.cancellosers = FALSE;
+      eventdata.foundsol = FALSE;
 
       /* include an event handler to transfer solutions into the main SCIP */
       SCIP_CALL( SCIPincludeEventhdlrBasic(subscip, &eventhdlr, EVENTHDLR_NAME, EVENTHDLR_DESC, eventExecAlns, NULL) );
@@ -2687,36 +3134,8 @@ SCIP_DECL_HEUREXEC(heurExecAlns)
       if( neighborhood->stats.nruns == 0 )
          --heurdata->ninitneighborhoods;
 
-      heurdata->usednodes += runstats[banditidx].usednodes;
-
-      /* determine the success of this neighborhood, and update the target fixing rate for the next time */
-      updateNeighborhoodStats(&runstats[banditidx], heurdata->neighborhoods[banditidx], subscipstatus[banditidx]);
-
-      /* adjust the fixing rate for this neighborhood
-       * make no adjustments in all rewards mode, because this only affects 1 of 8 heuristics
-       */
-      if( heurdata->adjustfixingrate && ! allrewardsmode )
-      {
-         SCIPdebugMsg(scip, "Update fixing rate: %.2f\n", heurdata->neighborhoods[banditidx]->fixingrate.targetfixingrate);
-         updateFixingRate(heurdata->neighborhoods[banditidx], subscipstatus[banditidx], &runstats[banditidx]);
-         SCIPdebugMsg(scip, "New fixing rate: %.2f\n", heurdata->neighborhoods[banditidx]->fixingrate.targetfixingrate);
-      }
-      /* similarly, update the minimum improvement for the ALNS heuristic */
-      if( heurdata->adjustminimprove )
-      {
-         SCIPdebugMsg(scip, "Update Minimum Improvement: %.4f\n", heurdata->minimprove);
-         updateMinimumImprovement(heurdata, subscipstatus[banditidx], &runstats[banditidx]);
-         SCIPdebugMsg(scip, "--> %.4f\n", heurdata->minimprove);
-      }
-
-      /* update the target node limit based on the status of the selected algorithm */
-      if( heurdata->adjusttargetnodes && SCIPheurGetNCalls(heur) >= heurdata->nactiveneighborhoods )
-      {
-         updateTargetNodeLimit(heurdata, &runstats[banditidx], subscipstatus[banditidx]);
-      }
-
-      /* update the bandit algorithm by the measured reward */
-      SCIP_CALL( updateBanditAlgorithm(scip, heurdata, rewards[banditidx][REWARDTYPE_TOTAL], banditidx) );
+      SCIP_CALL( updateAfterRun(scip, heur, heurdata, &runstats[banditidx], subscipstatus[banditidx],
+            rewards[banditidx][REWARDTYPE_TOTAL], banditidx, allrewardsmode) );
 
       resetCurrentNeighborhood(heurdata);
    }
@@ -4192,6 +4611,10 @@ SCIP_RETCODE SCIPincludeHeurAlns(
          "should the heuristic be executed multiple times during the root node?",
          &heurdata->initduringroot, TRUE, DEFAULT_INITDURINGROOT, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddIntParam(scip, "heuristics/" HEUR_NAME "/nthreads",
+         "number of threads to run several neighborhoods in parallel, at most parallel/maxnthreads (1: sequential)",
+         &heurdata->nthreads, TRUE, DEFAULT_NTHREADS, 1, 64, NULL, NULL) );
+
    assert(SCIPfindTable(scip, TABLE_NAME_NEIGHBORHOOD) == NULL);
    SCIP_CALL( SCIPincludeTable(scip, TABLE_NAME_NEIGHBORHOOD, TABLE_DESC_NEIGHBORHOOD, TRUE,
          NULL, NULL, NULL, NULL, NULL, NULL, tableOutputNeighborhood,
@@ -61,6 +61,7 @@ struct SCIP_HeurData
    SCIP_SOL**            sols;               /**< storing solutions passed to heuristic sorted by objective value */
    int                   nsols;              /**< number of soluions stored */
    int                   maxnsols;           /**< maximum number of solutions that can be stored */
+   SCIP_Real             objlimit;           /**< objective limit passed to the heuristic, or SCIP_INVALID */
 };
 
 
@@ -114,6 +115,7 @@ SCIP_DECL_HEUREXITSOL(heurExitSync)
       SCIP_CALL( SCIPfreeSol(scip, &heurdata->sols[i]) );
    }
    heurdata->nsols = 0;
+   heurdata->objlimit = SCIP_INVALID;
    return SCIP_OKAY;
 }
 
@@ -137,10 +139,19 @@ SCIP_DECL_HEUREXEC(heurExecSync)
    /* get heuristic data */
    heurdata = SCIPheurGetData(heur);
    assert(heurdata != NULL);
-   assert(heurdata->nsols > 0);
+   assert(heurdata->nsols > 0 || heurdata->objlimit != SCIP_INVALID); /*lint !e777*/
 
    SCIPdebugMessage("exec method of sync primal heuristic.\n");
    *result = SCIP_DIDNOTFIND;
+
+   /* only tighten the objective limit, since it cannot be relaxed after the problem was transformed */
+   if( heurdata->objlimit != SCIP_INVALID /*lint !e777*/
+      && SCIPtransformObj(scip, heurdata->objlimit) < SCIPtransformObj(scip, SCIPgetObjlimit(scip)) )
+   {
+      SCIP_CALL( SCIPsetObjlimit(scip, heurdata->objlimit) );
+   }
+   heurdata->objlimit = SCIP_INVALID;
+
    for( i = 0; i < heurdata->nsols; ++i )
    {
       SCIP_CALL( SCIPtrySolFree(scip, &heurdata->sols[i], FALSE, FALSE, FALSE, FALSE, FALSE, &stored) );
@@ -170,6 +181,7 @@ SCIP_RETCODE SCIPincludeHeurSync(
    SCIP_CALL( SCIPgetIntParam(scip, "concurrent/sync/maxnsols", &heurdata->maxnsols) );
    SCIP_CALL( SCIPallocBlockMemoryArray(scip, &heurdata->sols, heurdata->maxnsols) );
    heurdata->nsols = 0;
+   heurdata->objlimit = SCIP_INVALID;
 
    /* include primal heuristic */
    SCIP_CALL( SCIPincludeHeurBasic(scip, &heur,
@@ -264,3 +276,29 @@ SCIP_RETCODE SCIPheurSyncPassSol(
 
    return SCIP_OKAY;
 }
+
+/** pass an objective limit to the sync heuristic, which applies it the next time it is called */
+SCIP_RETCODE SCIPheurSyncPassObjlimit(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_HEUR*            heur,               /**< sync heuristic */
+   SCIP_Real             objlimit            /**< objective limit in the original objective space */
+   )
+{
+   SCIP_HEURDATA* heurdata;
+
+   assert(scip != NULL);
+   assert(heur != NULL);
+   assert(strcmp(HEUR_NAME, SCIPheurGetName(heur)) == 0);
+
+   /* get heuristic data */
+   heurdata = SCIPheurGetData(heur);
+   assert(heurdata != NULL);
+
+   if( heurdata->objlimit == SCIP_INVALID /*lint !e777*/
+      || SCIPtransformObj(scip, objlimit) < SCIPtransformObj(scip, heurdata->objlimit) )
+      heurdata->objlimit = objlimit;
+
+   SCIPheurSetFreq(heur, 1);
+
+   return SCIP_OKAY;
+}
@@ -71,6 +71,14 @@ SCIP_RETCODE SCIPheurSyncPassSol(
    SCIP_SOL*             sol                 /**< solution to be passed */
    );
 
+/** pass an objective limit to the sync heuristic, which applies it the next time it is called */
+SCIP_EXPORT
+SCIP_RETCODE SCIPheurSyncPassObjlimit(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_HEUR*            heur,               /**< sync heuristic */
+   SCIP_Real             objlimit            /**< objective limit in the original objective space */
+   );
+
 /** @} */
 
 #ifdef __cplusplus
@@ -42,6 +42,8 @@
 
 
 #include "lpi/lpi.h"
+#include "tpi/tpi.h"
+#include "scip/bitencode.h"
 #include "scip/clock.h"
 #include "scip/cons.h"
 #include "scip/event.h"
@@ -64,6 +66,7 @@
 #include "scip/struct_set.h"
 #include "scip/struct_stat.h"
 #include "scip/struct_var.h"
+#include "scip/type_syncstore.h"
 #include "scip/var.h"
 #include <string.h>
 
@@ -4279,7 +4282,7 @@ void SCIPcolInvalidateStrongbranchData(
    assert(set != NULL);
    assert(stat != NULL);
    assert(lp != NULL);
-   assert(lp->strongbranchprobing);
+   assert(lp->strongbranching || lp->strongbranchprobing);
    assert(col->lppos < lp->ncols);
    assert(lp->cols[col->lppos] == col);
 
@@ -4480,6 +4483,434 @@ SCIP_RETCODE SCIPcolGetStrongbranch(
    return SCIP_OKAY;
 }
 
+/** LP data shared by the jobs of parallel strong branching
+ *
+ *  The LP and its optimal basis are only extracted if a copy of the LP does not contain the current LP yet.
+ */
+struct SCIP_SbLpData
+{
+   SCIP_OBJSEN           objsen;             /**< objective sense */
+   SCIP_Real*            obj;                /**< objective coefficients of the columns */
+   SCIP_Real*            lb;                 /**< lower bounds of the columns */
+   SCIP_Real*            ub;                 /**< upper bounds of the columns */
+   SCIP_Real*            lhs;                /**< left hand sides of the rows */
+   SCIP_Real*            rhs;                /**< right hand sides of the rows */
+   int*                  beg;                /**< start index of each column in ind- and val-array */
+   int*                  ind;                /**< row indices of the matrix entries */
+   SCIP_Real*            val;                /**< values of the matrix entries */
+   int*                  cstat;              /**< basis status of the columns */
+   int*                  rstat;              /**< basis status of the rows */
+   int                   ncols;              /**< number of columns */
+   int                   nrows;              /**< number of rows */
+   int                   nnonz;              /**< number of matrix entries */
+   SCIP_Real             objlim;             /**< objective limit */
+   SCIP_Real             feastol;            /**< feasibility tolerance, or SCIP_INVALID if not supported */
+   SCIP_Real             dualfeastol;        /**< reduced costs feasibility tolerance, or SCIP_INVALID if not supported */
+   int                   scaling;            /**< scaling setting, or -1 if not supported */
+   SCIP_Longint          lpcount;            /**< LP count of the current LP */
+   SCIP_Bool             integral;           /**< should integral strong branching be performed? */
+   int                   itlim;              /**< iteration limit for strong branchings */
+   const int*            lpipos;             /**< LP solver positions of the candidate columns */
+   const SCIP_Real*      primsols;           /**< primal solution values of the candidate columns */
+   int                   ncands;             /**< number of candidate columns */
+   int                   nextcand;           /**< next candidate to be evaluated in opportunistic mode */
+   SCIP_LOCK*            lock;               /**< lock protecting nextcand, or NULL in deterministic mode */
+   SCIP_Real*            down;               /**< dual bounds after branching the candidates down */
+   SCIP_Real*            up;                 /**< dual bounds after branching the candidates up */
+   SCIP_Bool*            downvalid;          /**< are the down values valid dual bounds? */
+   SCIP_Bool*            upvalid;            /**< are the up values valid dual bounds? */
+};
+typedef struct SCIP_SbLpData SCIP_SBLPDATA;
+
+/** data of a job of parallel strong branching */
+struct SCIP_SbJobData
+{
+   SCIP_SBLPDATA*        lpdata;             /**< shared LP data */
+   SCIP_LPI*             lpi;                /**< copy of the LP used by the job */
+   SCIP_Longint*         lpcount;            /**< pointer to the LP count of the LP loaded into the copy */
+   int                   firstcand;          /**< first candidate evaluated by the job in deterministic mode */
+   int                   lastcand;           /**< last candidate (exclusive) evaluated by the job in deterministic mode */
+   int                   iter;               /**< number of strong branching iterations, or -1 if unknown */
+};
+typedef struct SCIP_SbJobData SCIP_SBJOBDATA;
+
+/** sets a parameter of an LP solver used in parallel strong branching, ignoring unknown parameters */
+static
+SCIP_RETCODE sbLpiSetRealpar(
+   SCIP_LPI*             lpi,                /**< LP solver */
+   SCIP_LPPARAM          lpparam,            /**< LP parameter */
+   SCIP_Real             value               /**< value to set parameter to */
+   )
+{
+   SCIP_RETCODE retcode;
+
+   retcode = SCIPlpiSetRealpar(lpi, lpparam, value);
+
+   return retcode == SCIP_PARAMETERUNKNOWN ? SCIP_OKAY : retcode;
+}
+
+/** sets a parameter of an LP solver used in parallel strong branching, ignoring unknown parameters */
+static
+SCIP_RETCODE sbLpiSetIntpar(
+   SCIP_LPI*             lpi,                /**< LP solver */
+   SCIP_LPPARAM          lpparam,            /**< LP parameter */
+   int                   value               /**< value to set parameter to */
+   )
+{
+   SCIP_RETCODE retcode;
+
+   retcode = SCIPlpiSetIntpar(lpi, lpparam, value);
+
+   return retcode == SCIP_PARAMETERUNKNOWN ? SCIP_OKAY : retcode;
+}
+
+/** sets the parameters of a copy of the LP for parallel strong branching to those of the LP solver */
+static
+SCIP_RETCODE sbLpiSetParams(
+   SCIP_LPI*             lpi,                /**< LP solver */
+   SCIP_SBLPDATA*        lpdata              /**< shared LP data */
+   )
+{
+   SCIP_CALL( sbLpiSetIntpar(lpi, SCIP_LPPAR_LPINFO, FALSE) );
+   SCIP_CALL( sbLpiSetIntpar(lpi, SCIP_LPPAR_THREADS, 1) );
+   SCIP_CALL( sbLpiSetRealpar(lpi, SCIP_LPPAR_OBJLIM, lpdata->objlim) );
+
+   if( lpdata->feastol != SCIP_INVALID ) /*lint !e777*/
+   {
+      SCIP_CALL( sbLpiSetRealpar(lpi, SCIP_LPPAR_FEASTOL, lpdata->feastol) );
+   }
+   if( lpdata->dualfeastol != SCIP_INVALID ) /*lint !e777*/
+   {
+      SCIP_CALL( sbLpiSetRealpar(lpi, SCIP_LPPAR_DUALFEASTOL, lpdata->dualfeastol) );
+   }
+   if( lpdata->scaling >= 0 )
+   {
+      SCIP_CALL( sbLpiSetIntpar(lpi, SCIP_LPPAR_SCALING, lpdata->scaling) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** loads the shared LP data into the given LP solver and restores the optimal basis */
+static
+SCIP_RETCODE sbLpiLoad(
+   SCIP_LPI*             lpi,                /**< LP solver */
+   SCIP_SBLPDATA*        lpdata              /**< shared LP data */
+   )
+{
+   SCIP_CALL( SCIPlpiLoadColLP(lpi, lpdata->objsen, lpdata->ncols, lpdata->obj, lpdata->lb, lpdata->ub, NULL,
+         lpdata->nrows, lpdata->lhs, lpdata->rhs, NULL, lpdata->nnonz, lpdata->beg, lpdata->ind, lpdata->val) );
+
+   SCIP_CALL( sbLpiSetParams(lpi, lpdata) );
+
+   /* the basis is optimal, such that resolving should not need any iterations */
+   SCIP_CALL( SCIPlpiSetBase(lpi, lpdata->cstat, lpdata->rstat) );
+   SCIP_CALL( SCIPlpiSolveDual(lpi) );
+
+   if( !SCIPlpiIsOptimal(lpi) )
+      return SCIP_LPERROR;
+
+   return SCIP_OKAY;
+}
+
+/** evaluates strong branching candidates on the job's copy of the LP
+ *
+ *  The copy is kept for the following strong branching calls; it is only reloaded if the LP has changed. Since strong
+ *  branching restores the basis after each candidate, a copy that contains the current LP is still at its optimal
+ *  basis. In deterministic mode, the job evaluates a fixed range of candidates, such that the results do not depend on the
+ *  timing of the threads. Otherwise, the job evaluates candidates until all candidates have been taken.
+ */
+static
+SCIP_RETCODE sbJobExec(
+   void*                 args                /**< job data */
+   )
+{
+   SCIP_SBJOBDATA* jobdata;
+   SCIP_SBLPDATA* lpdata;
+   SCIP_RETCODE retcode;
+   SCIP_LPI* lpi;
+   int c;
+
+   jobdata = (SCIP_SBJOBDATA*) args;
+   lpdata = jobdata->lpdata;
+   lpi = jobdata->lpi;
+   jobdata->iter = 0;
+
+   /* failing to resolve the copy is reported as an LP error without an error message, like a failing strong branching */
+   if( *jobdata->lpcount != lpdata->lpcount )
+   {
+      *jobdata->lpcount = -1;
+
+      retcode = sbLpiLoad(lpi, lpdata);
+      if( retcode != SCIP_OKAY )
+         return retcode;
+
+      *jobdata->lpcount = lpdata->lpcount;
+   }
+   else
+   {
+      /* the objective limit may have changed since the last call */
+      SCIP_CALL( sbLpiSetParams(lpi, lpdata) );
+   }
+
+   retcode = SCIP_OKAY;
+
+   c = jobdata->firstcand;
+   while( TRUE ) /*lint !e716*/
+   {
+      int iter;
+
+      if( lpdata->lock != NULL )
+      {
+         SCIP_CALL_TERMINATE( retcode, SCIPtpiAcquireLock(lpdata->lock), TERMINATE );
+         c = lpdata->nextcand++;
+         SCIP_CALL_TERMINATE( retcode, SCIPtpiReleaseLock(lpdata->lock), TERMINATE );
+
+         if( c >= lpdata->ncands )
+            break;
+      }
+      else if( c >= jobdata->lastcand )
+         break;
+
+      if( lpdata->integral )
+      {
+         SCIP_CALL_TERMINATE( retcode, SCIPlpiStrongbranchInt(lpi, lpdata->lpipos[c], lpdata->primsols[c],
+               lpdata->itlim, &lpdata->down[c], &lpdata->up[c], &lpdata->downvalid[c], &lpdata->upvalid[c], &iter),
+            TERMINATE );
+      }
+      else
+      {
+         SCIP_CALL_TERMINATE( retcode, SCIPlpiStrongbranchFrac(lpi, lpdata->lpipos[c], lpdata->primsols[c],
+               lpdata->itlim, &lpdata->down[c], &lpdata->up[c], &lpdata->downvalid[c], &lpdata->upvalid[c], &iter),
+            TERMINATE );
+      }
+
+      if( iter == -1 || jobdata->iter == -1 )
+         jobdata->iter = -1;
+      else
+         jobdata->iter += iter;
+
+      ++c;
+   }
+
+TERMINATE:
+   /* after an error, the state of the copy is unknown */
+   if( retcode != SCIP_OKAY )
+      *jobdata->lpcount = -1;
+
+   return retcode;
+}
+
+/** makes sure that the LP has at least the given number of copies for parallel strong branching */
+static
+SCIP_RETCODE lpEnsureSbLpis(
+   SCIP_LP*              lp,                 /**< LP data */
+   int                   num                 /**< minimal number of copies */
+   )
+{
+   assert(lp != NULL);
+
+   if( num > lp->nsblpis )
+   {
+      int i;
+
+      SCIP_ALLOC( BMSreallocMemoryArray(&lp->sblpis, num) );
+      SCIP_ALLOC( BMSreallocMemoryArray(&lp->sblpilpcounts, num) );
+
+      for( i = lp->nsblpis; i < num; ++i )
+      {
+         lp->sblpis[i] = NULL;
+         lp->sblpilpcounts[i] = -1;
+      }
+
+      lp->nsblpis = num;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** performs strong branching on the given columns in parallel; each job evaluates its share of the candidates on its
+ *  own copy of the LP, which is warm started from the current optimal basis
+ *
+ *  The copies are kept until the LP is freed, such that they are only reloaded if the LP has been resolved since the
+ *  last call, and not at all if strong branching is called several times on the same LP.
+ */
+static
+SCIP_RETCODE lpStrongbranchesParallel(
+   SCIP_LP*              lp,                 /**< LP data */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics */
+   int*                  lpipos,             /**< LP solver positions of the candidate columns */
+   SCIP_Real*            primsols,           /**< primal solution values of the candidate columns */
+   int                   ncands,             /**< number of candidate columns */
+   SCIP_Bool             integral,           /**< should integral strong branching be performed? */
+   int                   itlim,              /**< iteration limit for strong branchings */
+   SCIP_Real*            down,               /**< array to store dual bounds after branching the candidates down */
+   SCIP_Real*            up,                 /**< array to store dual bounds after branching the candidates up */
+   SCIP_Bool*            downvalid,          /**< array to store whether the down values are valid dual bounds */
+   SCIP_Bool*            upvalid,            /**< array to store whether the up values are valid dual bounds */
+   int*                  iter                /**< pointer to store the number of iterations, or -1 if unknown */
+   )
+{
+   SCIP_SBJOBDATA* jobdata;
+   SCIP_SBLPDATA lpdata;
+   SCIP_RETCODE retcode;
+   SCIP_Bool extract;
+   int njobs;
+   int jobid;
+   int j;
+
+   assert(lp != NULL);
+   assert(set != NULL);
+   assert(stat != NULL);
+   assert(ncands > 1);
+   assert(iter != NULL);
+
+   njobs = MIN3(set->branch_sbnthreads, set->parallel_maxnthreads, ncands);
+
+   SCIP_CALL( SCIPlpiGetObjsen(lp->lpi, &lpdata.objsen) );
+
+   /* create the missing copies and check whether any copy needs to be loaded */
+   SCIP_CALL( lpEnsureSbLpis(lp, njobs) );
+
+   extract = FALSE;
+   for( j = 0; j < njobs; ++j )
+   {
+      if( lp->sblpis[j] == NULL )
+      {
+         SCIP_CALL( SCIPlpiCreate(&lp->sblpis[j], NULL, "strongbranching", lpdata.objsen) );
+      }
+
+      if( lp->sblpilpcounts[j] != stat->lpcount )
+         extract = TRUE;
+   }
+
+   lpdata.ncols = 0;
+   lpdata.nrows = 0;
+   lpdata.nnonz = 0;
+   lpdata.obj = NULL;
+   lpdata.lb = NULL;
+   lpdata.ub = NULL;
+   lpdata.beg = NULL;
+   lpdata.cstat = NULL;
+   lpdata.ind = NULL;
+   lpdata.val = NULL;
+   lpdata.lhs = NULL;
+   lpdata.rhs = NULL;
+   lpdata.rstat = NULL;
+
+   if( extract )
+   {
+      SCIP_CALL( SCIPlpiGetNCols(lp->lpi, &lpdata.ncols) );
+      SCIP_CALL( SCIPlpiGetNRows(lp->lpi, &lpdata.nrows) );
+      SCIP_CALL( SCIPlpiGetNNonz(lp->lpi, &lpdata.nnonz) );
+
+      SCIP_CALL( SCIPsetAllocBufferArray(set, &lpdata.obj, lpdata.ncols) );
+      SCIP_CALL( SCIPsetAllocBufferArray(set, &lpdata.lb, lpdata.ncols) );
+      SCIP_CALL( SCIPsetAllocBufferArray(set, &lpdata.ub, lpdata.ncols) );
+      SCIP_CALL( SCIPsetAllocBufferArray(set, &lpdata.beg, lpdata.ncols) );
+      SCIP_CALL( SCIPsetAllocBufferArray(set, &lpdata.cstat, lpdata.ncols) );
+      SCIP_CALL( SCIPsetAllocBufferArray(set, &lpdata.ind, lpdata.nnonz) );
+      SCIP_CALL( SCIPsetAllocBufferArray(set, &lpdata.val, lpdata.nnonz) );
+      SCIP_CALL( SCIPsetAllocBufferArray(set, &lpdata.lhs, lpdata.nrows) );
+      SCIP_CALL( SCIPsetAllocBufferArray(set, &lpdata.rhs, lpdata.nrows) );
+      SCIP_CALL( SCIPsetAllocBufferArray(set, &lpdata.rstat, lpdata.nrows) );
+
+      SCIP_CALL( SCIPlpiGetCols(lp->lpi, 0, lpdata.ncols - 1, lpdata.lb, lpdata.ub, &lpdata.nnonz, lpdata.beg,
+            lpdata.ind, lpdata.val) );
+      SCIP_CALL( SCIPlpiGetObj(lp->lpi, 0, lpdata.ncols - 1, lpdata.obj) );
+      SCIP_CALL( SCIPlpiGetSides(lp->lpi, 0, lpdata.nrows - 1, lpdata.lhs, lpdata.rhs) );
+      SCIP_CALL( SCIPlpiGetBase(lp->lpi, lpdata.cstat, lpdata.rstat) );
+   }
+
+   lpdata.lpcount = stat->lpcount;
+   lpdata.objlim = lp->lpiobjlim;
+   lpdata.feastol = lp->lpihasfeastol ? lp->lpifeastol : SCIP_INVALID;
+   lpdata.dualfeastol = lp->lpihasdualfeastol ? lp->lpidualfeastol : SCIP_INVALID;
+   lpdata.scaling = lp->lpihasscaling ? lp->lpiscaling : -1;
+   lpdata.integral = integral;
+   lpdata.itlim = itlim;
+   lpdata.lpipos = lpipos;
+   lpdata.primsols = primsols;
+   lpdata.ncands = ncands;
+   lpdata.nextcand = 0;
+   lpdata.lock = NULL;
+   lpdata.down = down;
+   lpdata.up = up;
+   lpdata.downvalid = downvalid;
+   lpdata.upvalid = upvalid;
+
+   if( set->parallel_mode == (int) SCIP_PARA_OPPORTUNISTIC )
+   {
+      SCIP_CALL( SCIPtpiInitLock(&lpdata.lock) );
+   }
+
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &jobdata, njobs) );
+
+   SCIP_CALL( SCIPstatInitTpi(stat, njobs) );
+
+   /* the candidates are split into contiguous ranges, such that the results in deterministic mode only depend on the
+    * number of jobs; job j always uses the j-th copy of the LP
+    */
+   jobid = SCIPtpiGetNewJobID();
+   retcode = SCIP_OKAY;
+   for( j = 0; j < njobs && retcode == SCIP_OKAY; ++j )
+   {
+      SCIP_SUBMITSTATUS status;
+      SCIP_JOB* job;
+
+      jobdata[j].lpdata = &lpdata;
+      jobdata[j].lpi = lp->sblpis[j];
+      jobdata[j].lpcount = &lp->sblpilpcounts[j];
+      jobdata[j].firstcand = (int) ((SCIP_Longint) j * ncands / njobs);
+      jobdata[j].lastcand = (int) ((SCIP_Longint) (j + 1) * ncands / njobs);
+      jobdata[j].iter = 0;
+
+      retcode = SCIPtpiCreateJob(&job, jobid, sbJobExec, (void*) &jobdata[j]);
+
+      if( retcode == SCIP_OKAY )
+      {
+         retcode = SCIPtpiSubmitJob(job, &status);
+
+         if( retcode == SCIP_OKAY && status != SCIP_SUBMIT_SUCCESS )
+            retcode = SCIP_ERROR;
+      }
+   }
+
+   /* wait for all submitted jobs, even if a submission failed */
+   retcode = MIN(retcode, SCIPtpiCollectJobs(jobid));
+
+   *iter = 0;
+   for( j = 0; j < njobs; ++j )
+   {
+      if( jobdata[j].iter == -1 || *iter == -1 )
+         *iter = -1;
+      else
+         *iter += jobdata[j].iter;
+   }
+
+   SCIPsetFreeBufferArray(set, &jobdata);
+
+   if( lpdata.lock != NULL )
+      SCIPtpiDestroyLock(&lpdata.lock);
+
+   if( extract )
+   {
+      SCIPsetFreeBufferArray(set, &lpdata.rstat);
+      SCIPsetFreeBufferArray(set, &lpdata.rhs);
+      SCIPsetFreeBufferArray(set, &lpdata.lhs);
+      SCIPsetFreeBufferArray(set, &lpdata.val);
+      SCIPsetFreeBufferArray(set, &lpdata.ind);
+      SCIPsetFreeBufferArray(set, &lpdata.cstat);
+      SCIPsetFreeBufferArray(set, &lpdata.beg);
+      SCIPsetFreeBufferArray(set, &lpdata.ub);
+      SCIPsetFreeBufferArray(set, &lpdata.lb);
+      SCIPsetFreeBufferArray(set, &lpdata.obj);
+   }
+
+   return retcode;
+}
+
 /** gets strong branching information on column variables */
 SCIP_RETCODE SCIPcolGetStrongbranches(
    SCIP_COL**            cols,               /**< LP columns */
@@ -4595,8 +5026,11 @@ SCIP_RETCODE SCIPcolGetStrongbranches(
 
    SCIPsetDebugMsg(set, "performing strong branching on %d variables with %d iterations\n", ncols, itlim);
 
-   /* call LPI strong branching */
-   if ( integral )
+   /* call LPI strong branching; with several threads, the candidates are evaluated on copies of the LP */
+   if( MIN(set->branch_sbnthreads, set->parallel_maxnthreads) > 1 && nsubcols > 1 && SCIPtpiIsAvailable() )
+      retcode = lpStrongbranchesParallel(lp, set, stat, lpipos, primsols, nsubcols, integral, itlim, sbdown, sbup, sbdownvalid,
+         sbupvalid, &iter);
+   else if ( integral )
       retcode = SCIPlpiStrongbranchesInt(lp->lpi, lpipos, nsubcols, primsols, itlim, sbdown, sbup, sbdownvalid, sbupvalid, &iter);
    else
       retcode = SCIPlpiStrongbranchesFrac(lp->lpi, lpipos, nsubcols, primsols, itlim, sbdown, sbup, sbdownvalid, sbupvalid, &iter);
@@ -9095,6 +9529,9 @@ SCIP_RETCODE SCIPlpCreate(
    /* open LP Solver interface */
    SCIP_CALL( SCIPlpiCreate(&(*lp)->lpi, messagehdlr, name, SCIP_OBJSEN_MINIMIZE) );
 
+   (*lp)->sblpis = NULL;
+   (*lp)->sblpilpcounts = NULL;
+   (*lp)->nsblpis = 0;
    (*lp)->lpicols = NULL;
    (*lp)->lpirows = NULL;
    (*lp)->chgcols = NULL;
@@ -9187,6 +9624,7 @@ SCIP_RETCODE SCIPlpCreate(
    (*lp)->divinglpiitlim = INT_MAX;
    (*lp)->resolvelperror = FALSE;
    (*lp)->divenolddomchgs = 0;
+   (*lp)->basismem = 0;
    (*lp)->adjustlpval = FALSE;
    (*lp)->lpiobjlim = SCIPlpiInfinity((*lp)->lpi);
    (*lp)->lpifeastol = (*lp)->feastol;
@@ -9395,6 +9833,17 @@ SCIP_RETCODE SCIPlpFree(
       SCIP_CALL( SCIPlpiFree(&(*lp)->lpi) );
    }
 
+   /* free the copies of the LP used by parallel strong branching */
+   for( i = 0; i < (*lp)->nsblpis; ++i )
+   {
+      if( (*lp)->sblpis[i] != NULL )
+      {
+         SCIP_CALL( SCIPlpiFree(&(*lp)->sblpis[i]) );
+      }
+   }
+   BMSfreeMemoryArrayNull(&(*lp)->sblpis);
+   BMSfreeMemoryArrayNull(&(*lp)->sblpilpcounts);
+
    BMSfreeMemoryNull(&(*lp)->storedsolvals);
    BMSfreeMemoryArrayNull(&(*lp)->lpicols);
    BMSfreeMemoryArrayNull(&(*lp)->lpirows);
@@ -10113,6 +10562,386 @@ SCIP_RETCODE SCIPlpFreeState(
    return SCIP_OKAY;
 }
 
+#define LPBASIS_MAXNDELTAS     20    /**< maximal number of bases stored as changes on the way to a complete basis */
+#define LPBASIS_MAXDELTAFRAC  0.5    /**< maximal fraction of the memory of the complete basis that the changes may use */
+
+/** returns the number of packed basis status entries of the given basis */
+static
+int lpbasisGetNStats(
+   SCIP_LPBASIS*         basis               /**< LP basis */
+   )
+{
+   assert(basis != NULL);
+
+   if( basis->parent == NULL )
+      return basis->ncols + basis->nrows;
+
+   return basis->nchgs + basis->ncols - basis->parent->ncols + basis->nrows - basis->parent->nrows;
+}
+
+/** returns the memory in bytes needed to store a basis with the given numbers of changes and status entries */
+static
+SCIP_Longint lpbasisCalcMem(
+   int                   nchgs,              /**< number of changed columns and rows of the parent basis */
+   int                   nstats              /**< number of packed basis status entries */
+   )
+{
+   return (SCIP_Longint)sizeof(SCIP_LPBASIS) + (SCIP_Longint)nchgs * (SCIP_Longint)sizeof(int)
+      + (SCIP_Longint)((nstats + (int)SCIP_DUALPACKETSIZE - 1) / (int)SCIP_DUALPACKETSIZE) * (SCIP_Longint)sizeof(SCIP_DUALPACKET);
+}
+
+/** unpacks the basis status of the columns and rows of the given basis into the given arrays, which must have at least
+ *  basis->ncols and basis->nrows entries
+ */
+static
+SCIP_RETCODE lpbasisUnpack(
+   SCIP_LPBASIS*         basis,              /**< LP basis */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   int*                  cstat,              /**< array to store the column basis status */
+   int*                  rstat               /**< array to store the row basis status */
+   )
+{
+   SCIP_LPBASIS* parent;
+   int* stats;
+   int nstats;
+   int pos;
+   int i;
+
+   assert(basis != NULL);
+   assert(cstat != NULL || basis->ncols == 0);
+   assert(rstat != NULL || basis->nrows == 0);
+
+   parent = basis->parent;
+
+   /* the parent basis defines the status of the first columns and rows */
+   if( parent != NULL )
+   {
+      SCIP_CALL( lpbasisUnpack(parent, set, cstat, rstat) );
+   }
+
+   nstats = lpbasisGetNStats(basis);
+   if( nstats == 0 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &stats, nstats) );
+   SCIPdecodeDualBit(basis->packstat, stats, nstats);
+
+   pos = 0;
+   if( parent == NULL )
+   {
+      for( i = 0; i < basis->ncols; ++i )
+         cstat[i] = stats[pos++]; /*lint !e613*/
+      for( i = 0; i < basis->nrows; ++i )
+         rstat[i] = stats[pos++]; /*lint !e613*/
+   }
+   else
+   {
+      for( i = 0; i < basis->nchgs; ++i )
+      {
+         if( basis->chgidx[i] < parent->ncols )
+            cstat[basis->chgidx[i]] = stats[pos++]; /*lint !e613*/
+         else
+            rstat[basis->chgidx[i] - parent->ncols] = stats[pos++]; /*lint !e613*/
+      }
+      for( i = parent->ncols; i < basis->ncols; ++i )
+         cstat[i] = stats[pos++]; /*lint !e613*/
+      for( i = parent->nrows; i < basis->nrows; ++i )
+         rstat[i] = stats[pos++]; /*lint !e613*/
+   }
+   assert(pos == nstats);
+
+   SCIPsetFreeBufferArray(set, &stats);
+
+   return SCIP_OKAY;
+}
+
+/** stores the basis of the current LP in packed format; if a parent basis is given, whose columns and rows are the first
+ *  columns and rows of the current LP, only the changes to the parent basis are stored if this needs less memory
+ *
+ *  If the current LP solution is not basic or the LP is empty, no basis is stored and NULL is returned.
+ */
+SCIP_RETCODE SCIPlpGetBasis(
+   SCIP_LP*              lp,                 /**< LP data */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_LPBASIS*         parent,             /**< basis the changes may refer to, or NULL */
+   SCIP_LPBASIS**        basis               /**< pointer to store the basis, or NULL if no basis is available */
+   )
+{
+   int* cstat;
+   int* rstat;
+   int* stats;
+   int* chgidx;
+   int ncols;
+   int nrows;
+   int nchgs;
+   int nstats;
+   int pos;
+   int i;
+
+   assert(lp != NULL);
+   assert(lp->flushed);
+   assert(lp->solved);
+   assert(blkmem != NULL);
+   assert(set != NULL);
+   assert(basis != NULL);
+
+   *basis = NULL;
+
+   ncols = lp->nlpicols;
+   nrows = lp->nlpirows;
+
+   /* check whether there is no lp or no basis */
+   if( (ncols == 0 && nrows == 0) || !lp->solisbasic )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &cstat, ncols) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &rstat, nrows) );
+   SCIP_CALL( SCIPlpiGetBase(lp->lpi, cstat, rstat) );
+
+   /* the parent can only be used if its columns and rows are the first ones of the current LP */
+   if( parent != NULL && (parent->ndeltas >= LPBASIS_MAXNDELTAS || parent->ncols > ncols || parent->nrows > nrows) )
+      parent = NULL;
+
+   chgidx = NULL;
+   nchgs = 0;
+
+   /* collect the columns and rows whose status differs from the parent basis */
+   if( parent != NULL )
+   {
+      int* parentcstat;
+      int* parentrstat;
+
+      SCIP_CALL( SCIPsetAllocBufferArray(set, &parentcstat, parent->ncols) );
+      SCIP_CALL( SCIPsetAllocBufferArray(set, &parentrstat, parent->nrows) );
+      SCIP_CALL( SCIPsetAllocBufferArray(set, &chgidx, parent->ncols + parent->nrows) );
+      SCIP_CALL( lpbasisUnpack(parent, set, parentcstat, parentrstat) );
+
+      for( i = 0; i < parent->ncols; ++i )
+      {
+         if( cstat[i] != parentcstat[i] )
+            chgidx[nchgs++] = i;
+      }
+      for( i = 0; i < parent->nrows; ++i )
+      {
+         if( rstat[i] != parentrstat[i] )
+            chgidx[nchgs++] = parent->ncols + i;
+      }
+
+      SCIPsetFreeBufferArray(set, &parentrstat);
+      SCIPsetFreeBufferArray(set, &parentcstat);
+
+      /* store the basis completely if the changes do not save enough memory */
+      if( lpbasisCalcMem(nchgs, nchgs + ncols - parent->ncols + nrows - parent->nrows)
+         > LPBASIS_MAXDELTAFRAC * lpbasisCalcMem(0, ncols + nrows) )
+      {
+         SCIPsetFreeBufferArray(set, &chgidx);
+         parent = NULL;
+         nchgs = 0;
+      }
+   }
+
+   /* collect the status entries to pack */
+   nstats = (parent == NULL ? ncols + nrows : nchgs + ncols - parent->ncols + nrows - parent->nrows);
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &stats, nstats) );
+
+   pos = 0;
+   if( parent == NULL )
+   {
+      for( i = 0; i < ncols; ++i )
+         stats[pos++] = cstat[i];
+      for( i = 0; i < nrows; ++i )
+         stats[pos++] = rstat[i];
+   }
+   else
+   {
+      assert(chgidx != NULL || nchgs == 0);
+
+      for( i = 0; i < nchgs; ++i )
+         stats[pos++] = (chgidx[i] < parent->ncols ? cstat[chgidx[i]] : rstat[chgidx[i] - parent->ncols]); /*lint !e613*/
+      for( i = parent->ncols; i < ncols; ++i )
+         stats[pos++] = cstat[i];
+      for( i = parent->nrows; i < nrows; ++i )
+         stats[pos++] = rstat[i];
+   }
+   assert(pos == nstats);
+
+   /* create the basis */
+   SCIP_ALLOC( BMSallocBlockMemory(blkmem, basis) );
+   (*basis)->parent = parent;
+   (*basis)->packstat = NULL;
+   (*basis)->chgidx = NULL;
+   (*basis)->ncols = ncols;
+   (*basis)->nrows = nrows;
+   (*basis)->nchgs = nchgs;
+   (*basis)->ndeltas = (parent == NULL ? 0 : parent->ndeltas + 1);
+   (*basis)->nuses = 1;
+
+   if( nstats > 0 )
+   {
+      SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &(*basis)->packstat, (nstats + (int)SCIP_DUALPACKETSIZE - 1) / (int)SCIP_DUALPACKETSIZE) ); /*lint !e647*/
+      SCIPencodeDualBit(stats, (*basis)->packstat, nstats);
+   }
+   if( nchgs > 0 )
+   {
+      SCIP_ALLOC( BMSduplicateBlockMemoryArray(blkmem, &(*basis)->chgidx, chgidx, nchgs) );
+   }
+
+   /* the parent basis is needed as long as this basis exists */
+   if( parent != NULL )
+      SCIPlpbasisCapture(parent);
+
+   lp->basismem += lpbasisCalcMem(nchgs, nstats);
+
+   SCIPsetFreeBufferArray(set, &stats);
+   if( chgidx != NULL )
+   {
+      SCIPsetFreeBufferArray(set, &chgidx);
+   }
+   SCIPsetFreeBufferArray(set, &rstat);
+   SCIPsetFreeBufferArray(set, &cstat);
+
+   return SCIP_OKAY;
+}
+
+/** loads a basis into the solver; columns and rows of the current LP that are not contained in the basis get the
+ *  status that the LP interfaces use when loading a smaller LP state
+ */
+SCIP_RETCODE SCIPlpSetBasis(
+   SCIP_LP*              lp,                 /**< LP data */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_PROB*            prob,               /**< problem data */
+   SCIP_EVENTQUEUE*      eventqueue,         /**< event queue */
+   SCIP_LPBASIS*         basis,              /**< LP basis, or NULL */
+   SCIP_Bool             wasprimfeas,        /**< primal feasibility when the basis was stored */
+   SCIP_Bool             wasprimchecked,     /**< true if the LP solution has passed the primal feasibility check */
+   SCIP_Bool             wasdualfeas,        /**< dual feasibility when the basis was stored */
+   SCIP_Bool             wasdualchecked      /**< true if the LP solution has passed the dual feasibility check */
+   )
+{
+   assert(lp != NULL);
+   assert(blkmem != NULL);
+
+   /* flush changes to the LP solver */
+   SCIP_CALL( SCIPlpFlush(lp, blkmem, set, prob, eventqueue) );
+   assert(lp->flushed);
+
+   if( lp->solved && lp->solisbasic )
+      return SCIP_OKAY;
+
+   /* set basis in the LP solver */
+   if( basis == NULL || basis->ncols > lp->nlpicols || basis->nrows > lp->nlpirows )
+      lp->solisbasic = FALSE;
+   else
+   {
+      int* cstat;
+      int* rstat;
+      int c;
+      int r;
+
+      SCIP_CALL( SCIPsetAllocBufferArray(set, &cstat, lp->nlpicols) );
+      SCIP_CALL( SCIPsetAllocBufferArray(set, &rstat, lp->nlpirows) );
+
+      SCIP_CALL( lpbasisUnpack(basis, set, cstat, rstat) );
+
+      /* new columns are nonbasic at a finite bound, new rows are basic */
+      for( c = basis->ncols; c < lp->nlpicols; ++c )
+      {
+         if( !SCIPsetIsInfinity(set, -lp->lpicols[c]->flushedlb) )
+            cstat[c] = (int)SCIP_BASESTAT_LOWER;
+         else if( !SCIPsetIsInfinity(set, lp->lpicols[c]->flushedub) )
+            cstat[c] = (int)SCIP_BASESTAT_UPPER;
+         else
+            cstat[c] = (int)SCIP_BASESTAT_ZERO;
+      }
+      for( r = basis->nrows; r < lp->nlpirows; ++r )
+         rstat[r] = (int)SCIP_BASESTAT_BASIC;
+
+      SCIP_CALL( SCIPlpiSetBase(lp->lpi, cstat, rstat) );
+      lp->solisbasic = TRUE;
+
+      SCIPsetFreeBufferArray(set, &rstat);
+      SCIPsetFreeBufferArray(set, &cstat);
+   }
+
+   lp->primalfeasible = wasprimfeas;
+   lp->primalchecked = wasprimchecked;
+   lp->dualfeasible = wasdualfeas;
+   lp->dualchecked = wasdualchecked;
+
+   return SCIP_OKAY;
+}
+
+/** captures a basis */
+void SCIPlpbasisCapture(
+   SCIP_LPBASIS*         basis               /**< LP basis */
+   )
+{
+   assert(basis != NULL);
+   assert(basis->nuses >= 1);
+
+   ++basis->nuses;
+}
+
+/** releases a basis and frees it if it is not used anymore; the parent basis is released as well */
+void SCIPlpbasisRelease(
+   SCIP_LPBASIS**        basis,              /**< pointer to the LP basis */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_LP*              lp                  /**< LP data */
+   )
+{
+   SCIP_LPBASIS* parent;
+
+   assert(basis != NULL);
+   assert(lp != NULL);
+
+   parent = *basis;
+   *basis = NULL;
+
+   /* free the chain of bases that are not used anymore */
+   while( parent != NULL )
+   {
+      SCIP_LPBASIS* freebasis;
+      int nstats;
+
+      assert(parent->nuses >= 1);
+      if( --parent->nuses > 0 )
+         break;
+
+      freebasis = parent;
+      parent = freebasis->parent;
+
+      nstats = lpbasisGetNStats(freebasis);
+      lp->basismem -= lpbasisCalcMem(freebasis->nchgs, nstats);
+      assert(lp->basismem >= 0);
+
+      BMSfreeBlockMemoryArrayNull(blkmem, &freebasis->packstat, (nstats + (int)SCIP_DUALPACKETSIZE - 1) / (int)SCIP_DUALPACKETSIZE); /*lint !e647*/
+      BMSfreeBlockMemoryArrayNull(blkmem, &freebasis->chgidx, freebasis->nchgs);
+      BMSfreeBlockMemory(blkmem, &freebasis);
+   }
+}
+
+/** returns the memory in bytes used by the bases stored with SCIPlpGetBasis() that were not freed yet */
+SCIP_Longint SCIPlpGetBasisMem(
+   SCIP_LP*              lp                  /**< LP data */
+   )
+{
+   assert(lp != NULL);
+
+   return lp->basismem;
+}
+
+/** returns whether the basis stores only the changes to another basis */
+SCIP_Bool SCIPlpbasisIsDelta(
+   SCIP_LPBASIS*         basis               /**< LP basis */
+   )
+{
+   assert(basis != NULL);
+
+   return basis->parent != NULL;
+}
+
 /** interrupts the currently ongoing lp solve, or disables the interrupt */
 SCIP_RETCODE SCIPlpInterrupt(
    SCIP_LP*              lp,                 /**< LP data */
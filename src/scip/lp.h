@@ -947,6 +947,57 @@ SCIP_RETCODE SCIPlpFreeState(
    SCIP_LPISTATE**       lpistate            /**< pointer to LP state information (like basis information) */
    );
 
+/** stores the basis of the current LP in packed format; if a parent basis is given, whose columns and rows are the first
+ *  columns and rows of the current LP, only the changes to the parent basis are stored if this needs less memory
+ *
+ *  If the current LP solution is not basic or the LP is empty, no basis is stored and NULL is returned.
+ */
+SCIP_RETCODE SCIPlpGetBasis(
+   SCIP_LP*              lp,                 /**< LP data */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_LPBASIS*         parent,             /**< basis the changes may refer to, or NULL */
+   SCIP_LPBASIS**        basis               /**< pointer to store the basis, or NULL if no basis is available */
+   );
+
+/** loads a basis into the solver; columns and rows of the current LP that are not contained in the basis get the
+ *  status that the LP interfaces use when loading a smaller LP state
+ */
+SCIP_RETCODE SCIPlpSetBasis(
+   SCIP_LP*              lp,                 /**< LP data */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_PROB*            prob,               /**< problem data */
+   SCIP_EVENTQUEUE*      eventqueue,         /**< event queue */
+   SCIP_LPBASIS*         basis,              /**< LP basis, or NULL */
+   SCIP_Bool             wasprimfeas,        /**< primal feasibility when the basis was stored */
+   SCIP_Bool             wasprimchecked,     /**< true if the LP solution has passed the primal feasibility check */
+   SCIP_Bool             wasdualfeas,        /**< dual feasibility when the basis was stored */
+   SCIP_Bool             wasdualchecked      /**< true if the LP solution has passed the dual feasibility check */
+   );
+
+/** captures a basis */
+void SCIPlpbasisCapture(
+   SCIP_LPBASIS*         basis               /**< LP basis */
+   );
+
+/** releases a basis and frees it if it is not used anymore; the parent basis is released as well */
+void SCIPlpbasisRelease(
+   SCIP_LPBASIS**        basis,              /**< pointer to the LP basis */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_LP*              lp                  /**< LP data */
+   );
+
+/** returns the memory in bytes used by the bases stored with SCIPlpGetBasis() that were not freed yet */
+SCIP_Longint SCIPlpGetBasisMem(
+   SCIP_LP*              lp                  /**< LP data */
+   );
+
+/** returns whether the basis stores only the changes to another basis */
+SCIP_Bool SCIPlpbasisIsDelta(
+   SCIP_LPBASIS*         basis               /**< LP basis */
+   );
+
 /** interrupts the currently ongoing lp solve or disables the interrupt */
 SCIP_RETCODE SCIPlpInterrupt(
    SCIP_LP*              lp,                 /**< LP data */
@@ -32,6 +32,7 @@
 /*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
 
 #include <assert.h>
+#include <string.h>
 
 #include "scip/def.h"
 #include "scip/mem.h"
@@ -56,11 +57,19 @@ SCIP_RETCODE SCIPmemCreate(
    SCIP_ALLOC( (*mem)->buffer = BMScreateBufferMemory(SCIP_DEFAULT_MEM_ARRAYGROWFAC, SCIP_DEFAULT_MEM_ARRAYGROWINIT, FALSE) );
    SCIP_ALLOC( (*mem)->cleanbuffer = BMScreateBufferMemory(SCIP_DEFAULT_MEM_ARRAYGROWFAC, SCIP_DEFAULT_MEM_ARRAYGROWINIT, TRUE) );
 
+   /* alloc node memory */
+   SCIP_ALLOC( (*mem)->nodemem = BMScreateArenaMemory(SCIP_DEFAULT_MEM_NODEBLOCKSIZE) );
+
+   /* alloc memory account, which is only attached if requested */
+   SCIP_ALLOC( (*mem)->account = BMScreateMemoryAccount() );
+   (*mem)->accounting = FALSE;
+
    SCIPdebugMessage("created setmem   block memory at <%p>\n", (void*)(*mem)->setmem);
    SCIPdebugMessage("created probmem  block memory at <%p>\n", (void*)(*mem)->probmem);
 
    SCIPdebugMessage("created       buffer memory at <%p>\n", (void*)(*mem)->buffer);
    SCIPdebugMessage("created clean buffer memory at <%p>\n", (void*)(*mem)->cleanbuffer);
+   SCIPdebugMessage("created   node arena memory at <%p>\n", (void*)(*mem)->nodemem);
 
    return SCIP_OKAY;
 }
@@ -74,6 +83,9 @@ SCIP_RETCODE SCIPmemFree(
    if( *mem == NULL )
       return SCIP_OKAY;
 
+   /* free node memory */
+   BMSdestroyArenaMemory(&(*mem)->nodemem);
+
    /* free memory buffers */
    BMSdestroyBufferMemory(&(*mem)->cleanbuffer);
    BMSdestroyBufferMemory(&(*mem)->buffer);
@@ -88,6 +100,9 @@ SCIP_RETCODE SCIPmemFree(
    BMSdestroyBlockMemory(&(*mem)->probmem);
    BMSdestroyBlockMemory(&(*mem)->setmem);
 
+   /* free memory account */
+   BMSdestroyMemoryAccount(&(*mem)->account);
+
    BMSfreeMemory(mem);
 
    return SCIP_OKAY;
@@ -101,7 +116,8 @@ SCIP_Longint SCIPmemGetUsed(
    assert(mem != NULL);
 
    return BMSgetBlockMemoryUsed(mem->setmem) + BMSgetBlockMemoryUsed(mem->probmem)
-      + BMSgetBufferMemoryUsed(mem->buffer) + BMSgetBufferMemoryUsed(mem->cleanbuffer);
+      + BMSgetBufferMemoryUsed(mem->buffer) + BMSgetBufferMemoryUsed(mem->cleanbuffer)
+      + BMSgetArenaMemoryUsed(mem->nodemem);
 }
 
 /** returns the total number of bytes in block and buffer memory */
@@ -112,7 +128,8 @@ SCIP_Longint SCIPmemGetTotal(
    assert(mem != NULL);
 
    return BMSgetBlockMemoryAllocated(mem->setmem) + BMSgetBlockMemoryAllocated(mem->probmem)
-      + BMSgetBufferMemoryUsed(mem->buffer) + BMSgetBufferMemoryUsed(mem->cleanbuffer);
+      + BMSgetBufferMemoryUsed(mem->buffer) + BMSgetBufferMemoryUsed(mem->cleanbuffer)
+      + BMSgetArenaMemoryUsed(mem->nodemem);
 }
 
 /** returns the maximal number of used bytes in block memory */
@@ -144,3 +161,121 @@ SCIP_Longint SCIPmemGetAllocatedBlockmemoryMax(
 
    return BMSgetBlockMemoryAllocatedMax(mem->setmem) + BMSgetBlockMemoryAllocatedMax(mem->probmem);
 }
+
+/** enables or disables the accounting of the problem and buffer memory per source file; enabling resets the account */
+void SCIPmemSetAccounting(
+   SCIP_MEM*             mem,                /**< pointer to block and buffer memory structure */
+   SCIP_Bool             enable              /**< should memory be accounted per source file? */
+   )
+{
+   assert(mem != NULL);
+
+   if( enable == mem->accounting )
+      return;
+
+   if( enable )
+      BMSclearMemoryAccount(mem->account);
+
+   BMSsetBlockMemoryAccount(mem->probmem, enable ? mem->account : NULL);
+   BMSsetBufferMemoryAccount(mem->buffer, enable ? mem->account : NULL);
+   BMSsetBufferMemoryAccount(mem->cleanbuffer, enable ? mem->account : NULL);
+
+   mem->accounting = enable;
+}
+
+/** returns the owner of the given source file, i.e., its base name without directory and extension */
+const char* SCIPmemGetFileOwner(
+   const char*           filename,           /**< name of the source file */
+   int*                  len                 /**< pointer to store the length of the owner name */
+   )
+{
+   const char* owner;
+   const char* ext;
+
+   assert(filename != NULL);
+   assert(len != NULL);
+
+   owner = filename;
+   for( ext = filename; *ext != '\0'; ++ext )
+   {
+      if( *ext == '/' || *ext == '\\' )
+         owner = ext + 1;
+   }
+
+   ext = strrchr(owner, '.');
+   *len = (ext != NULL ? (int)(ext - owner) : (int)strlen(owner));
+
+   return owner;
+}
+
+/** sums up the used and maximal used bytes of all source files of the given owner */
+static
+void memGetOwnerUsage(
+   SCIP_MEM*             mem,                /**< pointer to block and buffer memory structure */
+   const char*           owner,              /**< owner, i.e., base name of source file without extension */
+   SCIP_Longint*         used,               /**< pointer to store the number of used bytes */
+   SCIP_Longint*         maxused             /**< pointer to store the maximal number of used bytes */
+   )
+{
+   int ownerlen;
+   int i;
+
+   assert(mem != NULL);
+   assert(owner != NULL);
+   assert(used != NULL);
+   assert(maxused != NULL);
+
+   *used = 0;
+   *maxused = 0;
+
+   if( !mem->accounting )
+      return;
+
+   ownerlen = (int)strlen(owner);
+
+   for( i = 0; i < BMSgetMemoryAccountNFiles(mem->account); ++i )
+   {
+      const char* fileowner;
+      int len;
+
+      fileowner = SCIPmemGetFileOwner(BMSgetMemoryAccountFile(mem->account, i), &len);
+
+      if( len == ownerlen && strncmp(fileowner, owner, (size_t)len) == 0 )
+      {
+         *used += BMSgetMemoryAccountUsed(mem->account, i);
+         *maxused += BMSgetMemoryAccountUsedMax(mem->account, i);
+      }
+   }
+}
+
+/** returns the number of bytes of problem and buffer memory currently used by the given owner, or 0 if memory
+ *  accounting is disabled
+ */
+SCIP_Longint SCIPmemGetUsedOwner(
+   SCIP_MEM*             mem,                /**< pointer to block and buffer memory structure */
+   const char*           owner               /**< owner, i.e., base name of source file without extension */
+   )
+{
+   SCIP_Longint used;
+   SCIP_Longint maxused;
+
+   memGetOwnerUsage(mem, owner, &used, &maxused);
+
+   return used;
+}
+
+/** returns the maximal number of bytes of problem and buffer memory used by the given owner, or 0 if memory
+ *  accounting is disabled
+ */
+SCIP_Longint SCIPmemGetUsedMaxOwner(
+   SCIP_MEM*             mem,                /**< pointer to block and buffer memory structure */
+   const char*           owner               /**< owner, i.e., base name of source file without extension */
+   )
+{
+   SCIP_Longint used;
+   SCIP_Longint maxused;
+
+   memGetOwnerUsage(mem, owner, &used, &maxused);
+
+   return maxused;
+}
@@ -78,6 +78,34 @@ SCIP_Longint SCIPmemGetAllocatedBlockmemoryMax(
    SCIP_MEM*             mem                 /**< pointer to block and buffer memory structure */
    );
 
+/** enables or disables the accounting of the problem and buffer memory per source file; enabling resets the account */
+void SCIPmemSetAccounting(
+   SCIP_MEM*             mem,                /**< pointer to block and buffer memory structure */
+   SCIP_Bool             enable              /**< should memory be accounted per source file? */
+   );
+
+/** returns the owner of the given source file, i.e., its base name without directory and extension */
+const char* SCIPmemGetFileOwner(
+   const char*           filename,           /**< name of the source file */
+   int*                  len                 /**< pointer to store the length of the owner name */
+   );
+
+/** returns the number of bytes of problem and buffer memory currently used by the given owner, or 0 if memory
+ *  accounting is disabled
+ */
+SCIP_Longint SCIPmemGetUsedOwner(
+   SCIP_MEM*             mem,                /**< pointer to block and buffer memory structure */
+   const char*           owner               /**< owner, i.e., base name of source file without extension */
+   );
+
+/** returns the maximal number of bytes of problem and buffer memory used by the given owner, or 0 if memory
+ *  accounting is disabled
+ */
+SCIP_Longint SCIPmemGetUsedMaxOwner(
+   SCIP_MEM*             mem,                /**< pointer to block and buffer memory structure */
+   const char*           owner               /**< owner, i.e., base name of source file without extension */
+   );
+
 #ifdef __cplusplus
 }
 #endif
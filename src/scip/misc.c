@@ -48,6 +48,7 @@
 #include "scip/misc.h"
 #include "scip/intervalarith.h"
 #include "scip/pub_misc.h"
+#include "tpi/tpi.h"
 
 #ifndef NDEBUG
 #include "scip/struct_misc.h"
@@ -3643,6 +3644,725 @@ SCIP_RETCODE SCIPhashmapRemoveAll(
 }
 
 
+/*
+ * Concurrent Hash Table and Hash Map
+ */
+
+#define MAXCONCHASHSTRIPES   1024 /**< maximal number of stripes of a concurrent hash table or hash map */
+
+/** returns the stripe of a concurrent hash table or hash map that stores the key with the given key value
+ *
+ *  The stripe is taken from the low bits of the hash value, while the hash tables of the stripes use its high bits for
+ *  the position of the key.
+ */
+static
+uint32_t concStripe(
+   uint64_t              keyval,             /**< key value */
+   uint32_t              mask                /**< mask of the stripes, i.e. nstripes - 1 */
+   )
+{
+   return (hashvalue(keyval) >> 1) & mask;
+}
+
+/** returns the number of stripes to use, i.e. the given number rounded up to a power of two */
+static
+uint32_t concNStripes(
+   int                   nstripes            /**< requested number of stripes */
+   )
+{
+   uint32_t n = 1;
+
+   while( n < (uint32_t)MIN(nstripes, MAXCONCHASHSTRIPES) )
+      n <<= 1;
+
+   return n;
+}
+
+/** creates the block memories and the locks of the stripes of a concurrent hash table or hash map */
+static
+SCIP_RETCODE concStripesCreate(
+   BMS_BLKMEM*           blkmem,             /**< block memory to store the arrays */
+   BMS_BLKMEM***         blkmems,            /**< pointer to store the block memories of the stripes */
+   SCIP_LOCK***          locks,              /**< pointer to store the locks of the stripes */
+   uint32_t              nstripes            /**< number of stripes */
+   )
+{
+   uint32_t s;
+
+   SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, blkmems, nstripes) );
+   SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, locks, nstripes) );
+
+   for( s = 0; s < nstripes; ++s )
+   {
+      (*blkmems)[s] = BMScreateBlockMemory(1, 10);
+      if( (*blkmems)[s] == NULL )
+         return SCIP_NOMEMORY;
+
+      SCIP_CALL( SCIPtpiInitLock(&(*locks)[s]) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** frees the block memories and the locks of the stripes of a concurrent hash table or hash map */
+static
+void concStripesFree(
+   BMS_BLKMEM*           blkmem,             /**< block memory of the arrays */
+   BMS_BLKMEM***         blkmems,            /**< pointer to the block memories of the stripes */
+   SCIP_LOCK***          locks,              /**< pointer to the locks of the stripes */
+   uint32_t              nstripes            /**< number of stripes */
+   )
+{
+   uint32_t s;
+
+   for( s = 0; s < nstripes; ++s )
+   {
+      SCIPtpiDestroyLock(&(*locks)[s]);
+      BMSdestroyBlockMemory(&(*blkmems)[s]);
+   }
+
+   BMSfreeBlockMemoryArray(blkmem, locks, nstripes);
+   BMSfreeBlockMemoryArray(blkmem, blkmems, nstripes);
+}
+
+/** creates a concurrent hash table
+ *
+ *  The elements are distributed over the given number of stripes, rounded up to a power of two. Each stripe is a hash
+ *  table with its own lock and block memory, such that threads accessing different stripes do not wait for each other.
+ *  A small multiple of the number of threads is a reasonable number of stripes. The callbacks may be called by several
+ *  threads at the same time.
+ */
+SCIP_RETCODE SCIPconchashtableCreate(
+   SCIP_CONCHASHTABLE**  hashtable,          /**< pointer to store the created concurrent hash table */
+   BMS_BLKMEM*           blkmem,             /**< block memory used to store the concurrent hash table */
+   int                   tablesize,          /**< size of the hash table */
+   int                   nstripes,           /**< number of stripes, i.e., independently locked parts of the table */
+   SCIP_DECL_HASHGETKEY((*hashgetkey)),      /**< gets the key of the given element */
+   SCIP_DECL_HASHKEYEQ ((*hashkeyeq)),       /**< returns TRUE iff both keys are equal */
+   SCIP_DECL_HASHKEYVAL((*hashkeyval)),      /**< returns the hash value of the key */
+   void*                 userptr             /**< user pointer */
+   )
+{
+   uint32_t s;
+
+   assert(hashtable != NULL);
+   assert(blkmem != NULL);
+   assert(tablesize >= 0);
+   assert(nstripes >= 1);
+   assert(hashgetkey != NULL);
+   assert(hashkeyeq != NULL);
+   assert(hashkeyval != NULL);
+
+   SCIP_ALLOC( BMSallocBlockMemory(blkmem, hashtable) );
+
+   (*hashtable)->blkmem = blkmem;
+   (*hashtable)->hashgetkey = hashgetkey;
+   (*hashtable)->hashkeyval = hashkeyval;
+   (*hashtable)->userptr = userptr;
+   (*hashtable)->mask = concNStripes(nstripes) - 1;
+
+   SCIP_CALL( concStripesCreate(blkmem, &(*hashtable)->blkmems, &(*hashtable)->locks, (*hashtable)->mask + 1) );
+   SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &(*hashtable)->tables, (*hashtable)->mask + 1) );
+
+   for( s = 0; s <= (*hashtable)->mask; ++s )
+   {
+      SCIP_CALL( SCIPhashtableCreate(&(*hashtable)->tables[s], (*hashtable)->blkmems[s],
+            (int)(tablesize / ((*hashtable)->mask + 1)), hashgetkey, hashkeyeq, hashkeyval, userptr) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** frees the concurrent hash table; must not be called while other threads access the table */
+void SCIPconchashtableFree(
+   SCIP_CONCHASHTABLE**  hashtable           /**< pointer to the concurrent hash table */
+   )
+{
+   uint32_t s;
+
+   assert(hashtable != NULL);
+   assert(*hashtable != NULL);
+
+   for( s = 0; s <= (*hashtable)->mask; ++s )
+      SCIPhashtableFree(&(*hashtable)->tables[s]);
+
+   BMSfreeBlockMemoryArray((*hashtable)->blkmem, &(*hashtable)->tables, (*hashtable)->mask + 1);
+   concStripesFree((*hashtable)->blkmem, &(*hashtable)->blkmems, &(*hashtable)->locks, (*hashtable)->mask + 1);
+   BMSfreeBlockMemory((*hashtable)->blkmem, hashtable);
+}
+
+/** returns the stripe of the concurrent hash table that stores the given key */
+static
+uint32_t conchashtableStripe(
+   SCIP_CONCHASHTABLE*   hashtable,          /**< concurrent hash table */
+   void*                 key                 /**< key */
+   )
+{
+   return concStripe(hashtable->hashkeyval(hashtable->userptr, key), hashtable->mask);
+}
+
+/** inserts element in the concurrent hash table
+ *
+ *  @note multiple inserts of same element overrides previous one
+ */
+SCIP_RETCODE SCIPconchashtableInsert(
+   SCIP_CONCHASHTABLE*   hashtable,          /**< concurrent hash table */
+   void*                 element             /**< element to insert into the table */
+   )
+{
+   SCIP_RETCODE retcode;
+   uint32_t s;
+
+   assert(hashtable != NULL);
+   assert(element != NULL);
+
+   s = conchashtableStripe(hashtable, hashtable->hashgetkey(hashtable->userptr, element));
+
+   SCIP_CALL( SCIPtpiAcquireLock(hashtable->locks[s]) );
+   retcode = SCIPhashtableInsert(hashtable->tables[s], element);
+   SCIP_CALL( SCIPtpiReleaseLock(hashtable->locks[s]) );
+
+   return retcode;
+}
+
+/** inserts element in the concurrent hash table
+ *
+ *  @note multiple insertion of same element is checked and results in an error
+ */
+SCIP_RETCODE SCIPconchashtableSafeInsert(
+   SCIP_CONCHASHTABLE*   hashtable,          /**< concurrent hash table */
+   void*                 element             /**< element to insert into the table */
+   )
+{
+   SCIP_RETCODE retcode;
+   uint32_t s;
+
+   assert(hashtable != NULL);
+   assert(element != NULL);
+
+   s = conchashtableStripe(hashtable, hashtable->hashgetkey(hashtable->userptr, element));
+
+   SCIP_CALL( SCIPtpiAcquireLock(hashtable->locks[s]) );
+   retcode = SCIPhashtableSafeInsert(hashtable->tables[s], element);
+   SCIP_CALL( SCIPtpiReleaseLock(hashtable->locks[s]) );
+
+   return retcode;
+}
+
+/** retrieves the element with the key of the given element, and inserts the given element if there is no such element
+ *
+ *  Both happens atomically, such that of several threads inserting elements with equal keys exactly one inserts its
+ *  element and all others get this element.
+ */
+SCIP_RETCODE SCIPconchashtableRetrieveOrInsert(
+   SCIP_CONCHASHTABLE*   hashtable,          /**< concurrent hash table */
+   void*                 element,            /**< element to insert into the table */
+   void**                stored              /**< pointer to store the element of the table with the key of the given
+                                              *   element, which is the given element if it was inserted */
+   )
+{
+   SCIP_RETCODE retcode = SCIP_OKAY;
+   void* key;
+   uint32_t s;
+
+   assert(hashtable != NULL);
+   assert(element != NULL);
+   assert(stored != NULL);
+
+   key = hashtable->hashgetkey(hashtable->userptr, element);
+   s = conchashtableStripe(hashtable, key);
+
+   SCIP_CALL( SCIPtpiAcquireLock(hashtable->locks[s]) );
+   *stored = SCIPhashtableRetrieve(hashtable->tables[s], key);
+   if( *stored == NULL )
+   {
+      retcode = SCIPhashtableInsert(hashtable->tables[s], element);
+      *stored = element;
+   }
+   SCIP_CALL( SCIPtpiReleaseLock(hashtable->locks[s]) );
+
+   return retcode;
+}
+
+/** retrieve element with key from the concurrent hash table, returns NULL if not existing */
+void* SCIPconchashtableRetrieve(
+   SCIP_CONCHASHTABLE*   hashtable,          /**< concurrent hash table */
+   void*                 key                 /**< key to retrieve */
+   )
+{
+   void* element;
+   uint32_t s;
+
+   assert(hashtable != NULL);
+   assert(key != NULL);
+
+   s = conchashtableStripe(hashtable, key);
+
+   SCIP_CALL_ABORT( SCIPtpiAcquireLock(hashtable->locks[s]) );
+   element = SCIPhashtableRetrieve(hashtable->tables[s], key);
+   SCIP_CALL_ABORT( SCIPtpiReleaseLock(hashtable->locks[s]) );
+
+   return element;
+}
+
+/** returns whether the given element exists in the concurrent hash table */
+SCIP_Bool SCIPconchashtableExists(
+   SCIP_CONCHASHTABLE*   hashtable,          /**< concurrent hash table */
+   void*                 element             /**< element to search in the table */
+   )
+{
+   assert(hashtable != NULL);
+   assert(element != NULL);
+
+   return (SCIPconchashtableRetrieve(hashtable, hashtable->hashgetkey(hashtable->userptr, element)) != NULL);
+}
+
+/** removes element from the concurrent hash table, if it exists */
+SCIP_RETCODE SCIPconchashtableRemove(
+   SCIP_CONCHASHTABLE*   hashtable,          /**< concurrent hash table */
+   void*                 element             /**< element to remove from the table */
+   )
+{
+   SCIP_RETCODE retcode;
+   uint32_t s;
+
+   assert(hashtable != NULL);
+   assert(element != NULL);
+
+   s = conchashtableStripe(hashtable, hashtable->hashgetkey(hashtable->userptr, element));
+
+   SCIP_CALL( SCIPtpiAcquireLock(hashtable->locks[s]) );
+   retcode = SCIPhashtableRemove(hashtable->tables[s], element);
+   SCIP_CALL( SCIPtpiReleaseLock(hashtable->locks[s]) );
+
+   return retcode;
+}
+
+/** removes all elements of the concurrent hash table */
+SCIP_RETCODE SCIPconchashtableRemoveAll(
+   SCIP_CONCHASHTABLE*   hashtable           /**< concurrent hash table */
+   )
+{
+   uint32_t s;
+
+   assert(hashtable != NULL);
+
+   for( s = 0; s <= hashtable->mask; ++s )
+   {
+      SCIP_CALL( SCIPtpiAcquireLock(hashtable->locks[s]) );
+      SCIPhashtableRemoveAll(hashtable->tables[s]);
+      SCIP_CALL( SCIPtpiReleaseLock(hashtable->locks[s]) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** returns number of elements of the concurrent hash table
+ *
+ *  @note while other threads modify the table, the result is only a snapshot of each stripe at a different time
+ */
+SCIP_Longint SCIPconchashtableGetNElements(
+   SCIP_CONCHASHTABLE*   hashtable           /**< concurrent hash table */
+   )
+{
+   SCIP_Longint nelements = 0;
+   uint32_t s;
+
+   assert(hashtable != NULL);
+
+   for( s = 0; s <= hashtable->mask; ++s )
+   {
+      SCIP_CALL_ABORT( SCIPtpiAcquireLock(hashtable->locks[s]) );
+      nelements += SCIPhashtableGetNElements(hashtable->tables[s]);
+      SCIP_CALL_ABORT( SCIPtpiReleaseLock(hashtable->locks[s]) );
+   }
+
+   return nelements;
+}
+
+/** returns the number of stripes of the concurrent hash table */
+int SCIPconchashtableGetNStripes(
+   SCIP_CONCHASHTABLE*   hashtable           /**< concurrent hash table */
+   )
+{
+   assert(hashtable != NULL);
+
+   return (int)hashtable->mask + 1;
+}
+
+/** creates a concurrent hash map mapping pointers to pointers
+ *
+ *  The entries are distributed over the given number of stripes, rounded up to a power of two. Each stripe is a hash
+ *  map with its own lock and block memory, such that threads accessing different stripes do not wait for each other.
+ */
+SCIP_RETCODE SCIPconchashmapCreate(
+   SCIP_CONCHASHMAP**    hashmap,            /**< pointer to store the created concurrent hash map */
+   BMS_BLKMEM*           blkmem,             /**< block memory used to store the concurrent hash map */
+   int                   mapsize,            /**< size of the hash map */
+   int                   nstripes            /**< number of stripes, i.e., independently locked parts of the map */
+   )
+{
+   uint32_t s;
+
+   assert(hashmap != NULL);
+   assert(blkmem != NULL);
+   assert(mapsize >= 0);
+   assert(nstripes >= 1);
+
+   SCIP_ALLOC( BMSallocBlockMemory(blkmem, hashmap) );
+
+   (*hashmap)->blkmem = blkmem;
+   (*hashmap)->mask = concNStripes(nstripes) - 1;
+
+   SCIP_CALL( concStripesCreate(blkmem, &(*hashmap)->blkmems, &(*hashmap)->locks, (*hashmap)->mask + 1) );
+   SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &(*hashmap)->maps, (*hashmap)->mask + 1) );
+
+   for( s = 0; s <= (*hashmap)->mask; ++s )
+   {
+      SCIP_CALL( SCIPhashmapCreate(&(*hashmap)->maps[s], (*hashmap)->blkmems[s],
+            (int)(mapsize / ((*hashmap)->mask + 1))) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** frees the concurrent hash map; must not be called while other threads access the map */
+void SCIPconchashmapFree(
+   SCIP_CONCHASHMAP**    hashmap             /**< pointer to the concurrent hash map */
+   )
+{
+   uint32_t s;
+
+   assert(hashmap != NULL);
+   assert(*hashmap != NULL);
+
+   for( s = 0; s <= (*hashmap)->mask; ++s )
+      SCIPhashmapFree(&(*hashmap)->maps[s]);
+
+   BMSfreeBlockMemoryArray((*hashmap)->blkmem, &(*hashmap)->maps, (*hashmap)->mask + 1);
+   concStripesFree((*hashmap)->blkmem, &(*hashmap)->blkmems, &(*hashmap)->locks, (*hashmap)->mask + 1);
+   BMSfreeBlockMemory((*hashmap)->blkmem, hashmap);
+}
+
+/** inserts new origin->image pair in the concurrent hash map
+ *
+ *  @note multiple insertion of same element is checked and results in an error
+ */
+SCIP_RETCODE SCIPconchashmapInsert(
+   SCIP_CONCHASHMAP*     hashmap,            /**< concurrent hash map */
+   void*                 origin,             /**< origin to set image for */
+   void*                 image               /**< new image for origin */
+   )
+{
+   SCIP_RETCODE retcode;
+   uint32_t s;
+
+   assert(hashmap != NULL);
+
+   s = concStripe((size_t)origin, hashmap->mask);
+
+   SCIP_CALL( SCIPtpiAcquireLock(hashmap->locks[s]) );
+   retcode = SCIPhashmapInsert(hashmap->maps[s], origin, image);
+   SCIP_CALL( SCIPtpiReleaseLock(hashmap->locks[s]) );
+
+   return retcode;
+}
+
+/** inserts new origin->image pair in the concurrent hash map
+ *
+ *  @note multiple insertion of same element is checked and results in an error
+ */
+SCIP_RETCODE SCIPconchashmapInsertInt(
+   SCIP_CONCHASHMAP*     hashmap,            /**< concurrent hash map */
+   void*                 origin,             /**< origin to set image for */
+   int                   image               /**< new image for origin */
+   )
+{
+   SCIP_RETCODE retcode;
+   uint32_t s;
+
+   assert(hashmap != NULL);
+
+   s = concStripe((size_t)origin, hashmap->mask);
+
+   SCIP_CALL( SCIPtpiAcquireLock(hashmap->locks[s]) );
+   retcode = SCIPhashmapInsertInt(hashmap->maps[s], origin, image);
+   SCIP_CALL( SCIPtpiReleaseLock(hashmap->locks[s]) );
+
+   return retcode;
+}
+
+/** inserts new origin->image pair in the concurrent hash map
+ *
+ *  @note multiple insertion of same element is checked and results in an error
+ */
+SCIP_RETCODE SCIPconchashmapInsertReal(
+   SCIP_CONCHASHMAP*     hashmap,            /**< concurrent hash map */
+   void*                 origin,             /**< origin to set image for */
+   SCIP_Real             image               /**< new image for origin */
+   )
+{
+   SCIP_RETCODE retcode;
+   uint32_t s;
+
+   assert(hashmap != NULL);
+
+   s = concStripe((size_t)origin, hashmap->mask);
+
+   SCIP_CALL( SCIPtpiAcquireLock(hashmap->locks[s]) );
+   retcode = SCIPhashmapInsertReal(hashmap->maps[s], origin, image);
+   SCIP_CALL( SCIPtpiReleaseLock(hashmap->locks[s]) );
+
+   return retcode;
+}
+
+/** retrieves image of given origin from the concurrent hash map, or NULL if no image exists */
+void* SCIPconchashmapGetImage(
+   SCIP_CONCHASHMAP*     hashmap,            /**< concurrent hash map */
+   void*                 origin              /**< origin to retrieve image for */
+   )
+{
+   void* image;
+   uint32_t s;
+
+   assert(hashmap != NULL);
+
+   s = concStripe((size_t)origin, hashmap->mask);
+
+   SCIP_CALL_ABORT( SCIPtpiAcquireLock(hashmap->locks[s]) );
+   image = SCIPhashmapGetImage(hashmap->maps[s], origin);
+   SCIP_CALL_ABORT( SCIPtpiReleaseLock(hashmap->locks[s]) );
+
+   return image;
+}
+
+/** retrieves image of given origin from the concurrent hash map, or INT_MAX if no image exists */
+int SCIPconchashmapGetImageInt(
+   SCIP_CONCHASHMAP*     hashmap,            /**< concurrent hash map */
+   void*                 origin              /**< origin to retrieve image for */
+   )
+{
+   int image;
+   uint32_t s;
+
+   assert(hashmap != NULL);
+
+   s = concStripe((size_t)origin, hashmap->mask);
+
+   SCIP_CALL_ABORT( SCIPtpiAcquireLock(hashmap->locks[s]) );
+   image = SCIPhashmapGetImageInt(hashmap->maps[s], origin);
+   SCIP_CALL_ABORT( SCIPtpiReleaseLock(hashmap->locks[s]) );
+
+   return image;
+}
+
+/** retrieves image of given origin from the concurrent hash map, or SCIP_INVALID if no image exists */
+SCIP_Real SCIPconchashmapGetImageReal(
+   SCIP_CONCHASHMAP*     hashmap,            /**< concurrent hash map */
+   void*                 origin              /**< origin to retrieve image for */
+   )
+{
+   SCIP_Real image;
+   uint32_t s;
+
+   assert(hashmap != NULL);
+
+   s = concStripe((size_t)origin, hashmap->mask);
+
+   SCIP_CALL_ABORT( SCIPtpiAcquireLock(hashmap->locks[s]) );
+   image = SCIPhashmapGetImageReal(hashmap->maps[s], origin);
+   SCIP_CALL_ABORT( SCIPtpiReleaseLock(hashmap->locks[s]) );
+
+   return image;
+}
+
+/** sets image for given origin in the concurrent hash map, either by modifying existing origin->image pair or by
+ *  appending a new origin->image pair
+ */
+SCIP_RETCODE SCIPconchashmapSetImage(
+   SCIP_CONCHASHMAP*     hashmap,            /**< concurrent hash map */
+   void*                 origin,             /**< origin to set image for */
+   void*                 image               /**< new image for origin */
+   )
+{
+   SCIP_RETCODE retcode;
+   uint32_t s;
+
+   assert(hashmap != NULL);
+
+   s = concStripe((size_t)origin, hashmap->mask);
+
+   SCIP_CALL( SCIPtpiAcquireLock(hashmap->locks[s]) );
+   retcode = SCIPhashmapSetImage(hashmap->maps[s], origin, image);
+   SCIP_CALL( SCIPtpiReleaseLock(hashmap->locks[s]) );
+
+   return retcode;
+}
+
+/** sets image for given origin in the concurrent hash map, either by modifying existing origin->image pair or by
+ *  appending a new origin->image pair
+ */
+SCIP_RETCODE SCIPconchashmapSetImageInt(
+   SCIP_CONCHASHMAP*     hashmap,            /**< concurrent hash map */
+   void*                 origin,             /**< origin to set image for */
+   int                   image               /**< new image for origin */
+   )
+{
+   SCIP_RETCODE retcode;
+   uint32_t s;
+
+   assert(hashmap != NULL);
+
+   s = concStripe((size_t)origin, hashmap->mask);
+
+   SCIP_CALL( SCIPtpiAcquireLock(hashmap->locks[s]) );
+   retcode = SCIPhashmapSetImageInt(hashmap->maps[s], origin, image);
+   SCIP_CALL( SCIPtpiReleaseLock(hashmap->locks[s]) );
+
+   return retcode;
+}
+
+/** sets image for given origin in the concurrent hash map, either by modifying existing origin->image pair or by
+ *  appending a new origin->image pair
+ */
+SCIP_RETCODE SCIPconchashmapSetImageReal(
+   SCIP_CONCHASHMAP*     hashmap,            /**< concurrent hash map */
+   void*                 origin,             /**< origin to set image for */
+   SCIP_Real             image               /**< new image for origin */
+   )
+{
+   SCIP_RETCODE retcode;
+   uint32_t s;
+
+   assert(hashmap != NULL);
+
+   s = concStripe((size_t)origin, hashmap->mask);
+
+   SCIP_CALL( SCIPtpiAcquireLock(hashmap->locks[s]) );
+   retcode = SCIPhashmapSetImageReal(hashmap->maps[s], origin, image);
+   SCIP_CALL( SCIPtpiReleaseLock(hashmap->locks[s]) );
+
+   return retcode;
+}
+
+/** adds the given increment to the integer image of the given origin in the concurrent hash map, where a missing
+ *  origin has image 0, and returns the previous image
+ *
+ *  In contrast to a combination of SCIPconchashmapGetImageInt() and SCIPconchashmapSetImageInt(), no increments of
+ *  other threads are lost.
+ */
+SCIP_RETCODE SCIPconchashmapAddImageInt(
+   SCIP_CONCHASHMAP*     hashmap,            /**< concurrent hash map */
+   void*                 origin,             /**< origin to modify the image of */
+   int                   increment,          /**< increment of the image */
+   int*                  oldimage            /**< pointer to store the previous image, or NULL */
+   )
+{
+   SCIP_RETCODE retcode;
+   int image;
+   uint32_t s;
+
+   assert(hashmap != NULL);
+
+   s = concStripe((size_t)origin, hashmap->mask);
+
+   SCIP_CALL( SCIPtpiAcquireLock(hashmap->locks[s]) );
+   image = SCIPhashmapExists(hashmap->maps[s], origin) ? SCIPhashmapGetImageInt(hashmap->maps[s], origin) : 0;
+   retcode = SCIPhashmapSetImageInt(hashmap->maps[s], origin, image + increment);
+   SCIP_CALL( SCIPtpiReleaseLock(hashmap->locks[s]) );
+
+   if( oldimage != NULL )
+      *oldimage = image;
+
+   return retcode;
+}
+
+/** checks whether an image to the given origin exists in the concurrent hash map */
+SCIP_Bool SCIPconchashmapExists(
+   SCIP_CONCHASHMAP*     hashmap,            /**< concurrent hash map */
+   void*                 origin              /**< origin to search for */
+   )
+{
+   SCIP_Bool exists;
+   uint32_t s;
+
+   assert(hashmap != NULL);
+
+   s = concStripe((size_t)origin, hashmap->mask);
+
+   SCIP_CALL_ABORT( SCIPtpiAcquireLock(hashmap->locks[s]) );
+   exists = SCIPhashmapExists(hashmap->maps[s], origin);
+   SCIP_CALL_ABORT( SCIPtpiReleaseLock(hashmap->locks[s]) );
+
+   return exists;
+}
+
+/** removes origin->image pair from the concurrent hash map, if it exists */
+SCIP_RETCODE SCIPconchashmapRemove(
+   SCIP_CONCHASHMAP*     hashmap,            /**< concurrent hash map */
+   void*                 origin              /**< origin to remove from the list */
+   )
+{
+   SCIP_RETCODE retcode;
+   uint32_t s;
+
+   assert(hashmap != NULL);
+
+   s = concStripe((size_t)origin, hashmap->mask);
+
+   SCIP_CALL( SCIPtpiAcquireLock(hashmap->locks[s]) );
+   retcode = SCIPhashmapRemove(hashmap->maps[s], origin);
+   SCIP_CALL( SCIPtpiReleaseLock(hashmap->locks[s]) );
+
+   return retcode;
+}
+
+/** removes all entries of the concurrent hash map */
+SCIP_RETCODE SCIPconchashmapRemoveAll(
+   SCIP_CONCHASHMAP*     hashmap             /**< concurrent hash map */
+   )
+{
+   uint32_t s;
+
+   assert(hashmap != NULL);
+
+   for( s = 0; s <= hashmap->mask; ++s )
+   {
+      SCIP_RETCODE retcode;
+
+      SCIP_CALL( SCIPtpiAcquireLock(hashmap->locks[s]) );
+      retcode = SCIPhashmapRemoveAll(hashmap->maps[s]);
+      SCIP_CALL( SCIPtpiReleaseLock(hashmap->locks[s]) );
+      SCIP_CALL( retcode );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** returns the number of entries of the concurrent hash map
+ *
+ *  @note while other threads modify the map, the result is only a snapshot of each stripe at a different time
+ */
+int SCIPconchashmapGetNElements(
+   SCIP_CONCHASHMAP*     hashmap             /**< concurrent hash map */
+   )
+{
+   int nelements = 0;
+   uint32_t s;
+
+   assert(hashmap != NULL);
+
+   for( s = 0; s <= hashmap->mask; ++s )
+   {
+      SCIP_CALL_ABORT( SCIPtpiAcquireLock(hashmap->locks[s]) );
+      nelements += SCIPhashmapGetNElements(hashmap->maps[s]);
+      SCIP_CALL_ABORT( SCIPtpiReleaseLock(hashmap->locks[s]) );
+   }
+
+   return nelements;
+}
+
+
 /*
  * Hash Set
  */
@@ -5531,6 +6251,41 @@ SCIP_DECL_SORTINDCOMP(SCIPsortArgsortPtr)
 }
 
 
+/** maps an int to an unsigned integer of the same order for radix sort */
+static INLINE
+uint64_t sortRadixKeyInt(
+   int                   x                   /**< key */
+   )
+{
+   return (uint64_t)((uint32_t)x ^ UINT32_C(0x80000000));
+}
+
+/** maps a long integer to an unsigned integer of the same order for radix sort */
+static INLINE
+uint64_t sortRadixKeyLong(
+   SCIP_Longint          x                   /**< key */
+   )
+{
+   return (uint64_t)x ^ UINT64_C(0x8000000000000000);
+}
+
+/** maps a real to an unsigned integer of the same order for radix sort
+ *
+ *  The bit pattern of a nonnegative double already has the right order; for negative values, the order is reversed by
+ *  complementing all bits. -0.0 is ordered before 0.0, which compare equal.
+ */
+static INLINE
+uint64_t sortRadixKeyReal(
+   SCIP_Real             x                   /**< key */
+   )
+{
+   uint64_t bits;
+
+   memcpy(&bits, &x, sizeof(bits));
+
+   return (bits & UINT64_C(0x8000000000000000)) != 0 ? ~bits : bits | UINT64_C(0x8000000000000000);
+}
+
 /* first all upwards-sorting methods */
 
 /** sort an indexed element set in non-decreasing order, resulting in a permutation index array */
@@ -5736,6 +6491,7 @@ void SCIPsort(
 /* SCIPsortReal(), SCIPsortedvecInsert...(), SCIPsortedvecDelPos...(), SCIPsortedvecFind...() via sort template */
 #define SORTTPL_NAMEEXT     Real
 #define SORTTPL_KEYTYPE     SCIP_Real
+#define SORTTPL_RADIXKEY(x) sortRadixKeyReal(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -5744,6 +6500,7 @@ void SCIPsort(
 #define SORTTPL_KEYTYPE     SCIP_Real
 #define SORTTPL_FIELD1TYPE  SCIP_Bool
 #define SORTTPL_FIELD2TYPE  void*
+#define SORTTPL_RADIXKEY(x) sortRadixKeyReal(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -5751,6 +6508,7 @@ void SCIPsort(
 #define SORTTPL_NAMEEXT     RealPtr
 #define SORTTPL_KEYTYPE     SCIP_Real
 #define SORTTPL_FIELD1TYPE  void*
+#define SORTTPL_RADIXKEY(x) sortRadixKeyReal(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -5758,6 +6516,7 @@ void SCIPsort(
 #define SORTTPL_NAMEEXT     RealInt
 #define SORTTPL_KEYTYPE     SCIP_Real
 #define SORTTPL_FIELD1TYPE  int
+#define SORTTPL_RADIXKEY(x) sortRadixKeyReal(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -5766,6 +6525,7 @@ void SCIPsort(
 #define SORTTPL_KEYTYPE     SCIP_Real
 #define SORTTPL_FIELD1TYPE  int
 #define SORTTPL_FIELD2TYPE  int
+#define SORTTPL_RADIXKEY(x) sortRadixKeyReal(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -5774,6 +6534,7 @@ void SCIPsort(
 #define SORTTPL_KEYTYPE     SCIP_Real
 #define SORTTPL_FIELD1TYPE  int
 #define SORTTPL_FIELD2TYPE  SCIP_Longint
+#define SORTTPL_RADIXKEY(x) sortRadixKeyReal(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -5782,6 +6543,7 @@ void SCIPsort(
 #define SORTTPL_KEYTYPE     SCIP_Real
 #define SORTTPL_FIELD1TYPE  int
 #define SORTTPL_FIELD2TYPE  void*
+#define SORTTPL_RADIXKEY(x) sortRadixKeyReal(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -5790,6 +6552,7 @@ void SCIPsort(
 #define SORTTPL_KEYTYPE     SCIP_Real
 #define SORTTPL_FIELD1TYPE  SCIP_Real
 #define SORTTPL_FIELD2TYPE  void*
+#define SORTTPL_RADIXKEY(x) sortRadixKeyReal(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -5799,6 +6562,7 @@ void SCIPsort(
 #define SORTTPL_FIELD1TYPE  SCIP_Longint
 #define SORTTPL_FIELD2TYPE  SCIP_Real
 #define SORTTPL_FIELD3TYPE  int
+#define SORTTPL_RADIXKEY(x) sortRadixKeyReal(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 /* SCIPsortRealRealIntInt(), SCIPsortedvecInsert...(), SCIPsortedvecDelPos...(), SCIPsortedvecFind...() via sort template */
@@ -5807,6 +6571,7 @@ void SCIPsort(
 #define SORTTPL_FIELD1TYPE  SCIP_Real
 #define SORTTPL_FIELD2TYPE  int
 #define SORTTPL_FIELD3TYPE  int
+#define SORTTPL_RADIXKEY(x) sortRadixKeyReal(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -5816,6 +6581,7 @@ void SCIPsort(
 #define SORTTPL_FIELD1TYPE  SCIP_Real
 #define SORTTPL_FIELD2TYPE  SCIP_Real
 #define SORTTPL_FIELD3TYPE  int
+#define SORTTPL_RADIXKEY(x) sortRadixKeyReal(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -5825,6 +6591,7 @@ void SCIPsort(
 #define SORTTPL_FIELD1TYPE  SCIP_Real
 #define SORTTPL_FIELD2TYPE  SCIP_Real
 #define SORTTPL_FIELD3TYPE  void*
+#define SORTTPL_RADIXKEY(x) sortRadixKeyReal(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -5834,6 +6601,7 @@ void SCIPsort(
 #define SORTTPL_FIELD1TYPE  void*
 #define SORTTPL_FIELD2TYPE  void*
 #define SORTTPL_FIELD3TYPE  int
+#define SORTTPL_RADIXKEY(x) sortRadixKeyReal(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -5844,6 +6612,7 @@ void SCIPsort(
 #define SORTTPL_FIELD2TYPE  void*
 #define SORTTPL_FIELD3TYPE  int
 #define SORTTPL_FIELD4TYPE  int
+#define SORTTPL_RADIXKEY(x) sortRadixKeyReal(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -5854,6 +6623,7 @@ void SCIPsort(
 #define SORTTPL_FIELD2TYPE  SCIP_Real
 #define SORTTPL_FIELD3TYPE  SCIP_Bool
 #define SORTTPL_FIELD4TYPE  void*
+#define SORTTPL_RADIXKEY(x) sortRadixKeyReal(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -5865,12 +6635,14 @@ void SCIPsort(
 #define SORTTPL_FIELD3TYPE  SCIP_Bool
 #define SORTTPL_FIELD4TYPE  SCIP_Bool
 #define SORTTPL_FIELD5TYPE  void*
+#define SORTTPL_RADIXKEY(x) sortRadixKeyReal(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
 /* SCIPsortInt(), SCIPsortedvecInsert...(), SCIPsortedvecDelPos...(), SCIPsortedvecFind...() via sort template */
 #define SORTTPL_NAMEEXT     Int
 #define SORTTPL_KEYTYPE     int
+#define SORTTPL_RADIXKEY(x) sortRadixKeyInt(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -5878,6 +6650,7 @@ void SCIPsort(
 #define SORTTPL_NAMEEXT     IntInt
 #define SORTTPL_KEYTYPE     int
 #define SORTTPL_FIELD1TYPE  int
+#define SORTTPL_RADIXKEY(x) sortRadixKeyInt(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -5885,6 +6658,7 @@ void SCIPsort(
 #define SORTTPL_NAMEEXT     IntReal
 #define SORTTPL_KEYTYPE     int
 #define SORTTPL_FIELD1TYPE  SCIP_Real
+#define SORTTPL_RADIXKEY(x) sortRadixKeyInt(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -5892,6 +6666,7 @@ void SCIPsort(
 #define SORTTPL_NAMEEXT     IntPtr
 #define SORTTPL_KEYTYPE     int
 #define SORTTPL_FIELD1TYPE  void*
+#define SORTTPL_RADIXKEY(x) sortRadixKeyInt(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -5900,6 +6675,7 @@ void SCIPsort(
 #define SORTTPL_KEYTYPE     int
 #define SORTTPL_FIELD1TYPE  int
 #define SORTTPL_FIELD2TYPE  int
+#define SORTTPL_RADIXKEY(x) sortRadixKeyInt(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -5908,6 +6684,7 @@ void SCIPsort(
 #define SORTTPL_KEYTYPE     int
 #define SORTTPL_FIELD1TYPE  int
 #define SORTTPL_FIELD2TYPE  SCIP_Longint
+#define SORTTPL_RADIXKEY(x) sortRadixKeyInt(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 /* SCIPsortIntRealLong(), SCIPsortedvecInsert...(), SCIPsortedvecDelPos...(), SCIPsortedvecFind...() via sort template */
@@ -5915,6 +6692,7 @@ void SCIPsort(
 #define SORTTPL_KEYTYPE     int
 #define SORTTPL_FIELD1TYPE  SCIP_Real
 #define SORTTPL_FIELD2TYPE  SCIP_Longint
+#define SORTTPL_RADIXKEY(x) sortRadixKeyInt(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -5923,6 +6701,7 @@ void SCIPsort(
 #define SORTTPL_KEYTYPE     int
 #define SORTTPL_FIELD1TYPE  int
 #define SORTTPL_FIELD2TYPE  void*
+#define SORTTPL_RADIXKEY(x) sortRadixKeyInt(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -5931,6 +6710,7 @@ void SCIPsort(
 #define SORTTPL_KEYTYPE     int
 #define SORTTPL_FIELD1TYPE  int
 #define SORTTPL_FIELD2TYPE  SCIP_Real
+#define SORTTPL_RADIXKEY(x) sortRadixKeyInt(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -5939,6 +6719,7 @@ void SCIPsort(
 #define SORTTPL_KEYTYPE     int
 #define SORTTPL_FIELD1TYPE  void*
 #define SORTTPL_FIELD2TYPE  SCIP_Real
+#define SORTTPL_RADIXKEY(x) sortRadixKeyInt(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -5948,6 +6729,7 @@ void SCIPsort(
 #define SORTTPL_FIELD1TYPE  int
 #define SORTTPL_FIELD2TYPE  int
 #define SORTTPL_FIELD3TYPE  void*
+#define SORTTPL_RADIXKEY(x) sortRadixKeyInt(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 /* SCIPsortIntIntIntReal(), SCIPsortedvecInsert...(), SCIPsortedvecDelPos...(), SCIPsortedvecFind...() via sort template */
@@ -5956,6 +6738,7 @@ void SCIPsort(
 #define SORTTPL_FIELD1TYPE  int
 #define SORTTPL_FIELD2TYPE  int
 #define SORTTPL_FIELD3TYPE  SCIP_Real
+#define SORTTPL_RADIXKEY(x) sortRadixKeyInt(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 /* SCIPsortIntPtrIntReal(), SCIPsortedvecInsert...(), SCIPsortedvecDelPos...(), SCIPsortedvecFind...() via sort template */
@@ -5964,12 +6747,14 @@ void SCIPsort(
 #define SORTTPL_FIELD1TYPE  void*
 #define SORTTPL_FIELD2TYPE  int
 #define SORTTPL_FIELD3TYPE  SCIP_Real
+#define SORTTPL_RADIXKEY(x) sortRadixKeyInt(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
 /* SCIPsortLong(), SCIPsortedvecInsert...(), SCIPsortedvecDelPos...(), SCIPsortedvecFind...() via sort template */
 #define SORTTPL_NAMEEXT     Long
 #define SORTTPL_KEYTYPE     SCIP_Longint
+#define SORTTPL_RADIXKEY(x) sortRadixKeyLong(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -5977,6 +6762,7 @@ void SCIPsort(
 #define SORTTPL_NAMEEXT     LongPtr
 #define SORTTPL_KEYTYPE     SCIP_Longint
 #define SORTTPL_FIELD1TYPE  void*
+#define SORTTPL_RADIXKEY(x) sortRadixKeyLong(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -5985,6 +6771,7 @@ void SCIPsort(
 #define SORTTPL_KEYTYPE     SCIP_Longint
 #define SORTTPL_FIELD1TYPE  void*
 #define SORTTPL_FIELD2TYPE  int
+#define SORTTPL_RADIXKEY(x) sortRadixKeyLong(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -5994,6 +6781,7 @@ void SCIPsort(
 #define SORTTPL_FIELD1TYPE  void*
 #define SORTTPL_FIELD2TYPE  SCIP_Real
 #define SORTTPL_FIELD3TYPE  SCIP_Bool
+#define SORTTPL_RADIXKEY(x) sortRadixKeyLong(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6004,6 +6792,7 @@ void SCIPsort(
 #define SORTTPL_FIELD2TYPE  SCIP_Real
 #define SORTTPL_FIELD3TYPE  SCIP_Real
 #define SORTTPL_FIELD4TYPE  SCIP_Bool
+#define SORTTPL_RADIXKEY(x) sortRadixKeyLong(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6015,6 +6804,7 @@ void SCIPsort(
 #define SORTTPL_FIELD3TYPE  SCIP_Real
 #define SORTTPL_FIELD4TYPE  int
 #define SORTTPL_FIELD5TYPE  SCIP_Bool
+#define SORTTPL_RADIXKEY(x) sortRadixKeyLong(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6024,6 +6814,7 @@ void SCIPsort(
 #define SORTTPL_FIELD1TYPE  void*
 #define SORTTPL_FIELD2TYPE  void*
 #define SORTTPL_FIELD3TYPE  int
+#define SORTTPL_RADIXKEY(x) sortRadixKeyLong(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6034,6 +6825,7 @@ void SCIPsort(
 #define SORTTPL_FIELD2TYPE  void*
 #define SORTTPL_FIELD3TYPE  int
 #define SORTTPL_FIELD4TYPE  int
+#define SORTTPL_RADIXKEY(x) sortRadixKeyLong(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6044,6 +6836,7 @@ void SCIPsort(
 #define SORTTPL_FIELD2TYPE  void*
 #define SORTTPL_FIELD3TYPE  SCIP_Bool
 #define SORTTPL_FIELD4TYPE  int
+#define SORTTPL_RADIXKEY(x) sortRadixKeyLong(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6066,6 +6859,7 @@ void SCIPsort(
 #define SORTTPL_FIELD3TYPE  int
 #define SORTTPL_FIELD4TYPE  SCIP_Bool
 #define SORTTPL_FIELD5TYPE  SCIP_Bool
+#define SORTTPL_RADIXKEY(x) sortRadixKeyInt(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6264,6 +7058,7 @@ void SCIPsortDown(
 #define SORTTPL_NAMEEXT     DownReal
 #define SORTTPL_KEYTYPE     SCIP_Real
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyReal(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6273,6 +7068,7 @@ void SCIPsortDown(
 #define SORTTPL_FIELD1TYPE  SCIP_Bool
 #define SORTTPL_FIELD2TYPE  void*
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyReal(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6281,6 +7077,7 @@ void SCIPsortDown(
 #define SORTTPL_KEYTYPE     SCIP_Real
 #define SORTTPL_FIELD1TYPE  void*
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyReal(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6289,6 +7086,7 @@ void SCIPsortDown(
 #define SORTTPL_KEYTYPE     SCIP_Real
 #define SORTTPL_FIELD1TYPE  int
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyReal(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 /* SCIPsortDownRealIntInt(), SCIPsortedvecInsert...(), SCIPsortedvecDelPos...(), SCIPsortedvecFind...() via sort template */
@@ -6297,6 +7095,7 @@ void SCIPsortDown(
 #define SORTTPL_FIELD1TYPE  int
 #define SORTTPL_FIELD2TYPE  int
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyReal(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 /* SCIPsortDownRealIntLong(), SCIPsortedvecInsert...(), SCIPsortedvecDelPos...(), SCIPsortedvecFind...() via sort template */
@@ -6305,6 +7104,7 @@ void SCIPsortDown(
 #define SORTTPL_FIELD1TYPE  int
 #define SORTTPL_FIELD2TYPE  SCIP_Longint
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyReal(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6314,6 +7114,7 @@ void SCIPsortDown(
 #define SORTTPL_FIELD1TYPE  int
 #define SORTTPL_FIELD2TYPE  void*
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyReal(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6323,6 +7124,7 @@ void SCIPsortDown(
 #define SORTTPL_FIELD1TYPE  void*
 #define SORTTPL_FIELD2TYPE  void*
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyReal(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 /* SCIPsortDownRealRealInt(), SCIPsortedvecInsert...(), SCIPsortedvecDelPos...(), SCIPsortedvecFind...() via sort template */
@@ -6331,6 +7133,7 @@ void SCIPsortDown(
 #define SORTTPL_FIELD1TYPE  SCIP_Real
 #define SORTTPL_FIELD2TYPE  int
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyReal(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 /* SCIPsortDownRealRealPtr(), SCIPsortedvecInsert...(), SCIPsortedvecDelPos...(), SCIPsortedvecFind...() via sort template */
@@ -6339,6 +7142,7 @@ void SCIPsortDown(
 #define SORTTPL_FIELD1TYPE  SCIP_Real
 #define SORTTPL_FIELD2TYPE  void*
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyReal(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 /* SCIPsortDownRealRealPtrPtr(), SCIPsortedvecInsert...(), SCIPsortedvecDelPos...(), SCIPsortedvecFind...() via sort template */
@@ -6348,6 +7152,7 @@ void SCIPsortDown(
 #define SORTTPL_FIELD2TYPE  void*
 #define SORTTPL_FIELD3TYPE  void*
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyReal(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6358,6 +7163,7 @@ void SCIPsortDown(
 #define SORTTPL_FIELD2TYPE  SCIP_Real
 #define SORTTPL_FIELD3TYPE  int
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyReal(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6368,6 +7174,7 @@ void SCIPsortDown(
 #define SORTTPL_FIELD2TYPE  int
 #define SORTTPL_FIELD3TYPE  int
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyReal(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6378,6 +7185,7 @@ void SCIPsortDown(
 #define SORTTPL_FIELD2TYPE  SCIP_Real
 #define SORTTPL_FIELD3TYPE  int
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyReal(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6388,6 +7196,7 @@ void SCIPsortDown(
 #define SORTTPL_FIELD2TYPE  SCIP_Real
 #define SORTTPL_FIELD3TYPE  void*
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyReal(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6398,6 +7207,7 @@ void SCIPsortDown(
 #define SORTTPL_FIELD2TYPE  void*
 #define SORTTPL_FIELD3TYPE  int
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyReal(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 /* SCIPsortDownRealPtrPtrIntInt(), SCIPsortedvecInsert...(), SCIPsortedvecDelPos...(), SCIPsortedvecFind...() via sort template */
@@ -6408,6 +7218,7 @@ void SCIPsortDown(
 #define SORTTPL_FIELD3TYPE  int
 #define SORTTPL_FIELD4TYPE  int
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyReal(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6419,6 +7230,7 @@ void SCIPsortDown(
 #define SORTTPL_FIELD3TYPE  SCIP_Bool
 #define SORTTPL_FIELD4TYPE  void*
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyReal(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6430,6 +7242,7 @@ void SCIPsortDown(
 #define SORTTPL_FIELD3TYPE  SCIP_Bool
 #define SORTTPL_FIELD4TYPE  SCIP_Bool
 #define SORTTPL_FIELD5TYPE  void*
+#define SORTTPL_RADIXKEY(x) sortRadixKeyReal(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6437,6 +7250,7 @@ void SCIPsortDown(
 #define SORTTPL_NAMEEXT     DownInt
 #define SORTTPL_KEYTYPE     int
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyInt(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6445,6 +7259,7 @@ void SCIPsortDown(
 #define SORTTPL_KEYTYPE     int
 #define SORTTPL_FIELD1TYPE  int
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyInt(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6454,6 +7269,7 @@ void SCIPsortDown(
 #define SORTTPL_FIELD1TYPE  int
 #define SORTTPL_FIELD2TYPE  SCIP_Real
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyInt(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6462,6 +7278,7 @@ void SCIPsortDown(
 #define SORTTPL_KEYTYPE     int
 #define SORTTPL_FIELD1TYPE  SCIP_Real
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyInt(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6470,6 +7287,7 @@ void SCIPsortDown(
 #define SORTTPL_KEYTYPE     int
 #define SORTTPL_FIELD1TYPE  void*
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyInt(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6479,6 +7297,7 @@ void SCIPsortDown(
 #define SORTTPL_FIELD1TYPE  int
 #define SORTTPL_FIELD2TYPE  int
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyInt(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6488,6 +7307,7 @@ void SCIPsortDown(
 #define SORTTPL_FIELD1TYPE  int
 #define SORTTPL_FIELD2TYPE  SCIP_Longint
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyInt(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6497,6 +7317,7 @@ void SCIPsortDown(
 #define SORTTPL_FIELD1TYPE  int
 #define SORTTPL_FIELD2TYPE  void*
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyInt(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6507,6 +7328,7 @@ void SCIPsortDown(
 #define SORTTPL_FIELD2TYPE  int
 #define SORTTPL_FIELD3TYPE  void*
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyInt(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6517,6 +7339,7 @@ void SCIPsortDown(
 #define SORTTPL_FIELD2TYPE  int
 #define SORTTPL_FIELD3TYPE  SCIP_Real
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyInt(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6524,6 +7347,7 @@ void SCIPsortDown(
 #define SORTTPL_NAMEEXT     DownLong
 #define SORTTPL_KEYTYPE     SCIP_Longint
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyLong(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6532,6 +7356,7 @@ void SCIPsortDown(
 #define SORTTPL_KEYTYPE     SCIP_Longint
 #define SORTTPL_FIELD1TYPE  void*
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyLong(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6541,6 +7366,7 @@ void SCIPsortDown(
 #define SORTTPL_FIELD1TYPE  void*
 #define SORTTPL_FIELD2TYPE  int
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyLong(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6551,6 +7377,7 @@ void SCIPsortDown(
 #define SORTTPL_FIELD2TYPE  SCIP_Real
 #define SORTTPL_FIELD3TYPE  SCIP_Bool
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyLong(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6562,6 +7389,7 @@ void SCIPsortDown(
 #define SORTTPL_FIELD3TYPE  SCIP_Real
 #define SORTTPL_FIELD4TYPE  SCIP_Bool
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyLong(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6574,6 +7402,7 @@ void SCIPsortDown(
 #define SORTTPL_FIELD4TYPE  int
 #define SORTTPL_FIELD5TYPE  SCIP_Bool
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyLong(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6584,6 +7413,7 @@ void SCIPsortDown(
 #define SORTTPL_FIELD2TYPE  void*
 #define SORTTPL_FIELD3TYPE  int
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyLong(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6595,6 +7425,7 @@ void SCIPsortDown(
 #define SORTTPL_FIELD3TYPE  int
 #define SORTTPL_FIELD4TYPE  int
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyLong(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6606,6 +7437,7 @@ void SCIPsortDown(
 #define SORTTPL_FIELD3TYPE  SCIP_Bool
 #define SORTTPL_FIELD4TYPE  int
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyLong(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
@@ -6630,6 +7462,7 @@ void SCIPsortDown(
 #define SORTTPL_FIELD4TYPE  SCIP_Bool
 #define SORTTPL_FIELD5TYPE  SCIP_Bool
 #define SORTTPL_BACKWARDS
+#define SORTTPL_RADIXKEY(x) sortRadixKeyInt(x)
 #include "scip/sorttpl.c" /*lint !e451*/
 
 /*
@@ -55,9 +55,12 @@
  * node priority queue methods
  */
 
-#define PQ_PARENT(q) (((q)+1)/2-1)
-#define PQ_LEFTCHILD(p) (2*(p)+1)
-#define PQ_RIGHTCHILD(p) (2*(p)+2)
+/* both queues are d-ary heaps: the children of a slot lie next to each other, such that a heap of the same length has
+ * half the depth of a binary heap
+ */
+#define PQ_ARITY 4
+#define PQ_PARENT(q) (((q)-1)/PQ_ARITY)
+#define PQ_FIRSTCHILD(p) (PQ_ARITY*(p)+1)
 
 
 /** node comparator for node numbers */
@@ -97,10 +100,219 @@ SCIP_RETCODE nodepqResize(
    SCIP_ALLOC( BMSreallocMemoryArray(&nodepq->slots, nodepq->size) );
    SCIP_ALLOC( BMSreallocMemoryArray(&nodepq->bfsposs, nodepq->size) );
    SCIP_ALLOC( BMSreallocMemoryArray(&nodepq->bfsqueue, nodepq->size) );
+   SCIP_ALLOC( BMSreallocMemoryArray(&nodepq->bfslowerbounds, nodepq->size) );
 
    return SCIP_OKAY;
 }
 
+/** moves the node at the given slot towards the root as long as it is better than its parent, and returns its final
+ *  slot; the bfs queue indices of all moved nodes are updated
+ */
+static
+int nodepqSiftUp(
+   SCIP_NODEPQ*          nodepq,             /**< node priority queue */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   int                   pos                 /**< slot of the node to move */
+   )
+{
+   SCIP_NODESEL* nodesel;
+   SCIP_NODE** slots;
+   int* bfsposs;
+   int* bfsqueue;
+   SCIP_NODE* node;
+   int bfspos;
+
+   assert(nodepq != NULL);
+   assert(0 <= pos && pos < nodepq->len);
+
+   nodesel = nodepq->nodesel;
+   slots = nodepq->slots;
+   bfsposs = nodepq->bfsposs;
+   bfsqueue = nodepq->bfsqueue;
+   node = slots[pos];
+   bfspos = bfsposs[pos];
+
+   while( pos > 0 && nodesel->nodeselcomp(set->scip, nodesel, node, slots[PQ_PARENT(pos)]) < 0 )
+   {
+      slots[pos] = slots[PQ_PARENT(pos)];
+      bfsposs[pos] = bfsposs[PQ_PARENT(pos)];
+      bfsqueue[bfsposs[pos]] = pos;
+      pos = PQ_PARENT(pos);
+   }
+   slots[pos] = node;
+   bfsposs[pos] = bfspos;
+   bfsqueue[bfspos] = pos;
+
+   return pos;
+}
+
+/** moves the node at the given slot away from the root as long as one of its children is better, and returns its final
+ *  slot; the bfs queue indices of all moved nodes are updated
+ */
+static
+int nodepqSiftDown(
+   SCIP_NODEPQ*          nodepq,             /**< node priority queue */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   int                   pos                 /**< slot of the node to move */
+   )
+{
+   SCIP_NODESEL* nodesel;
+   SCIP_NODE** slots;
+   int* bfsposs;
+   int* bfsqueue;
+   SCIP_NODE* node;
+   int bfspos;
+   int childpos;
+
+   assert(nodepq != NULL);
+   assert(0 <= pos && pos < nodepq->len);
+
+   nodesel = nodepq->nodesel;
+   slots = nodepq->slots;
+   bfsposs = nodepq->bfsposs;
+   bfsqueue = nodepq->bfsqueue;
+   node = slots[pos];
+   bfspos = bfsposs[pos];
+
+   /* as long as the slot has children, move the best child upwards if it is better than the node */
+   while( (childpos = PQ_FIRSTCHILD(pos)) < nodepq->len )
+   {
+      int lastchildpos;
+      int bestpos;
+
+      lastchildpos = MIN(childpos + PQ_ARITY, nodepq->len);
+      bestpos = childpos;
+      for( ++childpos; childpos < lastchildpos; ++childpos )
+      {
+         if( nodesel->nodeselcomp(set->scip, nodesel, slots[childpos], slots[bestpos]) < 0 )
+            bestpos = childpos;
+      }
+
+      if( nodesel->nodeselcomp(set->scip, nodesel, node, slots[bestpos]) <= 0 )
+         break;
+
+      slots[pos] = slots[bestpos];
+      bfsposs[pos] = bfsposs[bestpos];
+      bfsqueue[bfsposs[pos]] = pos;
+      pos = bestpos;
+   }
+   slots[pos] = node;
+   bfsposs[pos] = bfspos;
+   bfsqueue[bfspos] = pos;
+
+   return pos;
+}
+
+/** moves the entry at the given position of the bfs queue towards the root as long as its lower bound is smaller than
+ *  the one of its parent, and returns its final position
+ */
+static
+int nodepqBfsSiftUp(
+   SCIP_NODEPQ*          nodepq,             /**< node priority queue */
+   int                   bfspos              /**< position of the entry in the bfs queue */
+   )
+{
+   SCIP_Real* bfslowerbounds;
+   int* bfsposs;
+   int* bfsqueue;
+   SCIP_Real lowerbound;
+   int pos;
+
+   assert(nodepq != NULL);
+   assert(0 <= bfspos && bfspos < nodepq->len);
+
+   bfslowerbounds = nodepq->bfslowerbounds;
+   bfsposs = nodepq->bfsposs;
+   bfsqueue = nodepq->bfsqueue;
+   lowerbound = bfslowerbounds[bfspos];
+   pos = bfsqueue[bfspos];
+
+   while( bfspos > 0 && lowerbound < bfslowerbounds[PQ_PARENT(bfspos)] )
+   {
+      bfsqueue[bfspos] = bfsqueue[PQ_PARENT(bfspos)];
+      bfslowerbounds[bfspos] = bfslowerbounds[PQ_PARENT(bfspos)];
+      bfsposs[bfsqueue[bfspos]] = bfspos;
+      bfspos = PQ_PARENT(bfspos);
+   }
+   bfsqueue[bfspos] = pos;
+   bfslowerbounds[bfspos] = lowerbound;
+   bfsposs[pos] = bfspos;
+
+   return bfspos;
+}
+
+/** moves the entry at the given position of the bfs queue away from the root as long as one of its children has a
+ *  smaller lower bound, and returns its final position
+ */
+static
+int nodepqBfsSiftDown(
+   SCIP_NODEPQ*          nodepq,             /**< node priority queue */
+   int                   bfspos              /**< position of the entry in the bfs queue */
+   )
+{
+   SCIP_Real* bfslowerbounds;
+   int* bfsposs;
+   int* bfsqueue;
+   SCIP_Real lowerbound;
+   int childpos;
+   int pos;
+
+   assert(nodepq != NULL);
+   assert(0 <= bfspos && bfspos < nodepq->len);
+
+   bfslowerbounds = nodepq->bfslowerbounds;
+   bfsposs = nodepq->bfsposs;
+   bfsqueue = nodepq->bfsqueue;
+   lowerbound = bfslowerbounds[bfspos];
+   pos = bfsqueue[bfspos];
+
+   /* as long as the entry has children, move the child with the smallest lower bound upwards if it is smaller */
+   while( (childpos = PQ_FIRSTCHILD(bfspos)) < nodepq->len )
+   {
+      int lastchildpos;
+      int bestpos;
+
+      lastchildpos = MIN(childpos + PQ_ARITY, nodepq->len);
+      bestpos = childpos;
+      for( ++childpos; childpos < lastchildpos; ++childpos )
+      {
+         if( bfslowerbounds[childpos] < bfslowerbounds[bestpos] )
+            bestpos = childpos;
+      }
+
+      if( lowerbound <= bfslowerbounds[bestpos] )
+         break;
+
+      bfsqueue[bfspos] = bfsqueue[bestpos];
+      bfslowerbounds[bfspos] = bfslowerbounds[bestpos];
+      bfsposs[bfsqueue[bfspos]] = bfspos;
+      bfspos = bestpos;
+   }
+   bfsqueue[bfspos] = pos;
+   bfslowerbounds[bfspos] = lowerbound;
+   bfsposs[pos] = bfspos;
+
+   return bfspos;
+}
+
+/** restores the heap properties of both queues in linear time after the slots were filled in arbitrary order */
+static
+void nodepqHeapify(
+   SCIP_NODEPQ*          nodepq,             /**< node priority queue */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   )
+{
+   int pos;
+
+   assert(nodepq != NULL);
+
+   for( pos = PQ_PARENT(nodepq->len-1); pos >= 0; --pos )
+      (void) nodepqSiftDown(nodepq, set, pos);
+
+   for( pos = PQ_PARENT(nodepq->len-1); pos >= 0; --pos )
+      (void) nodepqBfsSiftDown(nodepq, pos);
+}
+
 /** creates node priority queue */
 SCIP_RETCODE SCIPnodepqCreate(
    SCIP_NODEPQ**         nodepq,             /**< pointer to a node priority queue */
@@ -116,6 +328,7 @@ SCIP_RETCODE SCIPnodepqCreate(
    (*nodepq)->slots = NULL;
    (*nodepq)->bfsposs = NULL;
    (*nodepq)->bfsqueue = NULL;
+   (*nodepq)->bfslowerbounds = NULL;
    (*nodepq)->len = 0;
    (*nodepq)->size = 0;
    (*nodepq)->lowerboundsum = 0.0;
@@ -134,6 +347,7 @@ void SCIPnodepqDestroy(
    BMSfreeMemoryArrayNull(&(*nodepq)->slots);
    BMSfreeMemoryArrayNull(&(*nodepq)->bfsposs);
    BMSfreeMemoryArrayNull(&(*nodepq)->bfsqueue);
+   BMSfreeMemoryArrayNull(&(*nodepq)->bfslowerbounds);
    BMSfreeMemory(nodepq);
 }
 
@@ -238,12 +452,6 @@ SCIP_RETCODE SCIPnodepqSetNodesel(
    /* resize the new node priority queue to be able to store all nodes */
    retcode = nodepqResize(newnodepq, set, (*nodepq)->len);
 
-   /* insert all nodes in the new node priority queue */
-   for( i = 0; i < (*nodepq)->len && retcode == SCIP_OKAY; ++i )
-   {
-      retcode = SCIPnodepqInsert(newnodepq, set, (*nodepq)->slots[i]);
-   }
-
    if( retcode != SCIP_OKAY )
    {
       SCIPnodepqDestroy(&newnodepq);
@@ -251,6 +459,20 @@ SCIP_RETCODE SCIPnodepqSetNodesel(
       return retcode;
    }
 
+   /* copy all nodes and the bfs queue, which does not depend on the node selector, and restore the order of the slots */
+   newnodepq->len = (*nodepq)->len;
+   newnodepq->lowerboundsum = (*nodepq)->lowerboundsum;
+   for( i = 0; i < newnodepq->len; ++i )
+   {
+      newnodepq->slots[i] = (*nodepq)->slots[i];
+      newnodepq->bfsposs[i] = (*nodepq)->bfsposs[i];
+      newnodepq->bfsqueue[i] = (*nodepq)->bfsqueue[i];
+      newnodepq->bfslowerbounds[i] = (*nodepq)->bfslowerbounds[i];
+   }
+
+   for( i = PQ_PARENT(newnodepq->len-1); i >= 0; --i )
+      (void) nodepqSiftDown(newnodepq, set, i);
+
    /* destroy the old node priority queue without freeing the nodes */
    SCIPnodepqDestroy(nodepq);
 
@@ -283,10 +505,6 @@ SCIP_RETCODE SCIPnodepqInsert(
    SCIP_NODE*            node                /**< node to be inserted */
    )
 {
-   SCIP_NODESEL* nodesel;
-   SCIP_NODE** slots;
-   int* bfsposs;
-   int* bfsqueue;
    SCIP_Real lowerbound;
    int pos;
    int bfspos;
@@ -295,40 +513,25 @@ SCIP_RETCODE SCIPnodepqInsert(
    assert(nodepq->len >= 0);
    assert(set != NULL);
    assert(node != NULL);
-
-   nodesel = nodepq->nodesel;
-   assert(nodesel != NULL);
-   assert(nodesel->nodeselcomp != NULL);
+   assert(nodepq->nodesel != NULL);
+   assert(nodepq->nodesel->nodeselcomp != NULL);
 
    SCIP_CALL( nodepqResize(nodepq, set, nodepq->len+1) );
-   slots = nodepq->slots;
-   bfsposs = nodepq->bfsposs;
-   bfsqueue = nodepq->bfsqueue;
 
-   /* insert node as leaf in the tree, move it towards the root as long it is better than its parent */
+   /* insert node as leaf in both trees and move it towards the roots as long as it is better than its parents; the
+    * lower bound is stored in the bfs queue, such that the bfs queue is ordered without accessing the nodes
+    */
+   lowerbound = SCIPnodeGetLowerbound(node);
+   pos = nodepq->len;
    nodepq->len++;
-   nodepq->lowerboundsum += SCIPnodeGetLowerbound(node);
-   pos = nodepq->len-1;
-   while( pos > 0 && nodesel->nodeselcomp(set->scip, nodesel, node, slots[PQ_PARENT(pos)]) < 0 )
-   {
-      slots[pos] = slots[PQ_PARENT(pos)];
-      bfsposs[pos] = bfsposs[PQ_PARENT(pos)];
-      bfsqueue[bfsposs[pos]] = pos;
-      pos = PQ_PARENT(pos);
-   }
-   slots[pos] = node;
+   nodepq->lowerboundsum += lowerbound;
+   nodepq->slots[pos] = node;
+   nodepq->bfsposs[pos] = pos;
+   nodepq->bfsqueue[pos] = pos;
+   nodepq->bfslowerbounds[pos] = lowerbound;
 
-   /* insert the final position into the bfs index queue */
-   lowerbound = SCIPnodeGetLowerbound(node);
-   bfspos = nodepq->len-1;
-   while( bfspos > 0 && lowerbound < SCIPnodeGetLowerbound(slots[bfsqueue[PQ_PARENT(bfspos)]]) )
-   {
-      bfsqueue[bfspos] = bfsqueue[PQ_PARENT(bfspos)];
-      bfsposs[bfsqueue[bfspos]] = bfspos;
-      bfspos = PQ_PARENT(bfspos);
-   }
-   bfsqueue[bfspos] = pos;
-   bfsposs[pos] = bfspos;
+   pos = nodepqSiftUp(nodepq, set, pos);
+   bfspos = nodepqBfsSiftUp(nodepq, nodepq->len-1);
 
    SCIPsetDebugMsg(set, "inserted node %p[%g] at pos %d and bfspos %d of node queue\n", (void*)node, lowerbound, pos, bfspos);
 
@@ -345,38 +548,24 @@ SCIP_Bool nodepqDelPos(
    int                   rempos              /**< queue position of node to remove */
    )
 {
-   SCIP_NODESEL* nodesel;
-   SCIP_NODE** slots;
-   int* bfsposs;
-   int* bfsqueue;
-   SCIP_NODE* lastnode;
-   int lastbfspos;
-   int lastbfsqueueidx;
    int freepos;
    int freebfspos;
    SCIP_Bool parentfelldown;
-   SCIP_Bool bfsparentfelldown;
 
    assert(nodepq != NULL);
    assert(nodepq->len > 0);
    assert(set != NULL);
    assert(0 <= rempos && rempos < nodepq->len);
+   assert(nodepq->nodesel != NULL);
+   assert(nodepq->nodesel->nodeselcomp != NULL);
 
-   nodesel = nodepq->nodesel;
-   assert(nodesel != NULL);
-   assert(nodesel->nodeselcomp != NULL);
-
-   slots = nodepq->slots;
-   bfsposs = nodepq->bfsposs;
-   bfsqueue = nodepq->bfsqueue;
-
-   nodepq->lowerboundsum -= SCIPnodeGetLowerbound(slots[rempos]);
    freepos = rempos;
-   freebfspos = bfsposs[rempos];
+   freebfspos = nodepq->bfsposs[rempos];
    assert(0 <= freebfspos && freebfspos < nodepq->len);
+   nodepq->lowerboundsum -= nodepq->bfslowerbounds[freebfspos];
 
    SCIPsetDebugMsg(set, "delete node %p[%g] at pos %d and bfspos %d of node queue\n",
-      (void*)slots[freepos], SCIPnodeGetLowerbound(slots[freepos]), freepos, freebfspos);
+      (void*)nodepq->slots[freepos], nodepq->bfslowerbounds[freebfspos], freepos, freebfspos);
 
    /* remove node of the tree and get a free slot,
     * if the removed node was the last node of the queue
@@ -384,112 +573,37 @@ SCIP_Bool nodepqDelPos(
     * if the last node of the queue is better than the parent of the removed node:
     *  - move the parent to the free slot, until the last node can be placed in the free slot
     * if the last node of the queue is not better than the parent of the free slot:
-    *  - move the better child to the free slot until the last node can be placed in the free slot
+    *  - move the best child to the free slot until the last node can be placed in the free slot
     */
    nodepq->len--;
 
    /* process the slots queue ordered by the node selection comparator */
-   lastnode = slots[nodepq->len];
-   lastbfspos = bfsposs[nodepq->len];
    parentfelldown = FALSE;
    if( freepos < nodepq->len )
    {
-      int parentpos;
+      int lastbfspos;
 
-      /* try to move parents downwards to insert last node */
-      parentpos = PQ_PARENT(freepos);
-      while( freepos > 0 && nodesel->nodeselcomp(set->scip, nodesel, lastnode, slots[parentpos]) < 0 )
-      {
-         slots[freepos] = slots[parentpos];
-         bfsposs[freepos] = bfsposs[parentpos];
-         bfsqueue[bfsposs[freepos]] = freepos;
-         freepos = parentpos;
-         parentpos = PQ_PARENT(freepos);
-         parentfelldown = TRUE;
-      }
+      /* place the last node in the free slot and move it to its position */
+      lastbfspos = nodepq->bfsposs[nodepq->len];
+      nodepq->slots[freepos] = nodepq->slots[nodepq->len];
+      nodepq->bfsposs[freepos] = lastbfspos;
+      nodepq->bfsqueue[lastbfspos] = freepos;
+
+      parentfelldown = (nodepqSiftUp(nodepq, set, freepos) != freepos);
       if( !parentfelldown )
-      {
-         /* downward moving of parents was not successful -> move children upwards */
-         while( freepos <= PQ_PARENT(nodepq->len-1) ) /* as long as free slot has children... */
-         {
-            int childpos;
-            int brotherpos;
-
-            /* select the better child of free slot */
-            childpos = PQ_LEFTCHILD(freepos);
-            assert(childpos < nodepq->len);
-            brotherpos = PQ_RIGHTCHILD(freepos);
-            if( brotherpos < nodepq->len
-               && nodesel->nodeselcomp(set->scip, nodesel, slots[brotherpos], slots[childpos]) < 0 )
-               childpos = brotherpos;
-
-            /* exit search loop if better child is not better than last node */
-            if( nodesel->nodeselcomp(set->scip, nodesel, lastnode, slots[childpos]) <= 0 )
-               break;
-
-            /* move better child upwards, free slot is now the better child's slot */
-            slots[freepos] = slots[childpos];
-            bfsposs[freepos] = bfsposs[childpos];
-            bfsqueue[bfsposs[freepos]] = freepos;
-            freepos = childpos;
-         }
-      }
-      assert(0 <= freepos && freepos < nodepq->len);
-      assert(!parentfelldown || PQ_LEFTCHILD(freepos) < nodepq->len);
-      slots[freepos] = lastnode;
-      bfsposs[freepos] = lastbfspos;
-      bfsqueue[lastbfspos] = freepos;
+         (void) nodepqSiftDown(nodepq, set, freepos);
    }
 
    /* process the bfs queue ordered by the lower bound */
-   lastbfsqueueidx = bfsqueue[nodepq->len];
-   bfsparentfelldown = FALSE;
    if( freebfspos < nodepq->len )
    {
-      SCIP_Real lastlowerbound;
-      int parentpos;
+      /* place the last entry in the free position and move it to its position */
+      nodepq->bfsqueue[freebfspos] = nodepq->bfsqueue[nodepq->len];
+      nodepq->bfslowerbounds[freebfspos] = nodepq->bfslowerbounds[nodepq->len];
+      nodepq->bfsposs[nodepq->bfsqueue[freebfspos]] = freebfspos;
 
-      /* try to move parents downwards to insert last queue index */
-      lastlowerbound = SCIPnodeGetLowerbound(slots[lastbfsqueueidx]);
-      parentpos = PQ_PARENT(freebfspos);
-      while( freebfspos > 0 && lastlowerbound < SCIPnodeGetLowerbound(slots[bfsqueue[parentpos]]) )
-      {
-         bfsqueue[freebfspos] = bfsqueue[parentpos];
-         bfsposs[bfsqueue[freebfspos]] = freebfspos;
-         freebfspos = parentpos;
-         parentpos = PQ_PARENT(freebfspos);
-         bfsparentfelldown = TRUE;
-      }
-      if( !bfsparentfelldown )
-      {
-         /* downward moving of parents was not successful -> move children upwards */
-         while( freebfspos <= PQ_PARENT(nodepq->len-1) ) /* as long as free slot has children... */
-         {
-            int childpos;
-            int brotherpos;
-
-            /* select the better child of free slot */
-            childpos = PQ_LEFTCHILD(freebfspos);
-            assert(childpos < nodepq->len);
-            brotherpos = PQ_RIGHTCHILD(freebfspos);
-            if( brotherpos < nodepq->len
-               && SCIPnodeGetLowerbound(slots[bfsqueue[brotherpos]]) < SCIPnodeGetLowerbound(slots[bfsqueue[childpos]]) )
-               childpos = brotherpos;
-
-            /* exit search loop if better child is not better than last node */
-            if( lastlowerbound <= SCIPnodeGetLowerbound(slots[bfsqueue[childpos]]) )
-               break;
-
-            /* move better child upwards, free slot is now the better child's slot */
-            bfsqueue[freebfspos] = bfsqueue[childpos];
-            bfsposs[bfsqueue[freebfspos]] = freebfspos;
-            freebfspos = childpos;
-         }
-      }
-      assert(0 <= freebfspos && freebfspos < nodepq->len);
-      assert(!bfsparentfelldown || PQ_LEFTCHILD(freebfspos) < nodepq->len);
-      bfsqueue[freebfspos] = lastbfsqueueidx;
-      bfsposs[lastbfsqueueidx] = freebfspos;
+      if( nodepqBfsSiftUp(nodepq, freebfspos) == freebfspos )
+         (void) nodepqBfsSiftDown(nodepq, freebfspos);
    }
 
    return parentfelldown;
@@ -590,12 +704,9 @@ SCIP_Real SCIPnodepqGetLowerbound(
 
    if( nodepq->len > 0 )
    {
-      int bfspos;
-
-      bfspos = nodepq->bfsqueue[0];
-      assert(0 <= bfspos && bfspos < nodepq->len);
-      assert(nodepq->slots[bfspos] != NULL);
-      return SCIPnodeGetLowerbound(nodepq->slots[bfspos]);
+      assert(0 <= nodepq->bfsqueue[0] && nodepq->bfsqueue[0] < nodepq->len);
+      assert(nodepq->slots[nodepq->bfsqueue[0]] != NULL);
+      return nodepq->bfslowerbounds[0];
    }
    else
       return SCIPsetInfinity(set);
@@ -635,7 +746,56 @@ SCIP_Real SCIPnodepqGetLowerboundSum(
    return nodepq->lowerboundsum;
 }
 
-/** free all nodes from the queue that are cut off by the given upper bound */
+/** returns whether the given node is cut off by the given cutoff bound
+ *
+ *  The node itself is checked instead of the lower bound stored in the bfs queue, since the lower bound of a leaf may
+ *  have been increased after its insertion, e.g., if it was cut off by SCIPnodeCutoff().
+ */
+static
+SCIP_Bool nodepqIsCutoff(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_NODE*            node,               /**< node to check */
+   SCIP_Real             cutoffbound         /**< cutoff bound: all nodes with lowerbound >= cutoffbound are cut off */
+   )
+{
+   return SCIPsetIsInfinity(set, SCIPnodeGetLowerbound(node)) || SCIPsetIsGE(set, SCIPnodeGetLowerbound(node), cutoffbound);
+}
+
+/** frees a node that was removed from the queue because it is cut off */
+static
+SCIP_RETCODE nodepqFreeCutoffNode(
+   SCIP_NODE**           node,               /**< pointer to the node */
+   BMS_BLKMEM*           blkmem,             /**< block memory buffer */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< dynamic problem statistics */
+   SCIP_EVENTFILTER*     eventfilter,        /**< event filter for global (not variable dependent) events */
+   SCIP_EVENTQUEUE*      eventqueue,         /**< event queue */
+   SCIP_TREE*            tree,               /**< branch and bound tree */
+   SCIP_REOPT*           reopt,              /**< reoptimization data structure */
+   SCIP_LP*              lp                  /**< current LP data */
+   )
+{
+   SCIPvisualCutoffNode(stat->visual, set, stat, *node, FALSE);
+
+   if( set->reopt_enable )
+   {
+      assert(reopt != NULL);
+      SCIP_CALL( SCIPreoptCheckCutoff(reopt, set, blkmem, *node, SCIP_EVENTTYPE_NODEINFEASIBLE, lp,
+            SCIPlpGetSolstat(lp), SCIPnodeGetDepth(*node) == 0, SCIPtreeGetFocusNode(tree) == *node,
+            SCIPnodeGetLowerbound(*node), SCIPtreeGetEffectiveRootDepth(tree)));
+   }
+
+   /* free memory of the node */
+   SCIP_CALL( SCIPnodeFree(node, blkmem, set, stat, eventfilter, eventqueue, tree, lp) );
+
+   return SCIP_OKAY;
+}
+
+/** free all nodes from the queue that are cut off by the given upper bound
+ *
+ *  If only a few nodes are cut off, they are deleted one after the other. Otherwise, all of them are removed at once and
+ *  the queue is rebuilt in linear time.
+ */
 SCIP_RETCODE SCIPnodepqBound(
    SCIP_NODEPQ*          nodepq,             /**< node priority queue */
    BMS_BLKMEM*           blkmem,             /**< block memory buffer */
@@ -650,58 +810,120 @@ SCIP_RETCODE SCIPnodepqBound(
    )
 {
    SCIP_NODE* node;
+   int ncutoffs;
    int pos;
    SCIP_Bool parentfelldown;
 
    assert(nodepq != NULL);
 
    SCIPsetDebugMsg(set, "bounding node queue of length %d with cutoffbound=%g\n", nodepq->len, cutoffbound);
-   pos = nodepq->len-1;
-   while( pos >= 0 )
+
+   ncutoffs = 0;
+   for( pos = 0; pos < nodepq->len; ++pos )
+   {
+      if( nodepqIsCutoff(set, nodepq->slots[pos], cutoffbound) )
+         ++ncutoffs;
+   }
+
+   if( ncutoffs == 0 )
+      return SCIP_OKAY;
+
+   /* deleting a node takes logarithmic time, rebuilding the queue takes linear time */
+   if( ncutoffs * LOG2((SCIP_Real)nodepq->len) >= nodepq->len )
    {
-      assert(pos < nodepq->len);
-      node = nodepq->slots[pos];
-      assert(node != NULL);
-      assert(SCIPnodeGetType(node) == SCIP_NODETYPE_LEAF);
-      if( SCIPsetIsInfinity(set, SCIPnodeGetLowerbound(node)) || SCIPsetIsGE(set, SCIPnodeGetLowerbound(node), cutoffbound) )
+      SCIP_NODE** cutoffnodes;
+      SCIP_Real* lowerbounds;
+      int len;
+      int i;
+
+      SCIP_CALL( SCIPsetAllocBufferArray(set, &cutoffnodes, ncutoffs) );
+      SCIP_CALL( SCIPsetAllocBufferArray(set, &lowerbounds, nodepq->len) );
+
+      for( pos = 0; pos < nodepq->len; ++pos )
+         lowerbounds[pos] = nodepq->bfslowerbounds[nodepq->bfsposs[pos]];
+
+      /* move the remaining nodes to the front of the slots */
+      len = 0;
+      ncutoffs = 0;
+      nodepq->lowerboundsum = 0.0;
+      for( pos = 0; pos < nodepq->len; ++pos )
       {
-         SCIPsetDebugMsg(set, "free node in slot %d (len=%d) at depth %d with lowerbound=%g\n",
-            pos, nodepq->len, SCIPnodeGetDepth(node), SCIPnodeGetLowerbound(node));
-
-         /* cut off node; because we looped from back to front, the existing children of the node must have a smaller
-          * lower bound than the cut off value
-          */
-         assert(PQ_LEFTCHILD(pos) >= nodepq->len
-            || SCIPsetIsLT(set, SCIPnodeGetLowerbound(nodepq->slots[PQ_LEFTCHILD(pos)]), cutoffbound));
-         assert(PQ_RIGHTCHILD(pos) >= nodepq->len
-            || SCIPsetIsLT(set, SCIPnodeGetLowerbound(nodepq->slots[PQ_RIGHTCHILD(pos)]), cutoffbound));
-
-         /* free the slot in the node PQ */
-         parentfelldown = nodepqDelPos(nodepq, set, pos);
-
-         /* - if the slot was occupied by the parent, we have to check this slot (the parent) again; unfortunately,
-          *   we will check the node which occupied the parent's slot again, even though it cannot be cut off;
-          * - otherwise, the slot was the last slot or it was occupied by a node with a position greater than
-          *   the current position; this node was already checked and we can decrease the position
-          */
-         if( !parentfelldown )
-            pos--;
+         node = nodepq->slots[pos];
+         assert(node != NULL);
+         assert(SCIPnodeGetType(node) == SCIP_NODETYPE_LEAF);
 
-         SCIPvisualCutoffNode(stat->visual, set, stat, node, FALSE);
+         if( nodepqIsCutoff(set, node, cutoffbound) )
+         {
+            SCIPsetDebugMsg(set, "free node in slot %d (len=%d) at depth %d with lowerbound=%g\n",
+               pos, nodepq->len, SCIPnodeGetDepth(node), SCIPnodeGetLowerbound(node));
 
-         if( set->reopt_enable )
+            cutoffnodes[ncutoffs] = node;
+            ++ncutoffs;
+         }
+         else
          {
-            assert(reopt != NULL);
-            SCIP_CALL( SCIPreoptCheckCutoff(reopt, set, blkmem, node, SCIP_EVENTTYPE_NODEINFEASIBLE, lp,
-                  SCIPlpGetSolstat(lp), SCIPnodeGetDepth(node) == 0, SCIPtreeGetFocusNode(tree) == node,
-                  SCIPnodeGetLowerbound(node), SCIPtreeGetEffectiveRootDepth(tree)));
+            nodepq->slots[len] = node;
+            nodepq->bfsposs[len] = len;
+            nodepq->bfsqueue[len] = len;
+            nodepq->bfslowerbounds[len] = lowerbounds[pos];
+            nodepq->lowerboundsum += lowerbounds[pos];
+            ++len;
          }
+      }
+      nodepq->len = len;
+
+      nodepqHeapify(nodepq, set);
+
+      for( i = 0; i < ncutoffs; ++i )
+      {
+         SCIP_CALL( nodepqFreeCutoffNode(&cutoffnodes[i], blkmem, set, stat, eventfilter, eventqueue, tree, reopt, lp) );
+      }
 
-         /* free memory of the node */
-         SCIP_CALL( SCIPnodeFree(&node, blkmem, set, stat, eventfilter, eventqueue, tree, lp) );
+      SCIPsetFreeBufferArray(set, &lowerbounds);
+      SCIPsetFreeBufferArray(set, &cutoffnodes);
+   }
+   else
+   {
+      pos = nodepq->len-1;
+      while( pos >= 0 )
+      {
+         assert(pos < nodepq->len);
+         node = nodepq->slots[pos];
+         assert(node != NULL);
+         assert(SCIPnodeGetType(node) == SCIP_NODETYPE_LEAF);
+         if( nodepqIsCutoff(set, node, cutoffbound) )
+         {
+#ifndef NDEBUG
+            int childpos;
+#endif
+
+            SCIPsetDebugMsg(set, "free node in slot %d (len=%d) at depth %d with lowerbound=%g\n",
+               pos, nodepq->len, SCIPnodeGetDepth(node), SCIPnodeGetLowerbound(node));
+
+            /* cut off node; because we looped from back to front, the existing children of the node must have a
+             * smaller lower bound than the cut off value
+             */
+#ifndef NDEBUG
+            for( childpos = PQ_FIRSTCHILD(pos); childpos < MIN(PQ_FIRSTCHILD(pos) + PQ_ARITY, nodepq->len); ++childpos )
+               assert(SCIPsetIsLT(set, SCIPnodeGetLowerbound(nodepq->slots[childpos]), cutoffbound));
+#endif
+
+            /* free the slot in the node PQ */
+            parentfelldown = nodepqDelPos(nodepq, set, pos);
+
+            /* - if the slot was occupied by the parent, we have to check this slot (the parent) again; unfortunately,
+             *   we will check the node which occupied the parent's slot again, even though it cannot be cut off;
+             * - otherwise, the slot was the last slot or it was occupied by a node with a position greater than
+             *   the current position; this node was already checked and we can decrease the position
+             */
+            if( !parentfelldown )
+               pos--;
+
+            SCIP_CALL( nodepqFreeCutoffNode(&node, blkmem, set, stat, eventfilter, eventqueue, tree, reopt, lp) );
+         }
+         else
+            pos--;
       }
-      else
-         pos--;
    }
    SCIPsetDebugMsg(set, " -> bounded node queue has length %d\n", nodepq->len);
 
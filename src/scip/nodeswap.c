@@ -0,0 +1,327 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2023 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   nodeswap.c
+ * @ingroup OTHER_CFILES
+ * @brief  methods for the on-disk storage of open nodes
+ *
+ * The data of a node is written as one record to an anonymous temporary file, which is deleted automatically when it is
+ * closed. If SCIP is compiled with zlib, each record is compressed on its own, such that it can be read without
+ * decompressing any other record.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <assert.h>
+#include <stdio.h>
+
+#include "scip/nodeswap.h"
+#include "scip/misc.h"
+#include "scip/pub_message.h"
+#include "scip/pub_misc.h"
+#include "scip/set.h"
+#include "scip/struct_nodeswap.h"
+
+#ifdef SCIP_WITH_ZLIB
+#include <zlib.h>
+#endif
+
+
+/** ensures that the record arrays can store at least num entries */
+static
+SCIP_RETCODE nodeswapEnsureRecordsSize(
+   SCIP_NODESWAP*        nodeswap,           /**< node swap storage */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   int                   num                 /**< minimal number of entries to store */
+   )
+{
+   assert(nodeswap != NULL);
+
+   if( num > nodeswap->recordssize )
+   {
+      int newsize;
+
+      newsize = SCIPsetCalcMemGrowSize(set, num);
+      SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &nodeswap->nodes, nodeswap->recordssize, newsize) );
+      SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &nodeswap->offsets, nodeswap->recordssize, newsize) );
+      SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &nodeswap->sizes, nodeswap->recordssize, newsize) );
+      SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &nodeswap->storedsizes, nodeswap->recordssize, newsize) );
+      nodeswap->recordssize = newsize;
+   }
+   assert(num <= nodeswap->recordssize);
+
+   return SCIP_OKAY;
+}
+
+/** creates the storage for open nodes; the swap file is only created when the first record is written */
+SCIP_RETCODE SCIPnodeswapCreate(
+   SCIP_NODESWAP**       nodeswap,           /**< pointer to store the node swap storage */
+   BMS_BLKMEM*           blkmem              /**< block memory */
+   )
+{
+   assert(nodeswap != NULL);
+   assert(blkmem != NULL);
+
+   SCIP_ALLOC( BMSallocBlockMemory(blkmem, nodeswap) );
+
+   SCIP_CALL( SCIPhashmapCreate(&(*nodeswap)->recordmap, blkmem, 100) );
+   (*nodeswap)->file = NULL;
+   (*nodeswap)->nodes = NULL;
+   (*nodeswap)->offsets = NULL;
+   (*nodeswap)->sizes = NULL;
+   (*nodeswap)->storedsizes = NULL;
+   (*nodeswap)->filesize = 0;
+   (*nodeswap)->nrecords = 0;
+   (*nodeswap)->recordssize = 0;
+
+   return SCIP_OKAY;
+}
+
+/** frees the storage for open nodes and deletes the swap file */
+void SCIPnodeswapFree(
+   SCIP_NODESWAP**       nodeswap,           /**< pointer to the node swap storage */
+   BMS_BLKMEM*           blkmem              /**< block memory */
+   )
+{
+   assert(nodeswap != NULL);
+   assert(*nodeswap != NULL);
+   assert((*nodeswap)->nrecords == 0);
+
+   /* the swap file is a temporary file, which is removed when it is closed */
+   if( (*nodeswap)->file != NULL )
+      (void) fclose((*nodeswap)->file);
+
+   BMSfreeBlockMemoryArrayNull(blkmem, &(*nodeswap)->storedsizes, (*nodeswap)->recordssize);
+   BMSfreeBlockMemoryArrayNull(blkmem, &(*nodeswap)->sizes, (*nodeswap)->recordssize);
+   BMSfreeBlockMemoryArrayNull(blkmem, &(*nodeswap)->offsets, (*nodeswap)->recordssize);
+   BMSfreeBlockMemoryArrayNull(blkmem, &(*nodeswap)->nodes, (*nodeswap)->recordssize);
+   SCIPhashmapFree(&(*nodeswap)->recordmap);
+   BMSfreeBlockMemory(blkmem, nodeswap);
+}
+
+/** writes the given data of a node to the swap file; the data is compressed if SCIP was compiled with zlib */
+SCIP_RETCODE SCIPnodeswapWrite(
+   SCIP_NODESWAP*        nodeswap,           /**< node swap storage */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_NODE*            node,               /**< node without record in the swap file */
+   const char*           data,               /**< data to write */
+   int                   size                /**< number of bytes to write */
+   )
+{
+   SCIP_RETCODE retcode;
+   const char* storeddata;
+   char* compresseddata;
+   int storedsize;
+   int pos;
+
+   assert(nodeswap != NULL);
+   assert(node != NULL);
+   assert(data != NULL);
+   assert(size > 0);
+   assert(!SCIPhashmapExists(nodeswap->recordmap, (void*)node));
+
+   if( nodeswap->file == NULL )
+   {
+      nodeswap->file = tmpfile();
+      if( nodeswap->file == NULL )
+      {
+         SCIPerrorMessage("cannot create swap file for open nodes\n");
+         return SCIP_FILECREATEERROR;
+      }
+   }
+
+   SCIP_CALL( nodeswapEnsureRecordsSize(nodeswap, blkmem, set, nodeswap->nrecords+1) );
+
+   storeddata = data;
+   storedsize = size;
+   compresseddata = NULL;
+
+#ifdef SCIP_WITH_ZLIB
+   {
+      uLongf compressedsize;
+
+      /* store the compressed data only if it is smaller */
+      compressedsize = compressBound((uLong)size);
+      SCIP_CALL( SCIPsetAllocBufferArray(set, &compresseddata, (int)compressedsize) );
+      if( compress2((Bytef*)compresseddata, &compressedsize, (const Bytef*)data, (uLong)size, Z_BEST_SPEED) == Z_OK
+         && (int)compressedsize < size )
+      {
+         storeddata = compresseddata;
+         storedsize = (int)compressedsize;
+      }
+   }
+#endif
+
+   retcode = SCIP_OKAY;
+   if( fseek(nodeswap->file, (long)nodeswap->filesize, SEEK_SET) != 0
+      || fwrite(storeddata, 1, (size_t)storedsize, nodeswap->file) != (size_t)storedsize )
+   {
+      SCIPerrorMessage("cannot write to swap file for open nodes\n");
+      retcode = SCIP_WRITEERROR;
+   }
+
+   if( compresseddata != NULL )
+      SCIPsetFreeBufferArray(set, &compresseddata);
+
+   SCIP_CALL( retcode );
+
+   pos = nodeswap->nrecords;
+   nodeswap->nodes[pos] = node;
+   nodeswap->offsets[pos] = nodeswap->filesize;
+   nodeswap->sizes[pos] = size;
+   nodeswap->storedsizes[pos] = storedsize;
+   SCIP_CALL( SCIPhashmapInsertInt(nodeswap->recordmap, (void*)node, pos) );
+   ++nodeswap->nrecords;
+   nodeswap->filesize += storedsize;
+
+   return SCIP_OKAY;
+}
+
+/** returns the size of the data of the given node that was written to the swap file */
+int SCIPnodeswapGetSize(
+   SCIP_NODESWAP*        nodeswap,           /**< node swap storage */
+   SCIP_NODE*            node                /**< node with record in the swap file */
+   )
+{
+   int pos;
+
+   assert(nodeswap != NULL);
+   assert(SCIPhashmapExists(nodeswap->recordmap, (void*)node));
+
+   pos = SCIPhashmapGetImageInt(nodeswap->recordmap, (void*)node);
+   assert(0 <= pos && pos < nodeswap->nrecords);
+   assert(nodeswap->nodes[pos] == node);
+
+   return nodeswap->sizes[pos];
+}
+
+/** reads the data of the given node from the swap file and deletes the record of the node */
+SCIP_RETCODE SCIPnodeswapRead(
+   SCIP_NODESWAP*        nodeswap,           /**< node swap storage */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_NODE*            node,               /**< node with record in the swap file */
+   char*                 data                /**< buffer of at least SCIPnodeswapGetSize() bytes to store the data */
+   )
+{
+   SCIP_RETCODE retcode;
+   char* storeddata;
+   int storedsize;
+   int size;
+   int pos;
+   int last;
+
+   assert(nodeswap != NULL);
+   assert(nodeswap->file != NULL);
+   assert(data != NULL);
+   assert(SCIPhashmapExists(nodeswap->recordmap, (void*)node));
+
+   pos = SCIPhashmapGetImageInt(nodeswap->recordmap, (void*)node);
+   assert(0 <= pos && pos < nodeswap->nrecords);
+   assert(nodeswap->nodes[pos] == node);
+
+   size = nodeswap->sizes[pos];
+   storedsize = nodeswap->storedsizes[pos];
+   assert(storedsize <= size);
+
+   /* uncompressed records are read directly into the given buffer */
+   if( storedsize < size )
+   {
+      SCIP_CALL( SCIPsetAllocBufferArray(set, &storeddata, storedsize) );
+   }
+   else
+      storeddata = data;
+
+   retcode = SCIP_OKAY;
+   if( fseek(nodeswap->file, (long)nodeswap->offsets[pos], SEEK_SET) != 0
+      || fread(storeddata, 1, (size_t)storedsize, nodeswap->file) != (size_t)storedsize )
+   {
+      SCIPerrorMessage("cannot read from swap file for open nodes\n");
+      retcode = SCIP_READERROR;
+   }
+
+   if( storedsize < size )
+   {
+#ifdef SCIP_WITH_ZLIB
+      if( retcode == SCIP_OKAY )
+      {
+         uLongf uncompressedsize;
+
+         uncompressedsize = (uLongf)size;
+         if( uncompress((Bytef*)data, &uncompressedsize, (const Bytef*)storeddata, (uLong)storedsize) != Z_OK
+            || (int)uncompressedsize != size )
+         {
+            SCIPerrorMessage("cannot decompress record of swap file for open nodes\n");
+            retcode = SCIP_READERROR;
+         }
+      }
+#else
+      SCIPerrorMessage("cannot decompress record of swap file for open nodes without zlib\n");
+      retcode = SCIP_READERROR;
+#endif
+      SCIPsetFreeBufferArray(set, &storeddata);
+   }
+
+   SCIP_CALL( retcode );
+
+   /* delete the record by moving the last record to its position */
+   last = nodeswap->nrecords-1;
+   SCIP_CALL( SCIPhashmapRemove(nodeswap->recordmap, (void*)node) );
+   if( pos < last )
+   {
+      nodeswap->nodes[pos] = nodeswap->nodes[last];
+      nodeswap->offsets[pos] = nodeswap->offsets[last];
+      nodeswap->sizes[pos] = nodeswap->sizes[last];
+      nodeswap->storedsizes[pos] = nodeswap->storedsizes[last];
+      SCIP_CALL( SCIPhashmapSetImageInt(nodeswap->recordmap, (void*)nodeswap->nodes[pos], pos) );
+   }
+   --nodeswap->nrecords;
+
+   /* reuse the swap file from its beginning as soon as it is empty */
+   if( nodeswap->nrecords == 0 )
+      nodeswap->filesize = 0;
+
+   return SCIP_OKAY;
+}
+
+/** returns the number of nodes with a record in the swap file */
+int SCIPnodeswapGetNNodes(
+   SCIP_NODESWAP*        nodeswap            /**< node swap storage */
+   )
+{
+   assert(nodeswap != NULL);
+
+   return nodeswap->nrecords;
+}
+
+/** returns the size of the swap file in bytes */
+SCIP_Longint SCIPnodeswapGetFileSize(
+   SCIP_NODESWAP*        nodeswap            /**< node swap storage */
+   )
+{
+   assert(nodeswap != NULL);
+
+   return nodeswap->filesize;
+}
@@ -0,0 +1,97 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2023 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   nodeswap.h
+ * @ingroup INTERNALAPI
+ * @brief  internal methods for the on-disk storage of open nodes
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SCIP_NODESWAP_H__
+#define __SCIP_NODESWAP_H__
+
+
+#include "scip/def.h"
+#include "blockmemshell/memory.h"
+#include "scip/type_nodeswap.h"
+#include "scip/type_retcode.h"
+#include "scip/type_set.h"
+#include "scip/type_tree.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** creates the storage for open nodes; the swap file is only created when the first record is written */
+SCIP_RETCODE SCIPnodeswapCreate(
+   SCIP_NODESWAP**       nodeswap,           /**< pointer to store the node swap storage */
+   BMS_BLKMEM*           blkmem              /**< block memory */
+   );
+
+/** frees the storage for open nodes and deletes the swap file */
+void SCIPnodeswapFree(
+   SCIP_NODESWAP**       nodeswap,           /**< pointer to the node swap storage */
+   BMS_BLKMEM*           blkmem              /**< block memory */
+   );
+
+/** writes the given data of a node to the swap file; the data is compressed if SCIP was compiled with zlib */
+SCIP_RETCODE SCIPnodeswapWrite(
+   SCIP_NODESWAP*        nodeswap,           /**< node swap storage */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_NODE*            node,               /**< node without record in the swap file */
+   const char*           data,               /**< data to write */
+   int                   size                /**< number of bytes to write */
+   );
+
+/** returns the size of the data of the given node that was written to the swap file */
+int SCIPnodeswapGetSize(
+   SCIP_NODESWAP*        nodeswap,           /**< node swap storage */
+   SCIP_NODE*            node                /**< node with record in the swap file */
+   );
+
+/** reads the data of the given node from the swap file and deletes the record of the node */
+SCIP_RETCODE SCIPnodeswapRead(
+   SCIP_NODESWAP*        nodeswap,           /**< node swap storage */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_NODE*            node,               /**< node with record in the swap file */
+   char*                 data                /**< buffer of at least SCIPnodeswapGetSize() bytes to store the data */
+   );
+
+/** returns the number of nodes with a record in the swap file */
+int SCIPnodeswapGetNNodes(
+   SCIP_NODESWAP*        nodeswap            /**< node swap storage */
+   );
+
+/** returns the size of the swap file in bytes */
+SCIP_Longint SCIPnodeswapGetFileSize(
+   SCIP_NODESWAP*        nodeswap            /**< node swap storage */
+   );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -61,6 +61,7 @@
 #include "scip/pub_prop.h"
 #include "scip/pub_tree.h"
 #include "scip/pub_var.h"
+#include "scip/scip_concurrent.h"
 #include "scip/scip_cons.h"
 #include "scip/scip_copy.h"
 #include "scip/scip_cut.h"
@@ -78,6 +79,8 @@
 #include "scip/scip_solvingstats.h"
 #include "scip/scip_tree.h"
 #include "scip/scip_var.h"
+#include "lpi/lpi.h"
+#include "tpi/tpi.h"
 
 #define PROP_NAME                       "obbt"
 #define PROP_DESC                       "optimization-based bound tightening propagator"
@@ -126,6 +129,11 @@
 #define DEFAULT_ITLIMITFAC_BILININEQS    3.0 /**< multiple of OBBT LP limit used as total LP iteration limit for solving bilinear inequality LPs (< 0 for no limit) */
 #define DEFAULT_MINNONCONVEXITY         1e-1 /**< minimum nonconvexity for choosing a bilinear term */
 #define DEFAULT_RANDSEED                 149 /**< initial random seed */
+#define DEFAULT_NTHREADS                   1 /**< number of threads to solve the OBBT LPs (1: sequential) */
+
+#define PARALLEL_BOUNDSPERROUND          100 /**< number of bounds solved by all threads between two exchanges of the
+                                              *   tightened bounds; it does not depend on the number of threads, such
+                                              *   that neither do the rounds */
 
 /*
  * Data structures
@@ -167,6 +175,51 @@ struct BilinBound
 };
 typedef struct BilinBound BILINBOUND;
 
+/** LP data shared by the jobs of parallel OBBT; each job solves its LPs on its own copy of the probing LP */
+struct ObbtLpData
+{
+   SCIP_Real*            obj;                /**< objective coefficients of the columns (all zero) */
+   SCIP_Real*            lb;                 /**< lower bounds of the columns */
+   SCIP_Real*            ub;                 /**< upper bounds of the columns */
+   SCIP_Real*            lhs;                /**< left hand sides of the rows */
+   SCIP_Real*            rhs;                /**< right hand sides of the rows */
+   int*                  beg;                /**< start index of each column in ind- and val-array */
+   int*                  ind;                /**< row indices of the matrix entries */
+   SCIP_Real*            val;                /**< values of the matrix entries */
+   int*                  cstat;              /**< basis status of the columns */
+   int*                  rstat;              /**< basis status of the rows */
+   int                   ncols;              /**< number of columns */
+   int                   nrows;              /**< number of rows */
+   int                   nnonz;              /**< number of matrix entries */
+   SCIP_Real             feastol;            /**< primal feasibility tolerance */
+   SCIP_Real             dualfeastol;        /**< feasibility tolerance for reduced costs */
+   SCIP_Real             conditionlimit;     /**< maximum condition limit used in LP solver (-1.0: no limit) */
+   int                   scaling;            /**< scaling setting of the LP solver */
+   int*                  candcols;           /**< LP columns of the candidate bounds */
+   SCIP_BOUNDTYPE*       candtypes;          /**< types of the candidate bounds */
+   SCIP_Real*            candvals;           /**< optimal values of the candidate bounds' LPs */
+   SCIP_Bool*            candsolved;         /**< was the LP of the candidate bound solved? */
+   SCIP_Bool*            candoptimal;        /**< was the LP of the candidate bound solved to optimality? */
+   int*                  chgcols;            /**< columns whose bounds were tightened in the previous round */
+   int                   nchgcols;           /**< number of columns whose bounds were tightened in the previous round */
+};
+typedef struct ObbtLpData OBBTLPDATA;
+
+/** job of parallel OBBT, solving a range of candidate bounds per round */
+struct ObbtJob
+{
+   OBBTLPDATA*           lpdata;             /**< shared LP data */
+   SCIP_LPI*             lpi;                /**< LP solver of the job, kept over the rounds, or NULL if not created yet */
+   SCIP_Real*            primsol;            /**< buffer for the primal solution of the job's LP */
+   SCIP_Real*            activity;           /**< buffer for the row activities of the job's LP */
+   SCIP_Longint          itlimit;            /**< iteration limit of the job in the current round (-1: no limit) */
+   SCIP_Longint          niterations;        /**< number of LP iterations of the job in the current round */
+   int                   start;              /**< first candidate of the job in the current round */
+   int                   end;                /**< last candidate (exclusive) of the job in the current round */
+   SCIP_Bool             error;              /**< did an LP error occur in the job? */
+};
+typedef struct ObbtJob OBBTJOB;
+
 /** propagator data */
 struct SCIP_PropData
 {
@@ -228,6 +281,7 @@ struct SCIP_PropData
    int                   propagatefreq;      /**< trigger a propagation round after that many bound tightenings
                                               *   (0: no propagation) */
    int                   propagatecounter;   /**< number of bound tightenings since the last propagation round */
+   int                   nthreads;           /**< number of threads to solve the OBBT LPs (1: sequential) */
 };
 
 
@@ -1981,6 +2035,463 @@ SCIP_RETCODE findNewBounds(
    return SCIP_OKAY;
 }
 
+/** sets a parameter of the LP solver of a parallel OBBT job, ignoring unknown parameters */
+static
+SCIP_RETCODE obbtLpiSetRealpar(
+   SCIP_LPI*             lpi,                /**< LP solver */
+   SCIP_LPPARAM          lpparam,            /**< LP parameter */
+   SCIP_Real             value               /**< value to set parameter to */
+   )
+{
+   SCIP_RETCODE retcode;
+
+   retcode = SCIPlpiSetRealpar(lpi, lpparam, value);
+
+   return retcode == SCIP_PARAMETERUNKNOWN ? SCIP_OKAY : retcode;
+}
+
+/** sets a parameter of the LP solver of a parallel OBBT job, ignoring unknown parameters */
+static
+SCIP_RETCODE obbtLpiSetIntpar(
+   SCIP_LPI*             lpi,                /**< LP solver */
+   SCIP_LPPARAM          lpparam,            /**< LP parameter */
+   int                   value               /**< value to set parameter to */
+   )
+{
+   SCIP_RETCODE retcode;
+
+   retcode = SCIPlpiSetIntpar(lpi, lpparam, value);
+
+   return retcode == SCIP_PARAMETERUNKNOWN ? SCIP_OKAY : retcode;
+}
+
+/** checks whether the LP of a parallel OBBT job was solved to optimality with a stable, primal feasible solution
+ *
+ *  SCIP does not trust the optimality status of its own LP solves either, but checks the stability of the basis and the
+ *  primal feasibility of the solution w.r.t. the bounds and sides of the LP; the job's LP gets the same checks before
+ *  the value of the column is used to tighten the bound.
+ */
+static
+SCIP_RETCODE obbtJobCheckSol(
+   OBBTJOB*              job,                /**< the job */
+   int                   col,                /**< column whose bound is tightened */
+   SCIP_Bool*            valid               /**< pointer to store whether the solution can be used */
+   )
+{
+   OBBTLPDATA* lpdata;
+   SCIP_Bool primalfeasible;
+   SCIP_Bool dualfeasible;
+   int i;
+
+   lpdata = job->lpdata;
+   *valid = FALSE;
+
+   if( !SCIPlpiIsOptimal(job->lpi) || !SCIPlpiIsStable(job->lpi) )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPlpiGetSolFeasibility(job->lpi, &primalfeasible, &dualfeasible) );
+   if( !primalfeasible || !dualfeasible )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPlpiGetSol(job->lpi, NULL, job->primsol, NULL, job->activity, NULL) );
+
+   if( !SCIPlpiIsInfinity(job->lpi, REALABS(job->primsol[col])) )
+      *valid = TRUE;
+
+   /* use the same relative feasibility tolerance as SCIP's primal feasibility check of the LP solution */
+   for( i = 0; i < lpdata->ncols && *valid; ++i )
+   {
+      if( job->primsol[i] < lpdata->lb[i] - lpdata->feastol * MAX(1.0, REALABS(lpdata->lb[i]))
+         || job->primsol[i] > lpdata->ub[i] + lpdata->feastol * MAX(1.0, REALABS(lpdata->ub[i])) )
+         *valid = FALSE;
+   }
+
+   for( i = 0; i < lpdata->nrows && *valid; ++i )
+   {
+      if( job->activity[i] < lpdata->lhs[i] - lpdata->feastol * MAX(1.0, REALABS(lpdata->lhs[i]))
+         || job->activity[i] > lpdata->rhs[i] + lpdata->feastol * MAX(1.0, REALABS(lpdata->rhs[i])) )
+         *valid = FALSE;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** solves the LPs of the candidate bounds of a parallel OBBT job in the current round
+ *
+ *  In the first round, the job loads the probing LP into its own LP solver and warm starts it from the basis of the
+ *  probing LP; in later rounds, it only applies the bounds that were tightened in the previous round.
+ */
+static
+SCIP_RETCODE obbtJobSolve(
+   OBBTJOB*              job                 /**< the job */
+   )
+{
+   OBBTLPDATA* lpdata;
+   SCIP_Real zero;
+   int c;
+
+   lpdata = job->lpdata;
+   zero = 0.0;
+
+   if( job->lpi == NULL )
+   {
+      SCIP_CALL( SCIPlpiCreate(&job->lpi, NULL, "obbt", SCIP_OBJSEN_MINIMIZE) );
+      SCIP_CALL( SCIPlpiLoadColLP(job->lpi, SCIP_OBJSEN_MINIMIZE, lpdata->ncols, lpdata->obj, lpdata->lb, lpdata->ub,
+            NULL, lpdata->nrows, lpdata->lhs, lpdata->rhs, NULL, lpdata->nnonz, lpdata->beg, lpdata->ind, lpdata->val) );
+
+      SCIP_CALL( obbtLpiSetIntpar(job->lpi, SCIP_LPPAR_LPINFO, FALSE) );
+      SCIP_CALL( obbtLpiSetIntpar(job->lpi, SCIP_LPPAR_THREADS, 1) );
+      SCIP_CALL( obbtLpiSetIntpar(job->lpi, SCIP_LPPAR_SCALING, lpdata->scaling) );
+      SCIP_CALL( obbtLpiSetRealpar(job->lpi, SCIP_LPPAR_FEASTOL, lpdata->feastol) );
+      SCIP_CALL( obbtLpiSetRealpar(job->lpi, SCIP_LPPAR_DUALFEASTOL, lpdata->dualfeastol) );
+      if( lpdata->conditionlimit > 0.0 )
+      {
+         SCIP_CALL( obbtLpiSetRealpar(job->lpi, SCIP_LPPAR_CONDITIONLIMIT, lpdata->conditionlimit) );
+      }
+
+      SCIP_CALL( SCIPlpiSetBase(job->lpi, lpdata->cstat, lpdata->rstat) );
+   }
+   else if( lpdata->nchgcols > 0 )
+   {
+      int i;
+
+      for( i = 0; i < lpdata->nchgcols; ++i )
+      {
+         int col = lpdata->chgcols[i];
+
+         SCIP_CALL( SCIPlpiChgBounds(job->lpi, 1, &col, &lpdata->lb[col], &lpdata->ub[col]) );
+      }
+   }
+
+   for( c = job->start; c < job->end; ++c )
+   {
+      SCIP_Real coef;
+      int col;
+      int iter;
+
+      /* stop if the iteration limit of the job is exhausted; the remaining bounds stay unsolved */
+      if( job->itlimit >= 0 && job->niterations >= job->itlimit )
+         break;
+
+      SCIP_CALL( obbtLpiSetIntpar(job->lpi, SCIP_LPPAR_LPITLIM,
+            job->itlimit < 0 ? INT_MAX : (int) MIN(job->itlimit - job->niterations, INT_MAX)) );
+
+      /* the objective changes, but the basis stays primal feasible */
+      col = lpdata->candcols[c];
+      coef = lpdata->candtypes[c] == SCIP_BOUNDTYPE_LOWER ? 1.0 : -1.0;
+      SCIP_CALL( SCIPlpiChgObj(job->lpi, 1, &col, &coef) );
+      SCIP_CALL( SCIPlpiSolvePrimal(job->lpi) );
+
+      SCIP_CALL( SCIPlpiGetIterations(job->lpi, &iter) );
+      job->niterations += iter;
+
+      /* as SCIP does for its own LP, resolve an unstable LP from scratch before giving up on the bound */
+      if( !SCIPlpiIsOptimal(job->lpi) && !SCIPlpiIsIterlimExc(job->lpi) && !SCIPlpiIsTimelimExc(job->lpi) )
+      {
+         SCIP_CALL( obbtLpiSetIntpar(job->lpi, SCIP_LPPAR_FROMSCRATCH, TRUE) );
+         SCIP_CALL( SCIPlpiSolvePrimal(job->lpi) );
+         SCIP_CALL( obbtLpiSetIntpar(job->lpi, SCIP_LPPAR_FROMSCRATCH, FALSE) );
+
+         SCIP_CALL( SCIPlpiGetIterations(job->lpi, &iter) );
+         job->niterations += iter;
+      }
+
+      lpdata->candsolved[c] = TRUE;
+      SCIP_CALL( obbtJobCheckSol(job, col, &lpdata->candoptimal[c]) );
+
+      if( lpdata->candoptimal[c] )
+         lpdata->candvals[c] = job->primsol[col];
+
+      SCIP_CALL( SCIPlpiChgObj(job->lpi, 1, &col, &zero) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** executes a parallel OBBT job; LP errors are reported to the main thread, which stops OBBT as in the sequential case */
+static
+SCIP_RETCODE obbtJobExec(
+   void*                 args                /**< the job */
+   )
+{
+   OBBTJOB* job;
+
+   job = (OBBTJOB*) args;
+   assert(job != NULL);
+
+   job->niterations = 0;
+
+   if( !job->error && obbtJobSolve(job) != SCIP_OKAY )
+      job->error = TRUE;
+
+   return SCIP_OKAY;
+}
+
+/** finds new variable bounds by solving the OBBT LPs in parallel
+ *
+ *  The probing LP with zero objective is solved once and copied to one LP solver per thread. The candidate bounds
+ *  are processed in rounds of a fixed number of candidates, in which each thread solves a contiguous range of the
+ *  candidates. Between the rounds, the tightened bounds are applied in candidate order and passed to all threads, such
+ *  that the result does neither depend on the timing nor, as long as the iteration limit is not reached, on the number
+ *  of the threads. Generalized variable bounds, trivial filtering, and the greedy ordering need the LP solution of SCIP
+ *  and are not applied.
+ */
+static
+SCIP_RETCODE findNewBoundsParallel(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROPDATA*        propdata,           /**< data of the obbt propagator */
+   SCIP_Longint*         nleftiterations     /**< pointer to store the number of left iterations */
+   )
+{
+   OBBTLPDATA lpdata;
+   OBBTJOB* jobs;
+   BOUND** cands;
+   SCIP_LPI* lpi;
+   SCIP_Longint nolditerations;
+   SCIP_RETCODE retcode;
+   SCIP_Bool optimal;
+   SCIP_Bool error;
+   int ncands;
+   int nsolved;
+   int njobs;
+   int phase;
+   int i;
+
+   assert(scip != NULL);
+   assert(propdata != NULL);
+   assert(nleftiterations != NULL);
+   assert(propdata->nthreads > 1);
+
+   SCIP_CALL( sortBounds(scip, propdata) );
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &cands, propdata->nbounds) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lpdata.candcols, propdata->nbounds) );
+
+   /* collect the candidates, nonconvex bounds first; bounds of variables without an LP column cannot be tightened */
+   ncands = 0;
+   for( phase = 0; phase < 2; ++phase )
+   {
+      for( i = 0; i < propdata->nbounds; ++i )
+      {
+         BOUND* bound = propdata->bounds[i];
+
+         if( bound->done || bound->filtered || bound->nonconvex != (phase == 0) )
+            continue;
+
+         if( SCIPvarGetStatus(bound->var) != SCIP_VARSTATUS_COLUMN || !SCIPcolIsInLP(SCIPvarGetCol(bound->var)) )
+         {
+            bound->done = TRUE;
+            continue;
+         }
+
+         cands[ncands++] = bound;
+      }
+   }
+
+   if( ncands == 0 )
+   {
+      SCIPfreeBufferArray(scip, &lpdata.candcols);
+      SCIPfreeBufferArray(scip, &cands);
+
+      return SCIP_OKAY;
+   }
+
+   /* solve the probing LP with zero objective to obtain a primal feasible basis for all threads */
+   nolditerations = SCIPgetNLPIterations(scip);
+   propdata->nprobingiterations -= nolditerations;
+   SCIP_CALL( solveLP(scip, (int) *nleftiterations, &error, &optimal) );
+   propdata->nprobingiterations += SCIPgetNLPIterations(scip);
+   *nleftiterations = getIterationsLeft(scip, nolditerations, *nleftiterations);
+
+   if( error || !optimal || *nleftiterations == 0 )
+   {
+      SCIPfreeBufferArray(scip, &lpdata.candcols);
+      SCIPfreeBufferArray(scip, &cands);
+
+      return SCIP_OKAY;
+   }
+
+   /* copy the probing LP */
+   SCIP_CALL( SCIPgetLPI(scip, &lpi) );
+   SCIP_CALL( SCIPlpiGetNCols(lpi, &lpdata.ncols) );
+   SCIP_CALL( SCIPlpiGetNRows(lpi, &lpdata.nrows) );
+   SCIP_CALL( SCIPlpiGetNNonz(lpi, &lpdata.nnonz) );
+
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &lpdata.obj, lpdata.ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lpdata.lb, lpdata.ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lpdata.ub, lpdata.ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lpdata.beg, lpdata.ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lpdata.cstat, lpdata.ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lpdata.chgcols, lpdata.ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lpdata.ind, lpdata.nnonz) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lpdata.val, lpdata.nnonz) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lpdata.lhs, lpdata.nrows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lpdata.rhs, lpdata.nrows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lpdata.rstat, lpdata.nrows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lpdata.candtypes, ncands) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lpdata.candvals, ncands) );
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &lpdata.candsolved, ncands) );
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &lpdata.candoptimal, ncands) );
+
+   SCIP_CALL( SCIPlpiGetCols(lpi, 0, lpdata.ncols - 1, lpdata.lb, lpdata.ub, &lpdata.nnonz, lpdata.beg, lpdata.ind,
+         lpdata.val) );
+   SCIP_CALL( SCIPlpiGetSides(lpi, 0, lpdata.nrows - 1, lpdata.lhs, lpdata.rhs) );
+   SCIP_CALL( SCIPlpiGetBase(lpi, lpdata.cstat, lpdata.rstat) );
+   SCIP_CALL( SCIPgetIntParam(scip, "lp/scaling", &lpdata.scaling) );
+
+   lpdata.feastol = SCIPgetLPFeastol(scip);
+   lpdata.dualfeastol = SCIPdualfeastol(scip);
+   lpdata.conditionlimit = propdata->conditionlimit;
+   lpdata.nchgcols = 0;
+
+   for( i = 0; i < ncands; ++i )
+   {
+      lpdata.candcols[i] = SCIPcolGetLPPos(SCIPvarGetCol(cands[i]->var));
+      lpdata.candtypes[i] = cands[i]->boundtype;
+      assert(lpdata.candcols[i] >= 0 && lpdata.candcols[i] < lpdata.ncols);
+   }
+
+   njobs = MIN3(propdata->nthreads, ncands, PARALLEL_BOUNDSPERROUND);
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &jobs, njobs) );
+   for( i = 0; i < njobs; ++i )
+   {
+      jobs[i].lpdata = &lpdata;
+      SCIP_CALL( SCIPallocBufferArray(scip, &jobs[i].primsol, lpdata.ncols) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &jobs[i].activity, lpdata.nrows) );
+   }
+
+   SCIP_CALL( SCIPinitTpi(scip, njobs) );
+
+   retcode = SCIP_OKAY;
+   nsolved = 0;
+   while( nsolved < ncands && retcode == SCIP_OKAY && !SCIPisStopped(scip) )
+   {
+      SCIP_Bool jobserror;
+      int roundend;
+      int jobid;
+      int j;
+
+      roundend = MIN(ncands, nsolved + PARALLEL_BOUNDSPERROUND);
+
+      /* each job solves a contiguous range of the round's candidates */
+      jobid = SCIPtpiGetNewJobID();
+      for( j = 0; j < njobs && retcode == SCIP_OKAY; ++j )
+      {
+         SCIP_SUBMITSTATUS status;
+         SCIP_JOB* job;
+
+         jobs[j].start = nsolved + (int) ((SCIP_Longint) j * (roundend - nsolved) / njobs);
+         jobs[j].end = nsolved + (int) ((SCIP_Longint) (j + 1) * (roundend - nsolved) / njobs);
+         jobs[j].itlimit = *nleftiterations < 0 ? -1 : MAX(*nleftiterations / njobs, 1);
+
+         retcode = SCIPtpiCreateJob(&job, jobid, obbtJobExec, (void*) &jobs[j]);
+
+         if( retcode == SCIP_OKAY )
+         {
+            retcode = SCIPtpiSubmitJob(job, &status);
+
+            if( retcode == SCIP_OKAY && status != SCIP_SUBMIT_SUCCESS )
+               retcode = SCIP_ERROR;
+         }
+      }
+
+      /* all submitted jobs are collected, even after an error */
+      retcode = MIN(retcode, SCIPtpiCollectJobs(jobid));
+
+      if( retcode != SCIP_OKAY )
+         break;
+
+      jobserror = FALSE;
+      for( j = 0; j < njobs; ++j )
+      {
+         jobserror = jobserror || jobs[j].error;
+         propdata->nprobingiterations += jobs[j].niterations;
+
+         if( *nleftiterations >= 0 )
+            *nleftiterations = MAX(*nleftiterations - jobs[j].niterations, 0);
+      }
+
+      if( jobserror )
+      {
+         SCIPwarningMessage(scip, "   error while solving LP in parallel obbt; the remaining bounds are skipped\n");
+         break;
+      }
+
+      /* apply the results in candidate order and collect the tightened bounds for the next round */
+      lpdata.nchgcols = 0;
+      for( i = nsolved; i < roundend; ++i )
+      {
+         BOUND* bound = cands[i];
+         SCIP_Bool success;
+
+         if( !lpdata.candsolved[i] )
+            continue;
+
+         bound->done = TRUE;
+         propdata->nsolvedbounds++;
+
+         if( !lpdata.candoptimal[i] )
+            continue;
+
+         bound->newval = lpdata.candvals[i];
+         bound->found = TRUE;
+
+         success = FALSE;
+         if( (propdata->tightintboundsprobing && SCIPvarIsIntegral(bound->var))
+            || (propdata->tightcontboundsprobing && !SCIPvarIsIntegral(bound->var)) )
+         {
+            SCIP_CALL( tightenBoundProbing(scip, bound, bound->newval, &success) );
+         }
+
+         if( success )
+         {
+            int col = lpdata.candcols[i];
+
+            lpdata.lb[col] = SCIPvarGetLbLocal(bound->var);
+            lpdata.ub[col] = SCIPvarGetUbLocal(bound->var);
+            lpdata.chgcols[lpdata.nchgcols++] = col;
+         }
+      }
+
+      nsolved = roundend;
+
+      if( *nleftiterations == 0 )
+         break;
+   }
+
+   for( i = njobs - 1; i >= 0; --i )
+   {
+      if( jobs[i].lpi != NULL )
+      {
+         SCIP_CALL( SCIPlpiFree(&jobs[i].lpi) );
+      }
+
+      SCIPfreeBufferArray(scip, &jobs[i].activity);
+      SCIPfreeBufferArray(scip, &jobs[i].primsol);
+   }
+
+   SCIPfreeBufferArray(scip, &jobs);
+   SCIPfreeBufferArray(scip, &lpdata.candoptimal);
+   SCIPfreeBufferArray(scip, &lpdata.candsolved);
+   SCIPfreeBufferArray(scip, &lpdata.candvals);
+   SCIPfreeBufferArray(scip, &lpdata.candtypes);
+   SCIPfreeBufferArray(scip, &lpdata.rstat);
+   SCIPfreeBufferArray(scip, &lpdata.rhs);
+   SCIPfreeBufferArray(scip, &lpdata.lhs);
+   SCIPfreeBufferArray(scip, &lpdata.val);
+   SCIPfreeBufferArray(scip, &lpdata.ind);
+   SCIPfreeBufferArray(scip, &lpdata.chgcols);
+   SCIPfreeBufferArray(scip, &lpdata.cstat);
+   SCIPfreeBufferArray(scip, &lpdata.beg);
+   SCIPfreeBufferArray(scip, &lpdata.ub);
+   SCIPfreeBufferArray(scip, &lpdata.lb);
+   SCIPfreeBufferArray(scip, &lpdata.obj);
+   SCIPfreeBufferArray(scip, &lpdata.candcols);
+   SCIPfreeBufferArray(scip, &cands);
+
+   return retcode;
+}
+
 
 /** main function of obbt */
 static
@@ -2127,12 +2638,21 @@ SCIP_RETCODE applyObbt(
       }
    }
 
-   /* find new bounds for the variables */
-   SCIP_CALL( findNewBounds(scip, propdata, &nleftiterations, FALSE) );
-
-   if( nleftiterations > 0 || itlimit < 0 )
+   /* find new bounds for the variables; solving the LPs in parallel does not support the features that need the LP
+    * solution of SCIP after each LP
+    */
+   if( propdata->nthreads > 1 && !propdata->separatesol && propdata->propagatefreq == 0 && SCIPtpiIsAvailable() )
+   {
+      SCIP_CALL( findNewBoundsParallel(scip, propdata, &nleftiterations) );
+   }
+   else
    {
-      SCIP_CALL( findNewBounds(scip, propdata, &nleftiterations, TRUE) );
+      SCIP_CALL( findNewBounds(scip, propdata, &nleftiterations, FALSE) );
+
+      if( nleftiterations > 0 || itlimit < 0 )
+      {
+         SCIP_CALL( findNewBounds(scip, propdata, &nleftiterations, TRUE) );
+      }
    }
 
    /* reset dual feastol and condition limit */
@@ -3273,5 +3793,10 @@ SCIP_RETCODE SCIPincludePropObbt(
         "trigger a propagation round after that many bound tightenings (0: no propagation)",
         &propdata->propagatefreq, TRUE, DEFAULT_PROPAGATEFREQ, 0, INT_MAX, NULL, NULL) );
 
+  SCIP_CALL( SCIPaddIntParam(scip, "propagating/" PROP_NAME "/nthreads",
+        "number of threads to solve the OBBT LPs on copies of the probing LP (1: sequential); the parallel solve "
+        "creates no genvbounds and is not used with separatesol or propagatefreq",
+        &propdata->nthreads, TRUE, DEFAULT_NTHREADS, 1, 64, NULL, NULL) );
+
    return SCIP_OKAY;
 }
@@ -1029,6 +1029,269 @@ SCIP_RETCODE SCIPhashmapRemoveAll(
 /**@} */
 
 
+/*
+ * Concurrent Hash Table and Hash Map
+ */
+
+/**@defgroup ConcHash Concurrent Hash Table and Hash Map
+ * @ingroup DataStructures
+ * @brief hash table and hash map that can be accessed by several threads at the same time
+ *
+ * The elements are distributed over stripes, each of which is a hash table or hash map with its own lock. All methods
+ * except for creating and freeing may be called by several threads at the same time.
+ *
+ *@{
+ */
+
+/** creates a concurrent hash table
+ *
+ *  The elements are distributed over the given number of stripes, rounded up to a power of two. Each stripe is a hash
+ *  table with its own lock and block memory, such that threads accessing different stripes do not wait for each other.
+ *  A small multiple of the number of threads is a reasonable number of stripes. The callbacks may be called by several
+ *  threads at the same time.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPconchashtableCreate(
+   SCIP_CONCHASHTABLE**  hashtable,          /**< pointer to store the created concurrent hash table */
+   BMS_BLKMEM*           blkmem,             /**< block memory used to store the concurrent hash table */
+   int                   tablesize,          /**< size of the hash table */
+   int                   nstripes,           /**< number of stripes, i.e., independently locked parts of the table */
+   SCIP_DECL_HASHGETKEY((*hashgetkey)),      /**< gets the key of the given element */
+   SCIP_DECL_HASHKEYEQ ((*hashkeyeq)),       /**< returns TRUE iff both keys are equal */
+   SCIP_DECL_HASHKEYVAL((*hashkeyval)),      /**< returns the hash value of the key */
+   void*                 userptr             /**< user pointer */
+   );
+
+/** frees the concurrent hash table; must not be called while other threads access the table */
+SCIP_EXPORT
+void SCIPconchashtableFree(
+   SCIP_CONCHASHTABLE**  hashtable           /**< pointer to the concurrent hash table */
+   );
+
+/** inserts element in the concurrent hash table
+ *
+ *  @note multiple inserts of same element overrides previous one
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPconchashtableInsert(
+   SCIP_CONCHASHTABLE*   hashtable,          /**< concurrent hash table */
+   void*                 element             /**< element to insert into the table */
+   );
+
+/** inserts element in the concurrent hash table
+ *
+ *  @note multiple insertion of same element is checked and results in an error
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPconchashtableSafeInsert(
+   SCIP_CONCHASHTABLE*   hashtable,          /**< concurrent hash table */
+   void*                 element             /**< element to insert into the table */
+   );
+
+/** retrieves the element with the key of the given element, and inserts the given element if there is no such element
+ *
+ *  Both happens atomically, such that of several threads inserting elements with equal keys exactly one inserts its
+ *  element and all others get this element.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPconchashtableRetrieveOrInsert(
+   SCIP_CONCHASHTABLE*   hashtable,          /**< concurrent hash table */
+   void*                 element,            /**< element to insert into the table */
+   void**                stored              /**< pointer to store the element of the table with the key of the given
+                                              *   element, which is the given element if it was inserted */
+   );
+
+/** retrieve element with key from the concurrent hash table, returns NULL if not existing */
+SCIP_EXPORT
+void* SCIPconchashtableRetrieve(
+   SCIP_CONCHASHTABLE*   hashtable,          /**< concurrent hash table */
+   void*                 key                 /**< key to retrieve */
+   );
+
+/** returns whether the given element exists in the concurrent hash table */
+SCIP_EXPORT
+SCIP_Bool SCIPconchashtableExists(
+   SCIP_CONCHASHTABLE*   hashtable,          /**< concurrent hash table */
+   void*                 element             /**< element to search in the table */
+   );
+
+/** removes element from the concurrent hash table, if it exists */
+SCIP_EXPORT
+SCIP_RETCODE SCIPconchashtableRemove(
+   SCIP_CONCHASHTABLE*   hashtable,          /**< concurrent hash table */
+   void*                 element             /**< element to remove from the table */
+   );
+
+/** removes all elements of the concurrent hash table */
+SCIP_EXPORT
+SCIP_RETCODE SCIPconchashtableRemoveAll(
+   SCIP_CONCHASHTABLE*   hashtable           /**< concurrent hash table */
+   );
+
+/** returns number of elements of the concurrent hash table
+ *
+ *  @note while other threads modify the table, the result is only a snapshot of each stripe at a different time
+ */
+SCIP_EXPORT
+SCIP_Longint SCIPconchashtableGetNElements(
+   SCIP_CONCHASHTABLE*   hashtable           /**< concurrent hash table */
+   );
+
+/** returns the number of stripes of the concurrent hash table */
+SCIP_EXPORT
+int SCIPconchashtableGetNStripes(
+   SCIP_CONCHASHTABLE*   hashtable           /**< concurrent hash table */
+   );
+
+/** creates a concurrent hash map mapping pointers to pointers
+ *
+ *  The entries are distributed over the given number of stripes, rounded up to a power of two. Each stripe is a hash
+ *  map with its own lock and block memory, such that threads accessing different stripes do not wait for each other.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPconchashmapCreate(
+   SCIP_CONCHASHMAP**    hashmap,            /**< pointer to store the created concurrent hash map */
+   BMS_BLKMEM*           blkmem,             /**< block memory used to store the concurrent hash map */
+   int                   mapsize,            /**< size of the hash map */
+   int                   nstripes            /**< number of stripes, i.e., independently locked parts of the map */
+   );
+
+/** frees the concurrent hash map; must not be called while other threads access the map */
+SCIP_EXPORT
+void SCIPconchashmapFree(
+   SCIP_CONCHASHMAP**    hashmap             /**< pointer to the concurrent hash map */
+   );
+
+/** inserts new origin->image pair in the concurrent hash map
+ *
+ *  @note multiple insertion of same element is checked and results in an error
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPconchashmapInsert(
+   SCIP_CONCHASHMAP*     hashmap,            /**< concurrent hash map */
+   void*                 origin,             /**< origin to set image for */
+   void*                 image               /**< new image for origin */
+   );
+
+/** inserts new origin->image pair in the concurrent hash map
+ *
+ *  @note multiple insertion of same element is checked and results in an error
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPconchashmapInsertInt(
+   SCIP_CONCHASHMAP*     hashmap,            /**< concurrent hash map */
+   void*                 origin,             /**< origin to set image for */
+   int                   image               /**< new image for origin */
+   );
+
+/** inserts new origin->image pair in the concurrent hash map
+ *
+ *  @note multiple insertion of same element is checked and results in an error
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPconchashmapInsertReal(
+   SCIP_CONCHASHMAP*     hashmap,            /**< concurrent hash map */
+   void*                 origin,             /**< origin to set image for */
+   SCIP_Real             image               /**< new image for origin */
+   );
+
+/** retrieves image of given origin from the concurrent hash map, or NULL if no image exists */
+SCIP_EXPORT
+void* SCIPconchashmapGetImage(
+   SCIP_CONCHASHMAP*     hashmap,            /**< concurrent hash map */
+   void*                 origin              /**< origin to retrieve image for */
+   );
+
+/** retrieves image of given origin from the concurrent hash map, or INT_MAX if no image exists */
+SCIP_EXPORT
+int SCIPconchashmapGetImageInt(
+   SCIP_CONCHASHMAP*     hashmap,            /**< concurrent hash map */
+   void*                 origin              /**< origin to retrieve image for */
+   );
+
+/** retrieves image of given origin from the concurrent hash map, or SCIP_INVALID if no image exists */
+SCIP_EXPORT
+SCIP_Real SCIPconchashmapGetImageReal(
+   SCIP_CONCHASHMAP*     hashmap,            /**< concurrent hash map */
+   void*                 origin              /**< origin to retrieve image for */
+   );
+
+/** sets image for given origin in the concurrent hash map, either by modifying existing origin->image pair or by
+ *  appending a new origin->image pair
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPconchashmapSetImage(
+   SCIP_CONCHASHMAP*     hashmap,            /**< concurrent hash map */
+   void*                 origin,             /**< origin to set image for */
+   void*                 image               /**< new image for origin */
+   );
+
+/** sets image for given origin in the concurrent hash map, either by modifying existing origin->image pair or by
+ *  appending a new origin->image pair
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPconchashmapSetImageInt(
+   SCIP_CONCHASHMAP*     hashmap,            /**< concurrent hash map */
+   void*                 origin,             /**< origin to set image for */
+   int                   image               /**< new image for origin */
+   );
+
+/** sets image for given origin in the concurrent hash map, either by modifying existing origin->image pair or by
+ *  appending a new origin->image pair
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPconchashmapSetImageReal(
+   SCIP_CONCHASHMAP*     hashmap,            /**< concurrent hash map */
+   void*                 origin,             /**< origin to set image for */
+   SCIP_Real             image               /**< new image for origin */
+   );
+
+/** adds the given increment to the integer image of the given origin in the concurrent hash map, where a missing
+ *  origin has image 0, and returns the previous image
+ *
+ *  In contrast to a combination of SCIPconchashmapGetImageInt() and SCIPconchashmapSetImageInt(), no increments of
+ *  other threads are lost.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPconchashmapAddImageInt(
+   SCIP_CONCHASHMAP*     hashmap,            /**< concurrent hash map */
+   void*                 origin,             /**< origin to modify the image of */
+   int                   increment,          /**< increment of the image */
+   int*                  oldimage            /**< pointer to store the previous image, or NULL */
+   );
+
+/** checks whether an image to the given origin exists in the concurrent hash map */
+SCIP_EXPORT
+SCIP_Bool SCIPconchashmapExists(
+   SCIP_CONCHASHMAP*     hashmap,            /**< concurrent hash map */
+   void*                 origin              /**< origin to search for */
+   );
+
+/** removes origin->image pair from the concurrent hash map, if it exists */
+SCIP_EXPORT
+SCIP_RETCODE SCIPconchashmapRemove(
+   SCIP_CONCHASHMAP*     hashmap,            /**< concurrent hash map */
+   void*                 origin              /**< origin to remove from the list */
+   );
+
+/** removes all entries of the concurrent hash map */
+SCIP_EXPORT
+SCIP_RETCODE SCIPconchashmapRemoveAll(
+   SCIP_CONCHASHMAP*     hashmap             /**< concurrent hash map */
+   );
+
+/** returns the number of entries of the concurrent hash map
+ *
+ *  @note while other threads modify the map, the result is only a snapshot of each stripe at a different time
+ */
+SCIP_EXPORT
+int SCIPconchashmapGetNElements(
+   SCIP_CONCHASHMAP*     hashmap             /**< concurrent hash map */
+   );
+
+/**@} */
+
+
 /*
  * Hash Set
  */
@@ -213,6 +213,9 @@ void SCIPnodeGetNDomchg(
 
 /** gets the domain change information of the node, i.e., the information about the differences in the
  *  variables domains to the parent node
+ *
+ *  @note returns NULL for a leaf whose domain changes were swapped to disk (see parameter memory/swapfac) until the
+ *        leaf is focused
  */
 SCIP_EXPORT
 SCIP_DOMCHG* SCIPnodeGetDomchg(
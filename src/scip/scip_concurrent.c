@@ -47,6 +47,7 @@
 #include "scip/pub_message.h"
 #include "scip/scip_concurrent.h"
 #include "scip/set.h"
+#include "scip/stat.h"
 #include "scip/struct_mem.h"
 #include "scip/struct_scip.h"
 #include "scip/struct_set.h"
@@ -199,6 +200,39 @@ SCIP_RETCODE SCIPfreeSyncstore(
    return SCIP_OKAY;
 }
 
+/** makes sure that the task processing interface provides at least the given number of threads for parallel jobs
+ *
+ *  The threads are kept until the transformed problem is freed, such that all parallel steps of a solve reuse the same
+ *  threads. Jobs can be submitted with SCIPtpiSubmitJob() after this call.
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_TRANSFORMED
+ *       - \ref SCIP_STAGE_INITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVING
+ *       - \ref SCIP_STAGE_EXITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVED
+ *       - \ref SCIP_STAGE_INITSOLVE
+ *       - \ref SCIP_STAGE_SOLVING
+ *       - \ref SCIP_STAGE_SOLVED
+ *       - \ref SCIP_STAGE_EXITSOLVE
+ *
+ *  See \ref SCIP_Stage "SCIP_STAGE" for a complete list of all possible solving stages.
+ */
+SCIP_RETCODE SCIPinitTpi(
+   SCIP*                 scip,               /**< SCIP data structure */
+   int                   nthreads            /**< minimal number of threads */
+   )
+{
+   SCIP_CALL( SCIPcheckStage(scip, "SCIPinitTpi", FALSE, FALSE, FALSE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, FALSE) );
+
+   SCIP_CALL( SCIPstatInitTpi(scip->stat, nthreads) );
+
+   return SCIP_OKAY;
+}
+
 /** Gets the parallel interface to execute processes concurrently.
  *
  *  @return the \ref SCIP_SYNCSTORE parallel interface pointer to submit jobs for concurrent processing.
@@ -160,6 +160,33 @@ SCIP_RETCODE SCIPfreeSyncstore(
    SCIP*                 scip                /**< SCIP data structure */
    );
 
+/** makes sure that the task processing interface provides at least the given number of threads for parallel jobs
+ *
+ *  The threads are kept until the transformed problem is freed, such that all parallel steps of a solve reuse the same
+ *  threads. Jobs can be submitted with SCIPtpiSubmitJob() after this call.
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_TRANSFORMED
+ *       - \ref SCIP_STAGE_INITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVING
+ *       - \ref SCIP_STAGE_EXITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVED
+ *       - \ref SCIP_STAGE_INITSOLVE
+ *       - \ref SCIP_STAGE_SOLVING
+ *       - \ref SCIP_STAGE_SOLVED
+ *       - \ref SCIP_STAGE_EXITSOLVE
+ *
+ *  See \ref SCIP_Stage "SCIP_STAGE" for a complete list of all possible solving stages.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPinitTpi(
+   SCIP*                 scip,               /**< SCIP data structure */
+   int                   nthreads            /**< minimal number of threads */
+   );
+
 /** Gets the synchronization store.
  *
  *  @return the \ref SCIP_SYNCSTORE parallel interface pointer to submit jobs for concurrent processing.
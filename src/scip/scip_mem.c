@@ -93,6 +93,20 @@ BMS_BUFMEM* SCIPcleanbuffer(
    return scip->mem->cleanbuffer;
 }
 
+/** returns node memory for objects that live until the focus node changes
+ *
+ *  @return the node memory for objects that live until the focus node changes
+ */
+BMS_ARENAMEM* SCIPnodemem(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   assert(scip != NULL);
+   assert(scip->mem != NULL);
+
+   return scip->mem->nodemem;
+}
+
 /** returns the total number of bytes used in block and buffer memory
  *
  *  @return the total number of bytes used in block and buffer memory.
@@ -119,6 +133,40 @@ SCIP_Longint SCIPgetMemTotal(
    return SCIPmemGetTotal(scip->mem);
 }
 
+/** returns the number of bytes of block and buffer memory of the problem that are currently used by the given owner
+ *
+ *  The owner is the base name of the source file that allocates the memory, without extension, e.g., "cons_linear",
+ *  "implics", "cutpool", or "conflictstore". The memory is only recorded if the parameter memory/accounting is enabled.
+ *
+ *  @return the number of bytes used by the owner, or 0 if memory accounting is disabled.
+ */
+SCIP_Longint SCIPgetMemUsedOwner(
+   SCIP*                 scip,               /**< SCIP data structure */
+   const char*           owner               /**< owner, i.e., base name of the source file without extension */
+   )
+{
+   assert(scip != NULL);
+   assert(owner != NULL);
+
+   return SCIPmemGetUsedOwner(scip->mem, owner);
+}
+
+/** returns the maximal number of bytes of block and buffer memory of the problem used by the given owner since memory
+ *  accounting has been enabled
+ *
+ *  @return the maximal number of bytes used by the owner, or 0 if memory accounting is disabled.
+ */
+SCIP_Longint SCIPgetMemUsedMaxOwner(
+   SCIP*                 scip,               /**< SCIP data structure */
+   const char*           owner               /**< owner, i.e., base name of the source file without extension */
+   )
+{
+   assert(scip != NULL);
+   assert(owner != NULL);
+
+   return SCIPmemGetUsedMaxOwner(scip->mem, owner);
+}
+
 /** returns the estimated number of bytes used by external software, e.g., the LP solver
  *
  *  @return the estimated number of bytes used by external software, e.g., the LP solver.
@@ -199,4 +247,10 @@ void SCIPprintMemoryDiagnostic(
 
    SCIPmessagePrintInfo(scip->messagehdlr, "\nClean Memory Buffers:\n");
    BMSprintBufferMemory(SCIPcleanbuffer(scip));
+
+   SCIPmessagePrintInfo(scip->messagehdlr, "\nNode Memory: %" SCIP_LONGINT_FORMAT " bytes\n",
+      (SCIP_Longint) BMSgetArenaMemoryUsed(SCIPnodemem(scip)));
+
+   SCIPmessagePrintInfo(scip->messagehdlr, "\nChunk Pool: %" SCIP_LONGINT_FORMAT " bytes of unused chunks\n",
+      (SCIP_Longint) BMSgetChunkPoolSize());
 }
@@ -147,6 +147,21 @@ extern "C" {
 #define SCIPfreeCleanBufferArrayNull(scip,ptr)  BMSfreeBufferMemoryArrayNull(SCIPcleanbuffer(scip), (ptr))
 
 
+/* Node Memory Management Macros
+ *
+ * Objects in node memory cannot be freed individually; they are all freed at once when the focus node changes.
+ */
+
+#define SCIPallocNodeMemory(scip,ptr)           ( (BMSallocArenaMemory(SCIPnodemem(scip), (ptr)) == NULL) \
+                                                  ? SCIP_NOMEMORY : SCIP_OKAY )
+#define SCIPallocNodeMemoryArray(scip,ptr,num)  ( (BMSallocArenaMemoryArray(SCIPnodemem(scip), (ptr), (num)) == NULL) \
+                                                  ? SCIP_NOMEMORY : SCIP_OKAY )
+#define SCIPallocClearNodeMemoryArray(scip,ptr,num) ( (BMSallocClearArenaMemoryArray(SCIPnodemem(scip), (ptr), (num)) == NULL) \
+                                                  ? SCIP_NOMEMORY : SCIP_OKAY )
+#define SCIPduplicateNodeMemoryArray(scip,ptr,source,num) ( (BMSduplicateArenaMemoryArray(SCIPnodemem(scip), (ptr), (source), (num)) == NULL) \
+                                                  ? SCIP_NOMEMORY : SCIP_OKAY )
+
+
 /* Memory Management Functions
  *
  *
@@ -179,6 +194,15 @@ BMS_BUFMEM* SCIPcleanbuffer(
    SCIP*                 scip                /**< SCIP data structure */
    );
 
+/** returns node memory for objects that live until the focus node changes
+ *
+ *  @return the node memory for objects that live until the focus node changes
+ */
+SCIP_EXPORT
+BMS_ARENAMEM* SCIPnodemem(
+   SCIP*                 scip                /**< SCIP data structure */
+   );
+
 /** returns the total number of bytes used in block and buffer memory
  *
  *  @return the total number of bytes used in block and buffer memory.
@@ -197,6 +221,30 @@ SCIP_Longint SCIPgetMemTotal(
    SCIP*                 scip                /**< SCIP data structure */
    );
 
+/** returns the number of bytes of block and buffer memory of the problem that are currently used by the given owner
+ *
+ *  The owner is the base name of the source file that allocates the memory, without extension, e.g., "cons_linear",
+ *  "implics", "cutpool", or "conflictstore". The memory is only recorded if the parameter memory/accounting is enabled.
+ *
+ *  @return the number of bytes used by the owner, or 0 if memory accounting is disabled.
+ */
+SCIP_EXPORT
+SCIP_Longint SCIPgetMemUsedOwner(
+   SCIP*                 scip,               /**< SCIP data structure */
+   const char*           owner               /**< owner, i.e., base name of the source file without extension */
+   );
+
+/** returns the maximal number of bytes of block and buffer memory of the problem used by the given owner since memory
+ *  accounting has been enabled
+ *
+ *  @return the maximal number of bytes used by the owner, or 0 if memory accounting is disabled.
+ */
+SCIP_EXPORT
+SCIP_Longint SCIPgetMemUsedMaxOwner(
+   SCIP*                 scip,               /**< SCIP data structure */
+   const char*           owner               /**< owner, i.e., base name of the source file without extension */
+   );
+
 /** returns the estimated number of bytes used by external software, e.g., the LP solver
  *
  *  @return the estimated number of bytes used by external software, e.g., the LP solver.
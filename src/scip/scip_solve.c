@@ -2104,6 +2104,9 @@ SCIP_RETCODE freeTransform(
    SCIP_CALL( SCIPeventfilterFree(&scip->eventfilter, scip->mem->probmem, scip->set) );
    SCIP_CALL( SCIPeventqueueFree(&scip->eventqueue) );
 
+   /* release the threads used by the parallel steps of the solve */
+   SCIP_CALL( SCIPstatExitTpi(scip->stat) );
+
    if( scip->set->misc_resetstat && !reducedfree )
    {
       /* reset statistics to the point before the problem was transformed */
@@ -2157,6 +2160,9 @@ SCIP_RETCODE freeTransforming(
    SCIP_CALL( SCIPeventfilterFree(&scip->eventfilter, scip->mem->probmem, scip->set) );
    SCIP_CALL( SCIPeventqueueFree(&scip->eventqueue) );
 
+   /* release the threads used by the parallel steps of the solve */
+   SCIP_CALL( SCIPstatExitTpi(scip->stat) );
+
    if( scip->set->misc_resetstat )
    {
       /* reset statistics to the point before the problem was transformed */
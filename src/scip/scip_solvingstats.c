@@ -53,6 +53,7 @@
 #include "scip/disp.h"
 #include "scip/history.h"
 #include "scip/implics.h"
+#include "scip/mem.h"
 #include "scip/pricestore.h"
 #include "scip/primal.h"
 #include "scip/prob.h"
@@ -3781,14 +3782,15 @@ void SCIPprintConcsolverStatistics(
 
    if( nconcsolvers > 0 )
    {
-      SCIPmessageFPrintInfo(scip->messagehdlr, file, "Concurrent Solvers : SolvingTime    SyncTime       Nodes    LP Iters SolsShared   SolsRecvd TighterBnds TighterIntBnds\n");
+      SCIPmessageFPrintInfo(scip->messagehdlr, file, "Concurrent Solvers : SolvingTime    SyncTime    WaitTime       Nodes    LP Iters SolsShared   SolsRecvd TighterBnds TighterIntBnds\n");
       for( i = 0; i < nconcsolvers; ++i )
       {
-         SCIPmessageFPrintInfo(scip->messagehdlr, file, "  %c%-16s: %11.2f %11.2f %11" SCIP_LONGINT_FORMAT " %11" SCIP_LONGINT_FORMAT "%11" SCIP_LONGINT_FORMAT " %11" SCIP_LONGINT_FORMAT " %11" SCIP_LONGINT_FORMAT " %14" SCIP_LONGINT_FORMAT "\n",
+         SCIPmessageFPrintInfo(scip->messagehdlr, file, "  %c%-16s: %11.2f %11.2f %11.2f %11" SCIP_LONGINT_FORMAT " %11" SCIP_LONGINT_FORMAT "%11" SCIP_LONGINT_FORMAT " %11" SCIP_LONGINT_FORMAT " %11" SCIP_LONGINT_FORMAT " %14" SCIP_LONGINT_FORMAT "\n",
             winner == i ? '*' : ' ',
             SCIPconcsolverGetName(concsolvers[i]),
             SCIPconcsolverGetSolvingTime(concsolvers[i]),
             SCIPconcsolverGetSyncTime(concsolvers[i]),
+            SCIPconcsolverGetSyncWaitTime(concsolvers[i]),
             SCIPconcsolverGetNNodes(concsolvers[i]),
             SCIPconcsolverGetNLPIterations(concsolvers[i]),
             SCIPconcsolverGetNSolsShared(concsolvers[i]),
@@ -4124,6 +4126,100 @@ SCIP_DECL_SORTPTRCOMP(tablePosComp)
    return (SCIPtableGetPosition((SCIP_TABLE*)elem1) - (SCIPtableGetPosition((SCIP_TABLE*)elem2)));
 }
 
+/** outputs memory statistics per owner, i.e., source file that allocated block or buffer memory of the problem, if
+ *  memory accounting is enabled
+ *
+ *  @pre This method can be called if SCIP is in one of the following stages:
+ *       - \ref SCIP_STAGE_PROBLEM
+ *       - \ref SCIP_STAGE_TRANSFORMED
+ *       - \ref SCIP_STAGE_INITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVING
+ *       - \ref SCIP_STAGE_EXITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVED
+ *       - \ref SCIP_STAGE_SOLVING
+ *       - \ref SCIP_STAGE_SOLVED
+ */
+void SCIPprintMemoryStatistics(
+   SCIP*                 scip,               /**< SCIP data structure */
+   FILE*                 file                /**< output file */
+   )
+{
+   const char** owners;
+   SCIP_Longint* used;
+   SCIP_Longint* maxused;
+   int* ownerlens;
+   int* idx;
+   int nowners;
+   int nfiles;
+   int i;
+
+   assert(scip != NULL);
+   assert(scip->mem != NULL);
+
+   SCIP_CALL_ABORT( SCIPcheckStage(scip, "SCIPprintMemoryStatistics", FALSE, TRUE, FALSE, TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, TRUE, TRUE, FALSE, FALSE, FALSE) );
+
+   if( !scip->mem->accounting )
+      return;
+
+   /* the buffers allocated here are recorded by the account as well, so only consider the files recorded so far */
+   nfiles = BMSgetMemoryAccountNFiles(scip->mem->account);
+   if( nfiles == 0 )
+      return;
+
+   SCIP_CALL_ABORT( SCIPallocBufferArray(scip, &owners, nfiles) );
+   SCIP_CALL_ABORT( SCIPallocBufferArray(scip, &ownerlens, nfiles) );
+   SCIP_CALL_ABORT( SCIPallocBufferArray(scip, &used, nfiles) );
+   SCIP_CALL_ABORT( SCIPallocBufferArray(scip, &maxused, nfiles) );
+   SCIP_CALL_ABORT( SCIPallocBufferArray(scip, &idx, nfiles) );
+
+   /* merge the source files of the same owner, e.g., a source file and inline functions of its header */
+   nowners = 0;
+   for( i = 0; i < nfiles; ++i )
+   {
+      const char* owner;
+      int len;
+      int j;
+
+      owner = SCIPmemGetFileOwner(BMSgetMemoryAccountFile(scip->mem->account, i), &len);
+
+      for( j = 0; j < nowners; ++j )
+      {
+         if( ownerlens[j] == len && strncmp(owners[j], owner, (size_t)len) == 0 )
+            break;
+      }
+
+      if( j == nowners )
+      {
+         owners[j] = owner;
+         ownerlens[j] = len;
+         used[j] = 0;
+         maxused[j] = 0;
+         idx[j] = j;
+         ++nowners;
+      }
+
+      used[j] += BMSgetMemoryAccountUsed(scip->mem->account, i);
+      maxused[j] += BMSgetMemoryAccountUsedMax(scip->mem->account, i);
+   }
+
+   /* print owners with largest peak first */
+   SCIPsortDownLongPtrInt(maxused, (void**)owners, idx, nowners);
+
+   SCIPmessageFPrintInfo(scip->messagehdlr, file, "Memory (kB)        :    Current       Peak\n");
+
+   for( i = 0; i < nowners && maxused[i] > 0; ++i )
+   {
+      SCIPmessageFPrintInfo(scip->messagehdlr, file, "  %-17.*s: %10.1f %10.1f\n", MIN(ownerlens[idx[i]], 17), owners[i],
+         used[idx[i]] / 1024.0, maxused[i] / 1024.0);
+   }
+
+   SCIPfreeBufferArray(scip, &idx);
+   SCIPfreeBufferArray(scip, &maxused);
+   SCIPfreeBufferArray(scip, &used);
+   SCIPfreeBufferArray(scip, &ownerlens);
+   SCIPfreeBufferArray(scip, &owners);
+}
+
 /** outputs solving statistics
  *
  *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
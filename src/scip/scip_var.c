@@ -4068,6 +4068,37 @@ SCIP_RETCODE SCIPsetVarStrongbranchData(
    return SCIP_OKAY;
 }
 
+/** invalidates the strong branching information of a column variable, such that it is not reused
+ *
+ *  This is useful if strong branching values have been computed ahead of time, e.g., for candidates that are evaluated
+ *  in parallel, but are not used.
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_SOLVING
+ *
+ *  @note strong branching needs to be started with SCIPstartStrongbranch()
+ */
+SCIP_RETCODE SCIPinvalidateVarStrongbranchData(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_VAR*             var                 /**< variable to invalidate the strong branching values for */
+   )
+{
+   SCIP_CALL( SCIPcheckStage(scip, "SCIPinvalidateVarStrongbranchData", FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, TRUE, FALSE, FALSE, FALSE, FALSE) );
+
+   if( SCIPvarGetStatus(var) != SCIP_VARSTATUS_COLUMN )
+   {
+      SCIPerrorMessage("cannot invalidate strong branching information on non-COLUMN variable\n");
+      return SCIP_INVALIDDATA;
+   }
+
+   SCIPcolInvalidateStrongbranchData(SCIPvarGetCol(var), scip->set, scip->stat, scip->lp);
+
+   return SCIP_OKAY;
+}
+
 /** rounds the current solution and tries it afterwards; if feasible, adds it to storage
  *
  *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
@@ -44,6 +44,7 @@
 #include "scip/clock.h"
 #include "scip/event.h"
 #include "scip/lp.h"
+#include "scip/mem.h"
 #include "scip/paramset.h"
 #include "scip/scip.h"
 #include "scip/bandit.h"
@@ -94,6 +95,7 @@
 #define SCIP_DEFAULT_BRANCH_CHECKSBSOL     TRUE /**< should LP solutions during strong branching with propagation be checked for feasibility? */
 #define SCIP_DEFAULT_BRANCH_ROUNDSBSOL     TRUE /**< should LP solutions during strong branching with propagation be rounded? (only when checksbsol=TRUE) */
 #define SCIP_DEFAULT_BRANCH_SUMADJUSTSCORE FALSE /**< score adjustment near zero by adding epsilon (TRUE) or using maximum (FALSE) */
+#define SCIP_DEFAULT_BRANCH_SBNTHREADS        1 /**< number of threads used to evaluate strong branching candidates */
 
 /* Tree Compression */
 
@@ -275,10 +277,12 @@
 /* Memory */
 
 #define SCIP_DEFAULT_MEM_SAVEFAC            0.8 /**< fraction of maximal mem usage when switching to memory saving mode */
+#define SCIP_DEFAULT_MEM_SWAPFAC            1.0 /**< fraction of maximal mem usage when swapping open nodes to disk */
 #define SCIP_DEFAULT_MEM_TREEGROWFAC        2.0 /**< memory growing factor for tree array */
 #define SCIP_DEFAULT_MEM_PATHGROWFAC        2.0 /**< memory growing factor for path array */
 #define SCIP_DEFAULT_MEM_TREEGROWINIT     65536 /**< initial size of tree array */
 #define SCIP_DEFAULT_MEM_PATHGROWINIT       256 /**< initial size of path array */
+#define SCIP_DEFAULT_MEM_ACCOUNTING       FALSE /**< should the used memory be recorded per source file? */
 
 
 /* Miscellaneous */
@@ -470,8 +474,11 @@
 /* Concurrent solvers */
 #define SCIP_DEFAULT_CONCURRENT_CHANGESEEDS     TRUE /**< should the concurrent solvers use different random seeds? */
 #define SCIP_DEFAULT_CONCURRENT_CHANGECHILDSEL  TRUE /**< should the concurrent solvers use different child selection rules? */
+#define SCIP_DEFAULT_CONCURRENT_CHANGELPALGO   FALSE /**< should the concurrent solvers use different algorithms for the initial LP? */
 #define SCIP_DEFAULT_CONCURRENT_COMMVARBNDS     TRUE /**< should the concurrent solvers communicate variable bounds? */
 #define SCIP_DEFAULT_CONCURRENT_PRESOLVEBEFORE  TRUE /**< should the problem be presolved before it is copied to the concurrent solvers? */
+#define SCIP_DEFAULT_CONCURRENT_PRESOLVECOPIES  TRUE /**< should the concurrent solvers presolve the centrally presolved problem again? */
+#define SCIP_DEFAULT_CONCURRENT_TREESPLIT      FALSE /**< should the search tree be split among the concurrent solvers? */
 #define SCIP_DEFAULT_CONCURRENT_INITSEED     5131912 /**< the seed used to initialize the random seeds for the concurrent solvers */
 #define SCIP_DEFAULT_CONCURRENT_FREQINIT        10.0 /**< initial frequency of synchronization with other threads
                                                       *   (fraction of time required for solving the root LP) */
@@ -697,6 +704,18 @@ SCIP_DECL_PARAMCHGD(paramChgdArraygrowinit)
    return SCIP_OKAY;
 }
 
+/** information method for a parameter change of mem_accounting */
+static
+SCIP_DECL_PARAMCHGD(paramChgdAccounting)
+{  /*lint --e{715}*/
+   assert(scip != NULL);
+
+   /* attach or detach the memory account */
+   SCIPmemSetAccounting(scip->mem, SCIPparamGetBool(param));
+
+   return SCIP_OKAY;
+}
+
 /** information method for a parameter change of reopt_enable */
 static
 SCIP_DECL_PARAMCHGD(paramChgdEnableReopt)
@@ -1116,6 +1135,7 @@ SCIP_RETCODE SCIPsetCreate(
    (*set)->scip = scip;
    (*set)->buffer = SCIPbuffer(scip);
    (*set)->cleanbuffer = SCIPcleanbuffer(scip);
+   (*set)->nodemem = SCIPnodemem(scip);
 
    SCIP_CALL( SCIPparamsetCreate(&(*set)->paramset, blkmem) );
 
@@ -1317,6 +1337,11 @@ SCIP_RETCODE SCIPsetCreate(
          "score adjustment near zero by adding epsilon (TRUE) or using maximum (FALSE)",
          &(*set)->branch_sumadjustscore, TRUE, SCIP_DEFAULT_BRANCH_SUMADJUSTSCORE,
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddIntParam(*set, messagehdlr, blkmem,
+         "branching/sbnthreads",
+         "number of threads used to evaluate strong branching candidates on copies of the LP, at most parallel/maxnthreads (1: sequential)",
+         &(*set)->branch_sbnthreads, TRUE, SCIP_DEFAULT_BRANCH_SBNTHREADS, 1, 64,
+         NULL, NULL) );
 
    /* tree compression parameters */
    SCIP_CALL( SCIPsetAddBoolParam(*set, messagehdlr, blkmem,
@@ -1902,6 +1927,11 @@ SCIP_RETCODE SCIPsetCreate(
          "fraction of maximal memory usage resulting in switch to memory saving mode",
          &(*set)->mem_savefac, FALSE, SCIP_DEFAULT_MEM_SAVEFAC, 0.0, 1.0,
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddRealParam(*set, messagehdlr, blkmem,
+         "memory/swapfac",
+         "fraction of maximal memory usage at which the domain changes of open nodes are written to a swap file and their LP states are released (1.0: never)",
+         &(*set)->mem_swapfac, FALSE, SCIP_DEFAULT_MEM_SWAPFAC, 0.0, 1.0,
+         NULL, NULL) );
    SCIP_CALL( SCIPsetAddRealParam(*set, messagehdlr, blkmem,
          "memory/arraygrowfac",
          "memory growing factor for dynamically allocated arrays",
@@ -1932,6 +1962,11 @@ SCIP_RETCODE SCIPsetCreate(
          "initial size of path array",
          &(*set)->mem_pathgrowinit, TRUE, SCIP_DEFAULT_MEM_PATHGROWINIT, 0, INT_MAX,
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddBoolParam(*set, messagehdlr, blkmem,
+         "memory/accounting",
+         "should the used block and buffer memory be recorded per source file for the memory statistics?",
+         &(*set)->mem_accounting, TRUE, SCIP_DEFAULT_MEM_ACCOUNTING,
+         paramChgdAccounting, NULL) );
 
    /* miscellaneous parameters */
    SCIP_CALL( SCIPsetAddBoolParam(*set, messagehdlr, blkmem,
@@ -2576,6 +2611,11 @@ SCIP_RETCODE SCIPsetCreate(
          "use different child selection rules in each concurrent solver?",
          &(*set)->concurrent_changechildsel, FALSE, SCIP_DEFAULT_CONCURRENT_CHANGECHILDSEL,
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddBoolParam(*set, messagehdlr, blkmem,
+         "concurrent/changelpalgo",
+         "should the concurrent solvers use the dual simplex, primal simplex, and barrier in turn for the initial LP?",
+         &(*set)->concurrent_changelpalgo, FALSE, SCIP_DEFAULT_CONCURRENT_CHANGELPALGO,
+         NULL, NULL) );
    SCIP_CALL( SCIPsetAddBoolParam(*set, messagehdlr, blkmem,
          "concurrent/commvarbnds",
          "should the concurrent solvers communicate global variable bound changes?",
@@ -2586,6 +2626,17 @@ SCIP_RETCODE SCIPsetCreate(
          "should the problem be presolved before it is copied to the concurrent solvers?",
          &(*set)->concurrent_presolvebefore, FALSE, SCIP_DEFAULT_CONCURRENT_PRESOLVEBEFORE,
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddBoolParam(*set, messagehdlr, blkmem,
+         "concurrent/presolvecopies",
+         "should the concurrent solvers presolve their copy again if the problem was presolved before it was copied?",
+         &(*set)->concurrent_presolvecopies, FALSE, SCIP_DEFAULT_CONCURRENT_PRESOLVECOPIES,
+         NULL, NULL) );
+   SCIP_CALL( SCIPsetAddBoolParam(*set, messagehdlr, blkmem,
+         "concurrent/treesplit",
+         "should the search tree be split among the concurrent solvers, such that each solver searches its own part, "
+         "instead of letting every solver work on the whole tree?",
+         &(*set)->concurrent_treesplit, FALSE, SCIP_DEFAULT_CONCURRENT_TREESPLIT,
+         NULL, NULL) );
    SCIP_CALL( SCIPsetAddIntParam(*set, messagehdlr, blkmem,
          "concurrent/initseed",
          "maximum number of solutions that will be shared in a one synchronization",
@@ -1761,6 +1761,10 @@ SCIP_Bool SCIPsetGetSubscipsOff(
 #define SCIPsetFreeCleanBufferSize(set,ptr)          BMSfreeBufferMemorySize((set)->cleanbuffer, (ptr))
 #define SCIPsetFreeCleanBufferArray(set,ptr)         BMSfreeBufferMemoryArray((set)->cleanbuffer, (ptr))
 
+#define SCIPsetAllocNodeMemory(set,ptr)              ( (BMSallocArenaMemory((set)->nodemem, (ptr)) == NULL) ? SCIP_NOMEMORY : SCIP_OKAY )
+#define SCIPsetAllocNodeMemoryArray(set,ptr,num)     ( (BMSallocArenaMemoryArray((set)->nodemem, (ptr), (num)) == NULL) ? SCIP_NOMEMORY : SCIP_OKAY )
+#define SCIPsetClearNodeMemory(set)                  BMSclearArenaMemory((set)->nodemem)
+
 /* if we have a C99 compiler */
 #ifdef SCIP_HAVE_VARIADIC_MACROS
 
@@ -34,6 +34,7 @@
 /*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
 #include <assert.h>
 
+#include "blockmemshell/memory.h"
 #include "lpi/lpi.h"
 #include "scip/branch.h"
 #include "scip/clock.h"
@@ -46,6 +47,7 @@
 #include "scip/heur.h"
 #include "scip/interrupt.h"
 #include "scip/lp.h"
+#include "scip/mem.h"
 #include "scip/nodesel.h"
 #include "scip/pricer.h"
 #include "scip/pricestore.h"
@@ -182,7 +184,11 @@ SCIP_Bool SCIPsolveIsStopped(
       else
          --stat->nclockskipsleft;
    }
-   if( SCIPgetConcurrentMemTotal(set->scip) >= set->limit_memory*1048576.0 - stat->externmemestim * (1.0 + SCIPgetNConcurrentSolvers(set->scip)) )
+   /* unused chunks kept in the chunk pool of the block memories are not returned to the operating system and count
+    * towards the limit, too
+    */
+   if( SCIPgetConcurrentMemTotal(set->scip) + BMSgetChunkPoolSize() >= set->limit_memory*1048576.0
+      - stat->externmemestim * (1.0 + SCIPgetNConcurrentSolvers(set->scip)) )
       stat->status = SCIP_STATUS_MEMLIMIT;
    else if( SCIPgetNLimSolsFound(set->scip) > 0
       && (SCIPsetIsLT(set, SCIPgetGap(set->scip), set->limit_gap)
@@ -5015,6 +5021,13 @@ SCIP_RETCODE SCIPsolveCIP(
          /* update the memory saving flag, switch algorithms respectively */
          SCIPstatUpdateMemsaveMode(stat, set, messagehdlr, mem);
 
+         /* write the domain changes of open nodes to disk if the memory gets short */
+         if( SCIPsetIsLT(set, set->mem_swapfac, 1.0)
+            && SCIPmemGetTotal(mem) >= set->mem_swapfac * set->limit_memory * 1024.0 * 1024.0 )
+         {
+            SCIP_CALL( SCIPtreeSwapLeaves(tree, blkmem, set, messagehdlr, stat, lp) );
+         }
+
          /* get the current node selector */
          nodesel = SCIPsetGetNodesel(set, stat);
 
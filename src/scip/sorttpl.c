@@ -44,11 +44,15 @@
  * #define SORTTPL_PTRCOMP                 ptrcomp method should be used for comparisons (optional)
  * #define SORTTPL_INDCOMP                 indcomp method should be used for comparisons (optional)
  * #define SORTTPL_BACKWARDS               should the array be sorted other way around
+ * #define SORTTPL_RADIXKEY(x)  <expr>     order preserving map of key x to an uint64_t of which only the lowest sizeof(key)
+ *                                         bytes differ; enables radix sort on large arrays (optional)
  */
 #include "scip/def.h"
 #include "scip/dbldblarith.h"
+#include "blockmemshell/memory.h"
 #define SORTTPL_SHELLSORTMAX    25 /* maximal size for shell sort */
 #define SORTTPL_MINSIZENINTHER 729 /* minimum input size to use ninther (median of nine) for pivot selection */
+#define SORTTPL_RADIXMIN      128 /* minimum input size to use radix sort if the key type supports it */
 
 #ifndef SORTTPL_NAMEEXT
 #error You need to define SORTTPL_NAMEEXT.
@@ -121,6 +125,9 @@
 #define SORTTPL_HASINDCOMP(x)    /**/
 #define SORTTPL_HASINDCOMPPAR(x) /**/
 #endif
+#if defined(SORTTPL_RADIXKEY) && (defined(SORTTPL_PTRCOMP) || defined(SORTTPL_INDCOMP))
+#error Radix sort cannot be used with a comparator.
+#endif
 
 
 /* the two-step macro definition is needed, such that macro arguments
@@ -553,6 +560,125 @@ void SORTTPL_NAME(sorttpl_qSort, SORTTPL_NAMEEXT)
    }
 }
 
+#ifdef SORTTPL_RADIXKEY
+/** moves the entries of an array to the positions given by a permutation: array[i] = old array[perm[i]] */
+#define SORTTPL_PERMUTE(T, array, perm, buffer, len) \
+   {                                                                    \
+      T* tmparray = (T*) (buffer);                                      \
+      int idx;                                                          \
+      assert(sizeof(T) <= sizeof(uint64_t));                            \
+      for( idx = 0; idx < (len); ++idx )                                \
+         tmparray[idx] = (array)[(perm)[idx]];                          \
+      BMScopyMemoryArray((array), tmparray, (len));                     \
+   }
+
+/** stable LSD radix sort on the bytes of the mapped keys; the permutation found is applied to the key and all fields
+ *  at the end, such that every element is moved only once
+ *
+ *  Returns FALSE if there is not enough memory for the auxiliary arrays, in which case the arrays are not changed.
+ */
+static
+SCIP_Bool SORTTPL_NAME(sorttpl_radixSort, SORTTPL_NAMEEXT)
+(
+   SORTTPL_KEYTYPE*      key,                /**< pointer to data array that defines the order */
+   SORTTPL_HASFIELD1PAR(  SORTTPL_FIELD1TYPE*    field1 )      /**< additional field that should be sorted in the same way */
+   SORTTPL_HASFIELD2PAR(  SORTTPL_FIELD2TYPE*    field2 )      /**< additional field that should be sorted in the same way */
+   SORTTPL_HASFIELD3PAR(  SORTTPL_FIELD3TYPE*    field3 )      /**< additional field that should be sorted in the same way */
+   SORTTPL_HASFIELD4PAR(  SORTTPL_FIELD4TYPE*    field4 )      /**< additional field that should be sorted in the same way */
+   SORTTPL_HASFIELD5PAR(  SORTTPL_FIELD5TYPE*    field5 )      /**< additional field that should be sorted in the same way */
+   SORTTPL_HASFIELD6PAR(  SORTTPL_FIELD6TYPE*    field6 )      /**< additional field that should be sorted in the same way */
+   int                   len                 /**< length of arrays */
+   )
+{
+   int counts[sizeof(SORTTPL_KEYTYPE)][256];
+   uint64_t* codes;
+   uint64_t* tmpcodes;
+   int* perm;
+   int* tmpperm;
+   int b;
+   int i;
+
+   assert(len > 0);
+
+   BMSallocMemoryArray(&codes, len);
+   BMSallocMemoryArray(&tmpcodes, len);
+   BMSallocMemoryArray(&perm, len);
+   BMSallocMemoryArray(&tmpperm, len);
+
+   if( codes == NULL || tmpcodes == NULL || perm == NULL || tmpperm == NULL )
+   {
+      BMSfreeMemoryArrayNull(&tmpperm);
+      BMSfreeMemoryArrayNull(&perm);
+      BMSfreeMemoryArrayNull(&tmpcodes);
+      BMSfreeMemoryArrayNull(&codes);
+      return FALSE;
+   }
+
+   /* compute the mapped keys and the histograms of all bytes in one pass */
+   BMSclearMemoryArray(&counts[0][0], sizeof(SORTTPL_KEYTYPE) * 256);
+   for( i = 0; i < len; ++i )
+   {
+#ifdef SORTTPL_BACKWARDS
+      codes[i] = ~(SORTTPL_RADIXKEY(key[i]));
+#else
+      codes[i] = SORTTPL_RADIXKEY(key[i]);
+#endif
+      perm[i] = i;
+
+      for( b = 0; b < (int)sizeof(SORTTPL_KEYTYPE); ++b )
+         ++counts[b][(codes[i] >> (8 * b)) & 0xff];
+   }
+
+   /* distribute the elements by each byte, starting with the least significant one */
+   for( b = 0; b < (int)sizeof(SORTTPL_KEYTYPE); ++b )
+   {
+      int* count = counts[b];
+      int shift = 8 * b;
+      int sum;
+      int d;
+
+      /* skip bytes that are equal for all keys, e.g., the high bytes of small integers */
+      if( count[(codes[0] >> shift) & 0xff] == len )
+         continue;
+
+      /* compute the first position of each byte value */
+      sum = 0;
+      for( d = 0; d < 256; ++d )
+      {
+         int c = count[d];
+         count[d] = sum;
+         sum += c;
+      }
+
+      for( i = 0; i < len; ++i )
+      {
+         int pos = count[(codes[i] >> shift) & 0xff]++;
+         tmpcodes[pos] = codes[i];
+         tmpperm[pos] = perm[i];
+      }
+
+      SORTTPL_SWAP(uint64_t*, codes, tmpcodes);
+      SORTTPL_SWAP(int*, perm, tmpperm);
+   }
+
+   /* apply the permutation, using the unused array of mapped keys as buffer */
+   SORTTPL_PERMUTE(SORTTPL_KEYTYPE, key, perm, tmpcodes, len);
+   SORTTPL_HASFIELD1( SORTTPL_PERMUTE(SORTTPL_FIELD1TYPE, field1, perm, tmpcodes, len); )
+   SORTTPL_HASFIELD2( SORTTPL_PERMUTE(SORTTPL_FIELD2TYPE, field2, perm, tmpcodes, len); )
+   SORTTPL_HASFIELD3( SORTTPL_PERMUTE(SORTTPL_FIELD3TYPE, field3, perm, tmpcodes, len); )
+   SORTTPL_HASFIELD4( SORTTPL_PERMUTE(SORTTPL_FIELD4TYPE, field4, perm, tmpcodes, len); )
+   SORTTPL_HASFIELD5( SORTTPL_PERMUTE(SORTTPL_FIELD5TYPE, field5, perm, tmpcodes, len); )
+   SORTTPL_HASFIELD6( SORTTPL_PERMUTE(SORTTPL_FIELD6TYPE, field6, perm, tmpcodes, len); )
+
+   BMSfreeMemoryArray(&tmpperm);
+   BMSfreeMemoryArray(&perm);
+   BMSfreeMemoryArray(&tmpcodes);
+   BMSfreeMemoryArray(&codes);
+
+   return TRUE;
+}
+#endif
+
 #ifndef NDEBUG
 /** verifies that an array is indeed sorted */
 static
@@ -610,6 +736,21 @@ void SORTTPL_NAME(SCIPsort, SORTTPL_NAMEEXT)
             SORTTPL_HASINDCOMPPAR(dataptr)
             0, len-1);
    }
+#ifdef SORTTPL_RADIXKEY
+   /* use radix sort on large arrays, which falls back to quick sort if there is not enough memory */
+   else if( len >= SORTTPL_RADIXMIN && SORTTPL_NAME(sorttpl_radixSort, SORTTPL_NAMEEXT)
+         (key,
+            SORTTPL_HASFIELD1PAR(field1)
+            SORTTPL_HASFIELD2PAR(field2)
+            SORTTPL_HASFIELD3PAR(field3)
+            SORTTPL_HASFIELD4PAR(field4)
+            SORTTPL_HASFIELD5PAR(field5)
+            SORTTPL_HASFIELD6PAR(field6)
+            len) )
+   {
+      /* nothing to do */
+   }
+#endif
    else
    {
       SORTTPL_NAME(sorttpl_qSort, SORTTPL_NAMEEXT)
@@ -1155,4 +1296,7 @@ void SORTTPL_NAME(SCIPselect, SORTTPL_NAMEEXT)
 #undef SORTTPL_SWAP
 #undef SORTTPL_SHELLSORTMAX
 #undef SORTTPL_MINSIZENINTHER
+#undef SORTTPL_RADIXMIN
+#undef SORTTPL_RADIXKEY
+#undef SORTTPL_PERMUTE
 #undef SORTTPL_BACKWARDS
@@ -48,6 +48,7 @@
 #include "scip/struct_stat.h"
 #include "scip/var.h"
 #include "scip/visual.h"
+#include "tpi/tpi.h"
 
 
 
@@ -104,6 +105,7 @@ SCIP_RETCODE SCIPstatCreate(
    (*stat)->subscipdepth = 0;
    (*stat)->detertimecnt = 0.0;
    (*stat)->nreoptruns = 0;
+   (*stat)->tpiinitialized = FALSE;
 
    SCIPstatReset(*stat, set, transprob, origprob);
 
@@ -119,6 +121,8 @@ SCIP_RETCODE SCIPstatFree(
    assert(stat != NULL);
    assert(*stat != NULL);
 
+   SCIP_CALL( SCIPstatExitTpi(*stat) );
+
    SCIPclockFree(&(*stat)->solvingtime);
    SCIPclockFree(&(*stat)->solvingtimeoverall);
    SCIPclockFree(&(*stat)->presolvingtime);
@@ -152,6 +156,50 @@ SCIP_RETCODE SCIPstatFree(
    return SCIP_OKAY;
 }
 
+/** makes sure that the task processing interface provides at least the given number of threads
+ *
+ *  The reference to the task processing interface is kept until SCIPstatExitTpi() is called when the transformed
+ *  problem is freed, such that all parallel steps of a solve share the same threads instead of starting new ones.
+ */
+SCIP_RETCODE SCIPstatInitTpi(
+   SCIP_STAT*            stat,               /**< problem statistics data */
+   int                   nthreads            /**< minimal number of threads */
+   )
+{
+   assert(stat != NULL);
+   assert(nthreads >= 1);
+
+   if( !stat->tpiinitialized )
+   {
+      SCIP_CALL( SCIPtpiInit(nthreads, INT_MAX, FALSE) );
+      stat->tpiinitialized = TRUE;
+   }
+   else if( SCIPtpiGetNumThreads() < nthreads )
+   {
+      /* a further initialization enlarges the shared thread pool */
+      SCIP_CALL( SCIPtpiInit(nthreads, INT_MAX, FALSE) );
+      SCIP_CALL( SCIPtpiExit() );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** releases the reference to the task processing interface obtained by SCIPstatInitTpi(), if any */
+SCIP_RETCODE SCIPstatExitTpi(
+   SCIP_STAT*            stat                /**< problem statistics data */
+   )
+{
+   assert(stat != NULL);
+
+   if( stat->tpiinitialized )
+   {
+      stat->tpiinitialized = FALSE;
+      SCIP_CALL( SCIPtpiExit() );
+   }
+
+   return SCIP_OKAY;
+}
+
 /** diables the collection of any statistic for a variable */
 void SCIPstatDisableVarHistory(
    SCIP_STAT*            stat                /**< problem statistics data */
@@ -245,6 +293,9 @@ void SCIPstatReset(
    stat->ntotalinternalnodes = 0;
    stat->ntotalnodesmerged = 0;
    stat->ncreatednodes = 0;
+   stat->nlpbases = 0;
+   stat->nlpbasisdeltas = 0;
+   stat->maxlpbasismem = 0;
    stat->nlpsolsfound = 0;
    stat->nrelaxsolsfound = 0;
    stat->npssolsfound = 0;
@@ -66,6 +66,21 @@ SCIP_RETCODE SCIPstatFree(
    BMS_BLKMEM*           blkmem              /**< block memory */
    );
 
+/** makes sure that the task processing interface provides at least the given number of threads
+ *
+ *  The reference to the task processing interface is kept until SCIPstatExitTpi() is called when the transformed
+ *  problem is freed, such that all parallel steps of a solve share the same threads instead of starting new ones.
+ */
+SCIP_RETCODE SCIPstatInitTpi(
+   SCIP_STAT*            stat,               /**< problem statistics data */
+   int                   nthreads            /**< minimal number of threads */
+   );
+
+/** releases the reference to the task processing interface obtained by SCIPstatInitTpi(), if any */
+SCIP_RETCODE SCIPstatExitTpi(
+   SCIP_STAT*            stat                /**< problem statistics data */
+   );
+
 /** diables the collection of any statistic for a variable */
 void SCIPstatDisableVarHistory(
    SCIP_STAT*            stat                /**< problem statistics data */
@@ -102,6 +102,8 @@ struct SCIP_Benders
    SCIP_Bool             threadsafe;         /**< has the copy been created requiring thread safety */
    SCIP_Real             solutiontol;        /**< storing the tolerance for optimality in Benders' decomposition */
    int                   numthreads;         /**< the number of threads to use when solving the subproblem */
+   SCIP_Bool             stoponcut;          /**< should the remaining subproblems of a solve loop be skipped once a solved
+                                              *   subproblem shows that the solution is infeasible or not optimal? */
    SCIP_Bool             execfeasphase;      /**< should a feasibility phase be executed during the root node, i.e.
                                                   adding slack variables to constraints to ensure feasibility */
    SCIP_Real             slackvarcoef;       /**< the initial objective coefficient of the slack variables in the subproblem */
@@ -181,6 +183,8 @@ struct SCIP_SubproblemSolveStat
    int                   idx;                /**< the index of the subproblem */
    int                   ncalls;             /**< the number of times this subproblems has been solved */
    SCIP_Real             avgiter;            /**< the average number of LP/NLP iterations performed */
+   SCIP_Real             avgtime;            /**< the average wall clock time of a call in seconds */
+   SCIP_CLOCK*           solveclock;         /**< wall clock measuring the solving time of the current call */
 };
 
 /** parameters that are set to solve the subproblem. This will be changed from what the user inputs, so they are stored
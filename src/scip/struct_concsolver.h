@@ -37,6 +37,7 @@
 #include "scip/def.h"
 #include "scip/type_concsolver.h"
 #include "scip/type_clock.h"
+#include "scip/type_lp.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -83,6 +84,14 @@ struct SCIP_ConcSolver
    SCIP_Longint                        ntighterintbnds;           /**< number of tighter global variable bounds the concurrent solver received
                                                                    *   on integer variables */
    SCIP_CLOCK*                         totalsynctime;             /**< total time used for synchronization, including idle time */
+   SCIP_CLOCK*                         syncwaittime;              /**< time spent waiting for other solvers during synchronization */
+   SCIP_Longint                        nsyncwaits;                /**< number of times the solver had to wait for other solvers during
+                                                                   *   synchronization */
+   int*                                splitvaridxs;              /**< indices of the variables whose bounds restrict the solver to its
+                                                                   *   part of a split search tree, or NULL */
+   SCIP_BOUNDTYPE*                     splitbndtypes;             /**< types of the bounds of the split search tree, or NULL */
+   SCIP_Real*                          splitbnds;                 /**< values of the bounds of the split search tree, or NULL */
+   int                                 nsplitbnds;                /**< number of bounds of the split search tree */
 };
 
 #ifdef __cplusplus
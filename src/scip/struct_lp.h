@@ -76,6 +76,7 @@
 
 
 #include "scip/def.h"
+#include "scip/bitencode.h"
 #include "scip/type_lp.h"
 #include "scip/type_var.h"
 #include "scip/type_event.h"
@@ -125,6 +126,24 @@ struct SCIP_LpSolVals
    SCIP_Bool             lpissolved;         /**< is current LP solved? */
 };
 
+/** basis status of the columns and rows of an LP in packed format
+ *  The basis is either stored completely or as the changes to the basis of a parent LP, whose columns and rows are
+ *  the first columns and rows of this LP. The packed status array then contains the status of the changed columns and
+ *  rows of the parent, followed by the status of the new columns and the new rows.
+ */
+struct SCIP_LpBasis
+{
+   SCIP_LPBASIS*         parent;             /**< basis the changes refer to, or NULL if the basis is stored completely */
+   SCIP_DUALPACKET*      packstat;           /**< packed basis status of the changed and the new columns and rows */
+   int*                  chgidx;             /**< indices of the changed columns and rows of the parent basis, where
+                                              *   row i of the parent has index parent->ncols + i */
+   int                   ncols;              /**< number of columns */
+   int                   nrows;              /**< number of rows */
+   int                   nchgs;              /**< number of changed columns and rows of the parent basis */
+   int                   ndeltas;            /**< number of bases stored as changes on the way to a complete basis */
+   int                   nuses;              /**< number of times this basis is used */
+};
+
 /** LP column;
  *  The row vector of the LP column is partitioned into two parts: The first col->nlprows rows in the rows array
  *  are the ones that belong to the current LP (col->rows[j]->lppos >= 0) and that are linked to the column
@@ -294,6 +313,8 @@ struct SCIP_Lp
    SCIP_Real             degeneracy;         /**< share of degenerate non-basic variables in the current LP */
    SCIP_Real             varconsratio;       /**< variable-constraint ratio of the optimal face */
    SCIP_LPI*             lpi;                /**< LP solver interface */
+   SCIP_LPI**            sblpis;             /**< copies of the LP used by the jobs of parallel strong branching, or NULL */
+   SCIP_Longint*         sblpilpcounts;      /**< LP count of the LP loaded into each copy, or -1 if the copy is invalid */
    SCIP_COL**            lpicols;            /**< array with columns currently stored in the LP solver */
    SCIP_ROW**            lpirows;            /**< array with rows currently stored in the LP solver */
    SCIP_COL**            chgcols;            /**< array of changed columns not yet applied to the LP solver */
@@ -313,7 +334,9 @@ struct SCIP_Lp
    SCIP_Longint          validsoldirlp;      /**< LP number for which the currently stored solution direction vector is valid */
    SCIP_Longint          validdegeneracylp;  /**< LP number for which the currently stored degeneracy information is valid */
    SCIP_Longint          divenolddomchgs;    /**< number of domain changes before diving has started */
+   SCIP_Longint          basismem;           /**< memory used by the stored bases (bytes) */
    int                   lpicolssize;        /**< available slots in lpicols vector */
+   int                   nsblpis;            /**< number of copies of the LP for parallel strong branching */
    int                   nlpicols;           /**< number of columns in the LP solver */
    int                   lpifirstchgcol;     /**< first column of the LP which differs from the column in the LP solver */
    int                   lpirowssize;        /**< available slots in lpirows vector */
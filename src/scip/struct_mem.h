@@ -49,6 +49,9 @@ struct SCIP_Mem
    BMS_BLKMEM*           probmem;            /**< memory blocks for original problem and solution process: preprocessing, bab-tree, ... */
    BMS_BUFMEM*           buffer;             /**< memory buffers for short living temporary objects */
    BMS_BUFMEM*           cleanbuffer;        /**< memory buffers for short living temporary objects, initialized to all zero */
+   BMS_ARENAMEM*         nodemem;            /**< arena memory for objects that live until the focus node changes */
+   BMS_MEMACCOUNT*       account;            /**< used block and buffer memory of the problem per source file */
+   SCIP_Bool             accounting;         /**< is the account attached to the problem and buffer memories? */
 };
 
 #ifdef __cplusplus
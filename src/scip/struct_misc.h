@@ -37,6 +37,7 @@
 #include "scip/def.h"
 #include "blockmemshell/memory.h"
 #include "scip/type_misc.h"
+#include "tpi/type_tpi.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -153,6 +154,33 @@ struct SCIP_HashSet
    uint32_t              nelements;          /**< number of elements in the hashtable */
 };
 
+/** concurrent hash table: the elements are distributed over stripes, i.e., hash tables with their own lock and block
+ *  memory, by the low bits of their hash value
+ */
+struct SCIP_ConcHashTable
+{
+   SCIP_DECL_HASHGETKEY((*hashgetkey));      /**< gets the key of the given element */
+   SCIP_DECL_HASHKEYVAL((*hashkeyval));      /**< returns the hash value of the key */
+   BMS_BLKMEM*           blkmem;             /**< block memory used to store the arrays of the stripes */
+   void*                 userptr;            /**< user pointer */
+   SCIP_HASHTABLE**      tables;             /**< hash tables of the stripes */
+   BMS_BLKMEM**          blkmems;            /**< block memories of the stripes */
+   SCIP_LOCK**           locks;              /**< locks of the stripes */
+   uint32_t              mask;               /**< mask to compute the stripe of a hash value, i.e. nstripes - 1 */
+};
+
+/** concurrent hash map: the entries are distributed over stripes, i.e., hash maps with their own lock and block
+ *  memory, by the low bits of the hash value of their origin
+ */
+struct SCIP_ConcHashMap
+{
+   BMS_BLKMEM*           blkmem;             /**< block memory used to store the arrays of the stripes */
+   SCIP_HASHMAP**        maps;               /**< hash maps of the stripes */
+   BMS_BLKMEM**          blkmems;            /**< block memories of the stripes */
+   SCIP_LOCK**           locks;              /**< locks of the stripes */
+   uint32_t              mask;               /**< mask to compute the stripe of a hash value, i.e. nstripes - 1 */
+};
+
 /** dynamic array for storing real values */
 struct SCIP_RealArray
 {
@@ -0,0 +1,68 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2023 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   struct_nodeswap.h
+ * @ingroup INTERNALAPI
+ * @brief  datastructures for the on-disk storage of open nodes
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SCIP_STRUCT_NODESWAP_H__
+#define __SCIP_STRUCT_NODESWAP_H__
+
+#include <stdio.h>
+
+#include "scip/def.h"
+#include "scip/type_misc.h"
+#include "scip/type_nodeswap.h"
+#include "scip/type_tree.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** on-disk storage for the data of open nodes
+ *
+ *  Each node has at most one record, which is appended to the swap file. The space of records that were read again is
+ *  not reused until the swap file does not contain any record anymore.
+ */
+struct SCIP_NodeSwap
+{
+   FILE*                 file;               /**< swap file, or NULL if it was not opened yet */
+   SCIP_HASHMAP*         recordmap;          /**< maps the nodes to the positions of their records */
+   SCIP_NODE**           nodes;              /**< nodes of the records */
+   SCIP_Longint*         offsets;            /**< positions of the records in the swap file */
+   int*                  sizes;              /**< sizes of the records before compression */
+   int*                  storedsizes;        /**< sizes of the records in the swap file */
+   SCIP_Longint          filesize;           /**< end of the last record in the swap file */
+   int                   nrecords;           /**< number of records in the swap file */
+   int                   recordssize;        /**< size of the record arrays */
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
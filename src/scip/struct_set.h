@@ -76,6 +76,7 @@ struct SCIP_Set
    SCIP_PARAMSET*        paramset;           /**< set of parameters */
    BMS_BUFMEM*           buffer;             /**< memory buffers for short living temporary objects */
    BMS_BUFMEM*           cleanbuffer;        /**< memory buffers for short living temporary objects init. to all zero */
+   BMS_ARENAMEM*         nodemem;            /**< arena memory for objects that live until the focus node changes */
    SCIP_READER**         readers;            /**< file readers */
    SCIP_PRICER**         pricers;            /**< variable pricers */
    SCIP_CONSHDLR**       conshdlrs;          /**< constraint handlers (sorted by check priority) */
@@ -207,6 +208,7 @@ struct SCIP_Set
    SCIP_Bool             branch_checksbsol;  /**< should LP solutions during strong branching with propagation be checked for feasibility? */
    SCIP_Bool             branch_roundsbsol;  /**< should LP solutions during strong branching with propagation be rounded? (only when checksbsol=TRUE) */
    SCIP_Bool             branch_sumadjustscore; /**< score adjustment near zero by \b adding epsilon (TRUE) or using maximum (FALSE) */
+   int                   branch_sbnthreads;  /**< number of threads used to evaluate strong branching candidates */
 
    /* conflict analysis settings */
    SCIP_Real             conf_maxvarsfac;    /**< maximal fraction of variables involved in a conflict constraint */
@@ -379,12 +381,14 @@ struct SCIP_Set
 
    /* memory settings */
    SCIP_Real             mem_savefac;        /**< fraction of maximal memory usage resulting in switch to memory saving mode */
+   SCIP_Real             mem_swapfac;        /**< fraction of maximal memory usage at which open nodes are swapped to disk */
    SCIP_Real             mem_arraygrowfac;   /**< memory growing factor for dynamically allocated arrays */
    SCIP_Real             mem_treegrowfac;    /**< memory growing factor for tree array */
    SCIP_Real             mem_pathgrowfac;    /**< memory growing factor for path array */
    int                   mem_arraygrowinit;  /**< initial size of dynamically allocated arrays */
    int                   mem_treegrowinit;   /**< initial size of tree array */
    int                   mem_pathgrowinit;   /**< initial size of path array */
+   SCIP_Bool             mem_accounting;     /**< should the used block and buffer memory be recorded per source file? */
 
    /* miscellaneous settings */
    SCIP_Bool             misc_catchctrlc;    /**< should the CTRL-C interrupt be caught by SCIP? */
@@ -580,8 +584,12 @@ struct SCIP_Set
    /* concurrent solver settings */
    SCIP_Bool             concurrent_changeseeds;    /**< change the seeds in the different solvers? */
    SCIP_Bool             concurrent_changechildsel; /**< change the child selection rule in different solvers? */
+   SCIP_Bool             concurrent_changelpalgo;   /**< change the algorithm for the initial LP in different solvers? */
    SCIP_Bool             concurrent_commvarbnds;    /**< should the concurrent solvers communicate global variable bound changes? */
    SCIP_Bool             concurrent_presolvebefore; /**< should the problem be presolved before it is copied to the concurrent solvers? */
+   SCIP_Bool             concurrent_presolvecopies; /**< should the concurrent solvers presolve the centrally presolved problem again? */
+   SCIP_Bool             concurrent_treesplit;      /**< should the search tree be split among the concurrent solvers instead of
+                                                     *   letting every solver work on the whole tree? */
    int                   concurrent_initseed;       /**< the seed for computing the concurrent solver seeds */
    SCIP_Real             concurrent_freqinit;       /**< initial frequency of synchronization */
    SCIP_Real             concurrent_freqmax;        /**< maximal frequency of synchronization */
@@ -88,6 +88,9 @@ struct SCIP_Stat
    SCIP_Longint          ntotalinternalnodes;/**< total number of nodes processed in all runs where a branching was performed */
    SCIP_Longint          ntotalnodesmerged;  /**< total number of nodes added ot the statistics of the main SCIP so far (see SCIPmergeStatistics) */
    SCIP_Longint          ncreatednodes;      /**< total number of nodes created */
+   SCIP_Longint          nlpbases;           /**< total number of LP bases stored for forks */
+   SCIP_Longint          nlpbasisdeltas;     /**< total number of LP bases of forks stored as changes to the parent basis */
+   SCIP_Longint          maxlpbasismem;      /**< maximal memory used by the stored LP bases of forks in a run (bytes) */
    SCIP_Longint          ncreatednodesrun;   /**< number of nodes created in current run */
    SCIP_Longint          nactivatednodes;    /**< number of times, a node got activated in current run */
    SCIP_Longint          ndeactivatednodes;  /**< number of times, a node got deactivated in current run */
@@ -282,6 +285,8 @@ struct SCIP_Stat
    SCIP_Bool             performpresol;      /**< indicates whether presolving is enabled */
    SCIP_Bool             branchedunbdvar;    /**< indicates whether branching on an unbounded variable has been performed */
    SCIP_Bool             disableenforelaxmsg;/**< was disable enforelax message printed? */
+   SCIP_Bool             tpiinitialized;     /**< does this SCIP instance hold a reference to the task processing
+                                              *   interface that is released when the transformed problem is freed? */
 };
 
 #ifdef __cplusplus
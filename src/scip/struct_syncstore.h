@@ -57,7 +57,7 @@ struct SCIP_SyncStore
                                               *   by all threads */
 
    SCIP*                 mainscip;           /**< the SCIP instance that was used for initializing the syncstore */
-   SCIP_Bool             stopped;            /**< flag to indicate if the solving is stopped */
+   int                   stopped;            /**< flag to indicate if the solving is stopped, accessed atomically */
    SCIP_LOCK*            lock;               /**< lock to protect the syncstore data structure from data races */
 
    /* SPI settings */
@@ -71,6 +71,7 @@ struct SCIP_SyncStore
    SCIP_Real             syncfreqmax;        /**< the maximum synchronization frequency */
    int                   maxnsols;           /**< maximum number of solutions that can be shared in one synchronization */
    int                   nsolvers;           /**< number of solvers synchronizing with this syncstore */
+   SCIP_Bool             treesplit;          /**< does each solver work on its own part of a split search tree? */
 };
 
 
@@ -88,13 +89,18 @@ struct SCIP_SyncData
    int                   winner;             /**< the solverid of the solver with the best status */
    SCIP_STATUS           status;             /**< the best status that was stored in this synchronization data */
    SCIP_LOCK*            lock;               /**< a lock to protect this synchronization data */
-   int                   syncedcount;        /**< a counter of how many solvers have finished writing to this synchronization data */
+   int                   syncedcount;        /**< a counter of how many solvers have finished writing to this synchronization data,
+                                              *   which is accessed atomically such that readers do not need the lock */
    SCIP_CONDITION*       allsynced;          /**< a condition variable to signal when the last solver has finished writing to this
                                               *   synchronization data */
    SCIP_BOUNDSTORE*      boundstore;         /**< a boundstore for storing all the bound changes that were added to this
                                               *   synchronization data */
    SCIP_Real             syncfreq;           /**< the synchroization frequency that was set in this synchronization data */
    SCIP_Longint          memtotal;           /**< the total amount of memory used by all solvers including the main SCIP */
+   int                   nfinished;          /**< number of solvers that have finished their part of a split search tree */
+   int                   splitwinner;        /**< the solverid of the solver with the smallest lower bound on a split search tree */
+   SCIP_Real             splitwinnerlb;      /**< lower bound of the winner on a split search tree */
+   SCIP_Real             splitwinnerub;      /**< upper bound of the winner on a split search tree */
 };
 
 /** struct for storing the position of avariables lower and upper bound in the boundstore */
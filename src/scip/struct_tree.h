@@ -40,6 +40,7 @@
 #include "scip/type_history.h"
 #include "scip/type_lp.h"
 #include "scip/type_nodesel.h"
+#include "scip/type_nodeswap.h"
 #include "scip/type_prop.h"
 #include "scip/type_tree.h"
 #include "scip/type_var.h"
@@ -108,11 +109,11 @@ struct SCIP_Fork
 {
    SCIP_COL**            addedcols;          /**< array with pointers to new columns added at this node into the LP */
    SCIP_ROW**            addedrows;          /**< array with pointers to new rows added at this node into the LP */
-   SCIP_LPISTATE*        lpistate;           /**< LP state information */
+   SCIP_LPBASIS*         lpbasis;            /**< LP basis, possibly stored as changes to the basis of the parent fork */
    SCIP_Real             lpobjval;           /**< the LP objective value for that node, needed to compute the pseudo costs correctly */
    int                   naddedcols;         /**< number of columns added at this node */
    int                   naddedrows;         /**< number of rows added at this node */
-   int                   nlpistateref;       /**< number of times, the LP state is needed */
+   int                   nlpistateref;       /**< number of times, the LP basis is needed */
    unsigned int          nchildren:28;       /**< number of children of this parent node */
    unsigned int          lpwasprimfeas:1;    /**< primal feasibility of saved LP state information */
    unsigned int          lpwasprimchecked:1; /**< primal feasibility check state of saved LP state information */
@@ -164,6 +165,7 @@ struct SCIP_Node
    unsigned int          active:1;           /**< is node in the path to the current node? */
    unsigned int          cutoff:1;           /**< should the node and all sub nodes be cut off from the tree? */
    unsigned int          reprop:1;           /**< should propagation be applied again, if the node is on the active path? */
+   unsigned int          swapped:1;          /**< were the domain changes of the leaf written to the swap file? */
    unsigned int          nodetype:4;         /**< type of node */
 };
 
@@ -185,6 +187,7 @@ struct SCIP_Tree
 {
    SCIP_NODE*            root;               /**< root node of the tree */
    SCIP_NODEPQ*          leaves;             /**< leaves of the tree */
+   SCIP_NODESWAP*        nodeswap;           /**< on-disk storage for the domain changes of leaves, or NULL */
    SCIP_NODE**           path;               /**< array of nodes storing the active path from root to current node, which
                                               *   is usually the focus or a probing node; in case of a cut off, the path
                                               *   may already end earlier */
@@ -232,6 +235,7 @@ struct SCIP_Tree
    int                   repropdepth;        /**< depth of first node in active path that has to be propagated again */
    int                   repropsubtreecount; /**< cyclicly increased counter to create markers for subtree repropagation */
    int                   probingsumchgdobjs; /**< number of changed objective coefficients in all probing nodes */
+   int                   swapnextnkept;      /**< number of leaves in memory at which leaves are swapped again */
    SCIP_Bool             focusnodehaslp;     /**< is LP being processed in the focus node? */
    SCIP_Bool             probingnodehaslp;   /**< was the LP solved (at least once) in the current probing node? */
    SCIP_Bool             focuslpconstructed; /**< was the LP of the focus node already constructed? */
@@ -78,6 +78,7 @@ SCIP_RETCODE SCIPsyncstoreCreate(
    (*syncstore)->initialized = FALSE;
    (*syncstore)->syncdata = NULL;
    (*syncstore)->stopped = FALSE;
+   (*syncstore)->treesplit = FALSE;
    (*syncstore)->nuses = 1;
 
    SCIP_CALL( SCIPtpiInitLock(&(*syncstore)->lock) );
@@ -157,6 +158,7 @@ SCIP_RETCODE SCIPsyncstoreInit(
    SCIP_CALL( SCIPgetRealParam(scip, "concurrent/sync/minsyncdelay", &syncstore->minsyncdelay) );
    SCIP_CALL( SCIPgetRealParam(scip, "concurrent/sync/freqinit", &syncstore->syncfreqinit) );
    SCIP_CALL( SCIPgetRealParam(scip, "concurrent/sync/freqmax", &syncstore->syncfreqmax) );
+   SCIP_CALL( SCIPgetBoolParam(scip, "concurrent/treesplit", &syncstore->treesplit) );
    syncstore->nsyncdata = getNSyncdata(scip);
    SCIP_CALL( SCIPallocBlockMemoryArray(syncstore->mainscip, &(syncstore->syncdata), syncstore->nsyncdata) );
 
@@ -240,15 +242,9 @@ SCIP_Bool SCIPsyncstoreSolveIsStopped(
    SCIP_SYNCSTORE*       syncstore           /**< the synchronization store */
    )
 {
-   SCIP_Bool stopped;
-
-   SCIP_CALL_ABORT( SCIPtpiAcquireLock(syncstore->lock) );
-
-   stopped = syncstore->stopped;
-
-   SCIP_CALL_ABORT( SCIPtpiReleaseLock(syncstore->lock) );
+   assert(syncstore != NULL);
 
-   return stopped;
+   return SCIPtpiAtomicLoadInt(&syncstore->stopped) != 0;
 }
 
 /** sets the solve-is-stopped flag in the syncstore so that subsequent calls to
@@ -259,11 +255,9 @@ void SCIPsyncstoreSetSolveIsStopped(
    SCIP_Bool             stopped             /**< flag if the solve is stopped */
    )
 {
-   SCIP_CALL_ABORT( SCIPtpiAcquireLock(syncstore->lock) );
-
-   syncstore->stopped = stopped;
+   assert(syncstore != NULL);
 
-   SCIP_CALL_ABORT( SCIPtpiReleaseLock(syncstore->lock) );
+   SCIPtpiAtomicStoreInt(&syncstore->stopped, stopped ? 1 : 0);
 }
 
 /** gets the upperbound from the last synchronization */
@@ -396,12 +390,32 @@ SCIP_SYNCDATA* SCIPsyncstoreGetNextSyncdata(
    if( newdelay < syncstore->minsyncdelay && nextsyncnum >= writenum - syncstore->maxnsyncdelay )
       return NULL;
 
+   /* in opportunistic mode, the synchronization data is only read once all solvers have written to it, unless the
+    * reading is enforced; hence, a slow solver only stalls the others when the ring of synchronization data is full
+    */
+   if( syncstore->mode == SCIP_PARA_OPPORTUNISTIC && nextsyncnum >= writenum - syncstore->maxnsyncdelay
+      && !SCIPsyncstoreIsAllSynced(syncstore, &syncstore->syncdata[nextsyncnum % syncstore->nsyncdata]) )
+      return NULL;
+
    *delay = newdelay;
    assert(syncstore->syncdata[nextsyncnum % syncstore->nsyncdata].syncnum == nextsyncnum);
 
    return &syncstore->syncdata[nextsyncnum % syncstore->nsyncdata];
 }
 
+/** checks without blocking whether all solvers have written to the given synchronization data */
+SCIP_Bool SCIPsyncstoreIsAllSynced(
+   SCIP_SYNCSTORE*       syncstore,          /**< the synchronization store */
+   SCIP_SYNCDATA*        syncdata            /**< the synchronization data */
+   )
+{
+   assert(syncdata != NULL);
+   assert(syncstore != NULL);
+   assert(syncstore->initialized);
+
+   return SCIPtpiAtomicLoadInt(&syncdata->syncedcount) >= syncstore->nsolvers;
+}
+
 /** ensures that the given synchronization data has been written by
  *  all solvers upon return of this function and blocks the caller if necessary. */
 SCIP_RETCODE SCIPsyncstoreEnsureAllSynced(
@@ -413,10 +427,14 @@ SCIP_RETCODE SCIPsyncstoreEnsureAllSynced(
    assert(syncstore != NULL);
    assert(syncstore->initialized);
 
+   /* the counter is published atomically, so no lock is needed if the synchronization data is complete */
+   if( SCIPsyncstoreIsAllSynced(syncstore, syncdata) )
+      return SCIP_OKAY;
+
    /* check if waiting is required, make sure to hold the lock */
    SCIP_CALL( SCIPtpiAcquireLock(syncdata->lock) );
 
-   while( syncdata->syncedcount < syncstore->nsolvers )
+   while( SCIPtpiAtomicLoadInt(&syncdata->syncedcount) < syncstore->nsolvers )
    {
       /* yes, so wait on the condition variable
        * (automatically releases the lock and reacquires it after the waiting)
@@ -429,6 +447,39 @@ SCIP_RETCODE SCIPsyncstoreEnsureAllSynced(
    return SCIP_OKAY;
 }
 
+/** blocks the caller until the synchronization data with the given number has been written by all solvers, its slot
+ *  has been reused for a later synchronization, or the solving is stopped
+ *
+ *  This is used by a solver that has nothing left to do but still needs to take part in the synchronization, such that
+ *  it waits for the other solvers instead of repeatedly starting new synchronizations.
+ */
+SCIP_RETCODE SCIPsyncstoreWaitSync(
+   SCIP_SYNCSTORE*       syncstore,          /**< the synchronization store */
+   SCIP_Longint          syncnum             /**< the number of the synchronization to wait for */
+   )
+{
+   SCIP_SYNCDATA* syncdata;
+
+   assert(syncstore != NULL);
+   assert(syncstore->initialized);
+   assert(syncnum >= 0);
+
+   syncdata = &syncstore->syncdata[syncnum % syncstore->nsyncdata];
+
+   SCIP_CALL( SCIPtpiAcquireLock(syncdata->lock) );
+
+   /* the solving is only stopped by the solver completing a synchronization data, which broadcasts the condition */
+   while( syncdata->syncnum == syncnum && SCIPtpiAtomicLoadInt(&syncdata->syncedcount) < syncstore->nsolvers
+      && !SCIPsyncstoreSolveIsStopped(syncstore) )
+   {
+      SCIP_CALL( SCIPtpiWaitCondition(syncdata->allsynced, syncdata->lock) );
+   }
+
+   SCIP_CALL( SCIPtpiReleaseLock(syncdata->lock) );
+
+   return SCIP_OKAY;
+}
+
 /** Start synchronization for the given concurrent solver.
  *  Needs to be followed by a call to SCIPsyncstoreFinishSync if
  *  the syncdata that is returned is not NULL
@@ -460,14 +511,19 @@ SCIP_RETCODE SCIPsyncstoreStartSync(
 
    if( (*syncdata)->syncnum != syncnum )
    {
+      SCIPtpiAtomicStoreInt(&(*syncdata)->syncedcount, 0);
       SCIPboundstoreClear((*syncdata)->boundstore);
       (*syncdata)->nsols = 0;
       (*syncdata)->memtotal = SCIPgetMemTotal(syncstore->mainscip);
-      (*syncdata)->syncedcount = 0;
       (*syncdata)->bestupperbound = SCIPinfinity(syncstore->mainscip);
-      (*syncdata)->bestlowerbound = -(*syncdata)->bestupperbound;
+      /* on a split search tree, the lower bound is the minimum over all solvers */
+      (*syncdata)->bestlowerbound = syncstore->treesplit ? (*syncdata)->bestupperbound : -(*syncdata)->bestupperbound;
       (*syncdata)->status = SCIP_STATUS_UNKNOWN;
       (*syncdata)->winner = 0;
+      (*syncdata)->nfinished = 0;
+      (*syncdata)->splitwinner = -1;
+      (*syncdata)->splitwinnerlb = SCIP_INVALID;
+      (*syncdata)->splitwinnerub = SCIP_INVALID;
       (*syncdata)->syncnum = syncnum;
       (*syncdata)->syncfreq = 0.0;
    }
@@ -488,16 +544,29 @@ SCIP_RETCODE SCIPsyncstoreFinishSync(
    assert(syncstore != NULL);
    assert(syncstore->initialized);
 
-   ++(*syncdata)->syncedcount;
-
-   if( (*syncdata)->syncedcount == syncstore->nsolvers )
+   /* the counter is only modified while holding the lock, but it is read without the lock; hence, the last solver
+    * completes the synchronization data before it publishes the final count
+    */
+   if( SCIPtpiAtomicLoadInt(&(*syncdata)->syncedcount) + 1 < syncstore->nsolvers )
    {
+      (void) SCIPtpiAtomicFetchAddInt(&(*syncdata)->syncedcount, 1);
+   }
+   else
+   {
+      /* on a split search tree, the solving is finished once every solver has finished its part */
+      if( syncstore->treesplit && (*syncdata)->status == SCIP_STATUS_UNKNOWN && (*syncdata)->nfinished == syncstore->nsolvers )
+      {
+         (*syncdata)->status = SCIPisInfinity(syncstore->mainscip, (*syncdata)->bestupperbound) ? SCIP_STATUS_INFEASIBLE
+            : SCIP_STATUS_OPTIMAL;
+      }
+
       if( (*syncdata)->status != SCIP_STATUS_UNKNOWN )
          SCIPsyncstoreSetSolveIsStopped(syncstore, TRUE);
 
       syncstore->lastsync = *syncdata;
       printline = TRUE;
 
+      (void) SCIPtpiAtomicFetchAddInt(&(*syncdata)->syncedcount, 1);
       SCIP_CALL( SCIPtpiBroadcastCondition((*syncdata)->allsynced) );
    }
 
@@ -534,6 +603,10 @@ int SCIPsyncstoreGetWinner(
    if( syncstore->lastsync == NULL || syncstore->lastsync->status == SCIP_STATUS_UNKNOWN )
       return -1;
 
+   /* on a split search tree, the solver with the smallest lower bound determines the solving status */
+   if( syncstore->treesplit && syncstore->lastsync->splitwinner >= 0 )
+      return syncstore->lastsync->splitwinner;
+
    return syncstore->lastsync->winner;
 }
 
@@ -544,7 +617,17 @@ int SCIPsyncdataGetNSynced(
 {
    assert(syncdata != NULL);
 
-   return syncdata->syncedcount;
+   return SCIPtpiAtomicLoadInt(&syncdata->syncedcount);
+}
+
+/** does each solver work on its own part of a split search tree? */
+SCIP_Bool SCIPsyncstoreIsTreeSplit(
+   SCIP_SYNCSTORE*       syncstore           /**< the synchronization store */
+   )
+{
+   assert(syncstore != NULL);
+
+   return syncstore->treesplit;
 }
 
 /** how many solvers have are running concurrently */
@@ -676,6 +759,37 @@ void SCIPsyncdataSetStatus(
    }
 }
 
+/** reports the bounds of a solver that works on its own part of a split search tree to the synchronization data
+ *
+ *  The lower bound of the synchronization data is the minimum over all solvers. The winner is the solver with the
+ *  smallest lower bound, where ties are broken by the smallest upper bound and then by the solverid, such that the
+ *  winner is selected deterministically.
+ */
+void SCIPsyncdataSetSubtreeBounds(
+   SCIP_SYNCDATA*        syncdata,           /**< the synchronization data */
+   SCIP_Real             lowerbound,         /**< the lower bound of the solver's part of the tree */
+   SCIP_Real             upperbound,         /**< the objective value of the solver's best solution */
+   SCIP_Bool             finished,           /**< has the solver finished its part of the tree? */
+   int                   solverid            /**< identifier of the solver */
+   )
+{
+   assert(syncdata != NULL);
+
+   syncdata->bestlowerbound = MIN(syncdata->bestlowerbound, lowerbound);
+
+   if( finished )
+      ++syncdata->nfinished;
+
+   if( syncdata->splitwinner < 0 || lowerbound < syncdata->splitwinnerlb
+      || (lowerbound == syncdata->splitwinnerlb && (upperbound < syncdata->splitwinnerub /*lint !e777*/
+         || (upperbound == syncdata->splitwinnerub && solverid < syncdata->splitwinner))) ) /*lint !e777*/
+   {
+      syncdata->splitwinner = solverid;
+      syncdata->splitwinnerlb = lowerbound;
+      syncdata->splitwinnerub = upperbound;
+   }
+}
+
 /** adds memory used to the synchronization data */
 void SCIPsyncdataAddMemTotal(
    SCIP_SYNCDATA*        syncdata,           /**< the synchronization data the solution should be added to */
@@ -140,6 +140,13 @@ SCIP_SYNCDATA* SCIPsyncstoreGetNextSyncdata(
    SCIP_Real*            delay               /**< pointer holding the current synchronization delay */
    );
 
+/** checks without blocking whether all solvers have written to the given synchronization data */
+SCIP_EXPORT
+SCIP_Bool SCIPsyncstoreIsAllSynced(
+   SCIP_SYNCSTORE*       syncstore,          /**< the synchronization store */
+   SCIP_SYNCDATA*        syncdata            /**< the synchronization data */
+   );
+
 /** ensures that the given synchronization data has been written by
  *  all solvers upon return of this function and blocks the caller if necessary. */
 SCIP_EXPORT
@@ -148,6 +155,15 @@ SCIP_RETCODE SCIPsyncstoreEnsureAllSynced(
    SCIP_SYNCDATA*        syncdata            /**< the synchronization data */
    );
 
+/** blocks the caller until the synchronization data with the given number has been written by all solvers, its slot
+ *  has been reused for a later synchronization, or the solving is stopped
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPsyncstoreWaitSync(
+   SCIP_SYNCSTORE*       syncstore,          /**< the synchronization store */
+   SCIP_Longint          syncnum             /**< the number of the synchronization to wait for */
+   );
+
 /** Start synchronization for the given concurrent solver.
  *  Needs to be followed by a call to SCIPsyncstoreFinishSync if
  *  the syncdata that is returned is not NULL
@@ -185,6 +201,12 @@ int SCIPsyncdataGetNSynced(
    SCIP_SYNCDATA*        syncdata            /**< the synchronization data */
    );
 
+/** does each solver work on its own part of a split search tree? */
+SCIP_EXPORT
+SCIP_Bool SCIPsyncstoreIsTreeSplit(
+   SCIP_SYNCSTORE*       syncstore           /**< the synchronization store */
+   );
+
 /** how many solvers have are running concurrently */
 SCIP_EXPORT
 int SCIPsyncstoreGetNSolvers(
@@ -246,6 +268,21 @@ void SCIPsyncdataSetStatus(
    int                   solverid            /**< identifier of te solver that has this status */
    );
 
+/** reports the bounds of a solver that works on its own part of a split search tree to the synchronization data
+ *
+ *  The lower bound of the synchronization data is the minimum over all solvers. The winner is the solver with the
+ *  smallest lower bound, where ties are broken by the smallest upper bound and then by the solverid, such that the
+ *  winner is selected deterministically.
+ */
+SCIP_EXPORT
+void SCIPsyncdataSetSubtreeBounds(
+   SCIP_SYNCDATA*        syncdata,           /**< the synchronization data */
+   SCIP_Real             lowerbound,         /**< the lower bound of the solver's part of the tree */
+   SCIP_Real             upperbound,         /**< the objective value of the solver's best solution */
+   SCIP_Bool             finished,           /**< has the solver finished its part of the tree? */
+   int                   solverid            /**< identifier of the solver */
+   );
+
 /** adds memory used to the synchronization data */
 SCIP_EXPORT
 void SCIPsyncdataAddMemTotal(
@@ -157,6 +157,11 @@
 #define TABLE_POSITION_SOL               20000                  /**< the position of the statistics table */
 #define TABLE_EARLIEST_STAGE_SOL         SCIP_STAGE_PRESOLVING  /**< output of the statistics table is only printed from this stage onwards */
 
+#define TABLE_NAME_MEMORY                "memory"
+#define TABLE_DESC_MEMORY                "memory statistics table"
+#define TABLE_POSITION_MEMORY            20500                  /**< the position of the statistics table */
+#define TABLE_EARLIEST_STAGE_MEMORY      SCIP_STAGE_PROBLEM     /**< output of the statistics table is only printed from this stage onwards */
+
 #define TABLE_NAME_CONC                  "concurrentsolver"
 #define TABLE_DESC_CONC                  "concurrent solver statistics table"
 #define TABLE_POSITION_CONC              21000                  /**< the position of the statistics table */
@@ -434,6 +439,18 @@ SCIP_DECL_TABLEOUTPUT(tableOutputSol)
    return SCIP_OKAY;
 }
 
+/** output method of statistics table to output file stream 'file' */
+static
+SCIP_DECL_TABLEOUTPUT(tableOutputMemory)
+{  /*lint --e{715}*/
+   assert(scip != NULL);
+   assert(table != NULL);
+
+   SCIPprintMemoryStatistics(scip, file);
+
+   return SCIP_OKAY;
+}
+
 /** output method of statistics table to output file stream 'file' */
 static
 SCIP_DECL_TABLEOUTPUT(tableOutputConc)
@@ -519,6 +536,7 @@ SCIP_RETCODE SCIPincludeTableDefault(
       assert(SCIPfindTable(scip, TABLE_NAME_TREE) != NULL );
       assert(SCIPfindTable(scip, TABLE_NAME_ROOT) != NULL );
       assert(SCIPfindTable(scip, TABLE_NAME_SOL) != NULL );
+      assert(SCIPfindTable(scip, TABLE_NAME_MEMORY) != NULL );
       assert(SCIPfindTable(scip, TABLE_NAME_CONC) != NULL );
       assert(SCIPfindTable(scip, TABLE_NAME_BENDERS) != NULL );
       assert(SCIPfindTable(scip, TABLE_NAME_EXPRHDLRS) != NULL );
@@ -646,6 +664,11 @@ SCIP_RETCODE SCIPincludeTableDefault(
          tableCopyDefault, NULL, NULL, NULL, NULL, NULL, tableOutputSol,
          NULL, TABLE_POSITION_SOL, TABLE_EARLIEST_STAGE_SOL) );
 
+   assert(SCIPfindTable(scip, TABLE_NAME_MEMORY) == NULL);
+   SCIP_CALL( SCIPincludeTable(scip, TABLE_NAME_MEMORY, TABLE_DESC_MEMORY, TRUE,
+         tableCopyDefault, NULL, NULL, NULL, NULL, NULL, tableOutputMemory,
+         NULL, TABLE_POSITION_MEMORY, TABLE_EARLIEST_STAGE_MEMORY) );
+
    assert(SCIPfindTable(scip, TABLE_NAME_CONC) == NULL);
    SCIP_CALL( SCIPincludeTable(scip, TABLE_NAME_CONC, TABLE_DESC_CONC, TRUE,
          tableCopyDefault, NULL, NULL, NULL, NULL, NULL, tableOutputConc,
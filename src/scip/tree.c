@@ -33,6 +33,7 @@
 /*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
 
 #include <assert.h>
+#include <string.h>
 
 #include "scip/def.h"
 #include "scip/set.h"
@@ -51,6 +52,7 @@
 #include "scip/solve.h"
 #include "scip/cons.h"
 #include "scip/nodesel.h"
+#include "scip/nodeswap.h"
 #include "scip/prop.h"
 #include "scip/debug.h"
 #include "scip/prob.h"
@@ -62,6 +64,8 @@
 
 
 #define MAXREPROPMARK       511  /**< maximal subtree repropagation marker; must correspond to node data structure */
+#define SWAP_KEEPFRAC       0.5  /**< fraction of the leaves that keep their domain changes in memory after swapping */
+#define SWAP_MINNEWLEAVES   100  /**< minimal number of new leaves in memory before leaves are swapped again */
 
 
 /*
@@ -193,10 +197,8 @@ SCIP_RETCODE forkReleaseLPIState(
    assert(lp != NULL);
 
    fork->nlpistateref--;
-   if( fork->nlpistateref == 0 )
-   {
-      SCIP_CALL( SCIPlpFreeState(lp, blkmem, &(fork->lpistate)) );
-   }
+   if( fork->nlpistateref == 0 && fork->lpbasis != NULL )
+      SCIPlpbasisRelease(&fork->lpbasis, blkmem, lp);
 
    SCIPdebugMessage("released LPI state of fork %p -> new nlpistateref=%d\n", (void*)fork, fork->nlpistateref);
 
@@ -527,11 +529,14 @@ SCIP_RETCODE forkCreate(
    SCIP_FORK**           fork,               /**< pointer to fork data */
    BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< dynamic problem statistics */
    SCIP_PROB*            prob,               /**< transformed problem after presolve */
    SCIP_TREE*            tree,               /**< branch and bound tree */
    SCIP_LP*              lp                  /**< current LP data */
    )
 {
+   SCIP_LPBASIS* parentbasis;
+
    assert(fork != NULL);
    assert(blkmem != NULL);
    assert(tree != NULL);
@@ -546,7 +551,20 @@ SCIP_RETCODE forkCreate(
 
    SCIP_ALLOC( BMSallocBlockMemory(blkmem, fork) );
 
-   SCIP_CALL( SCIPlpGetState(lp, blkmem, &((*fork)->lpistate)) );
+   /* store the basis as changes to the basis of the parent fork, which is still captured by the focus node */
+   parentbasis = NULL;
+   if( tree->focuslpstatefork != NULL && SCIPnodeGetType(tree->focuslpstatefork) == SCIP_NODETYPE_FORK )
+      parentbasis = tree->focuslpstatefork->data.fork->lpbasis;
+
+   SCIP_CALL( SCIPlpGetBasis(lp, blkmem, set, parentbasis, &((*fork)->lpbasis)) );
+
+   if( (*fork)->lpbasis != NULL )
+   {
+      ++stat->nlpbases;
+      if( SCIPlpbasisIsDelta((*fork)->lpbasis) )
+         ++stat->nlpbasisdeltas;
+      stat->maxlpbasismem = MAX(stat->maxlpbasismem, SCIPlpGetBasisMem(lp));
+   }
    (*fork)->lpwasprimfeas = lp->primalfeasible;
    (*fork)->lpwasprimchecked = lp->primalchecked;
    (*fork)->lpwasdualfeas = lp->dualfeasible;
@@ -599,7 +617,7 @@ SCIP_RETCODE forkFree(
    assert(*fork != NULL);
    assert((*fork)->nchildren == 0);
    assert((*fork)->nlpistateref == 0);
-   assert((*fork)->lpistate == NULL);
+   assert((*fork)->lpbasis == NULL);
    assert(blkmem != NULL);
    assert(set != NULL);
    assert(lp != NULL);
@@ -984,6 +1002,7 @@ SCIP_RETCODE nodeCreate(
    (*node)->active = FALSE;
    (*node)->cutoff = FALSE;
    (*node)->reprop = FALSE;
+   (*node)->swapped = FALSE;
    (*node)->repropsubtreemark = 0;
 
    return SCIP_OKAY;
@@ -1051,6 +1070,97 @@ SCIP_Bool SCIPtreeWasNodeLastBranchParent(
    return FALSE;
 }
 
+/** writes the domain changes of a leaf to the swap file and releases its reference to the LP state of its fork
+ *
+ *  The LP state is not written, since its format depends on the LP solver. It is freed if no other node needs it; the
+ *  LP of the leaf is then solved starting from the current basis when the leaf is focused.
+ */
+static
+SCIP_RETCODE nodeSwapOut(
+   SCIP_NODE*            node,               /**< leaf to swap */
+   BMS_BLKMEM*           blkmem,             /**< block memory buffers */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_TREE*            tree,               /**< branch and bound tree */
+   SCIP_LP*              lp                  /**< current LP data */
+   )
+{
+   SCIP_RETCODE retcode;
+   char* data;
+   int size;
+
+   assert(node != NULL);
+   assert(SCIPnodeGetType(node) == SCIP_NODETYPE_LEAF);
+   assert(!node->swapped);
+   assert(node->domchg != NULL);
+   assert(node->domchg->domchgbound.domchgtype == SCIP_DOMCHGTYPE_BOUND); /*lint !e641*/
+   assert(tree != NULL);
+
+   if( tree->nodeswap == NULL )
+   {
+      SCIP_CALL( SCIPnodeswapCreate(&tree->nodeswap, blkmem) );
+   }
+
+   size = SCIPdomchgGetPackedSize(node->domchg);
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &data, size) );
+   SCIPdomchgPack(&node->domchg, blkmem, data);
+   assert(node->domchg == NULL);
+
+   retcode = SCIPnodeswapWrite(tree->nodeswap, blkmem, set, node, data, size);
+
+   /* keep the domain changes in memory if they could not be written */
+   if( retcode != SCIP_OKAY )
+   {
+      SCIP_CALL( SCIPdomchgUnpack(&node->domchg, blkmem, data) );
+   }
+
+   SCIPsetFreeBufferArray(set, &data);
+
+   SCIP_CALL( retcode );
+
+   node->swapped = TRUE;
+
+   if( node->data.leaf.lpstatefork != NULL )
+   {
+      SCIP_CALL( SCIPnodeReleaseLPIState(node->data.leaf.lpstatefork, blkmem, lp) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** reads the domain changes of a swapped leaf from the swap file and captures the LP state of its fork again */
+static
+SCIP_RETCODE nodeSwapIn(
+   SCIP_NODE*            node,               /**< swapped leaf */
+   BMS_BLKMEM*           blkmem,             /**< block memory buffers */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_TREE*            tree                /**< branch and bound tree */
+   )
+{
+   char* data;
+
+   assert(node != NULL);
+   assert(SCIPnodeGetType(node) == SCIP_NODETYPE_LEAF);
+   assert(node->swapped);
+   assert(node->domchg == NULL);
+   assert(tree != NULL);
+   assert(tree->nodeswap != NULL);
+
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &data, SCIPnodeswapGetSize(tree->nodeswap, node)) );
+   SCIP_CALL( SCIPnodeswapRead(tree->nodeswap, set, node, data) );
+   SCIP_CALL( SCIPdomchgUnpack(&node->domchg, blkmem, data) );
+   SCIPsetFreeBufferArray(set, &data);
+
+   node->swapped = FALSE;
+
+   /* the LP state may have been freed in the meantime, in which case the fork has no LP state anymore */
+   if( node->data.leaf.lpstatefork != NULL )
+   {
+      SCIP_CALL( SCIPnodeCaptureLPIState(node->data.leaf.lpstatefork, 1) );
+   }
+
+   return SCIP_OKAY;
+}
+
 /** frees node */
 SCIP_RETCODE SCIPnodeFree(
    SCIP_NODE**           node,               /**< node data */
@@ -1073,6 +1183,12 @@ SCIP_RETCODE SCIPnodeFree(
 
    SCIPsetDebugMsg(set, "free node #%" SCIP_LONGINT_FORMAT " at depth %d of type %d\n", SCIPnodeGetNumber(*node), SCIPnodeGetDepth(*node), SCIPnodeGetType(*node));
 
+   /* the data of the bound changes of a swapped leaf has to be released */
+   if( (*node)->swapped )
+   {
+      SCIP_CALL( nodeSwapIn(*node, blkmem, set, tree) );
+   }
+
    /* check lower bound w.r.t. debugging solution */
    SCIP_CALL( SCIPdebugCheckGlobalLowerbound(blkmem, set) );
 
@@ -3641,7 +3757,7 @@ SCIP_RETCODE SCIPtreeLoadLPState(
       if( SCIPnodeGetType(lpstatefork) == SCIP_NODETYPE_FORK )
       {
          assert(lpstatefork->data.fork != NULL);
-         SCIP_CALL( SCIPlpSetState(lp, blkmem, set, prob, eventqueue, lpstatefork->data.fork->lpistate,
+         SCIP_CALL( SCIPlpSetBasis(lp, blkmem, set, prob, eventqueue, lpstatefork->data.fork->lpbasis,
                lpstatefork->data.fork->lpwasprimfeas, lpstatefork->data.fork->lpwasprimchecked,
                lpstatefork->data.fork->lpwasdualfeas, lpstatefork->data.fork->lpwasdualchecked) );
       }
@@ -4133,7 +4249,7 @@ SCIP_RETCODE focusnodeToFork(
    assert(lp->solved);
 
    /* create fork data */
-   SCIP_CALL( forkCreate(&fork, blkmem, set, transprob, tree, lp) );
+   SCIP_CALL( forkCreate(&fork, blkmem, set, stat, transprob, tree, lp) );
 
    tree->focusnode->nodetype = SCIP_NODETYPE_FORK; /*lint !e641*/
    tree->focusnode->data.fork = fork;
@@ -4393,6 +4509,12 @@ SCIP_RETCODE SCIPnodeFocus(
    assert(conflictstore != NULL);
    assert(cutoff != NULL);
 
+   /* read the domain changes of a swapped leaf */
+   if( *node != NULL && (*node)->swapped )
+   {
+      SCIP_CALL( nodeSwapIn(*node, blkmem, set, tree) );
+   }
+
    /* check global lower bound w.r.t. debugging solution */
    SCIP_CALL( SCIPdebugCheckGlobalLowerbound(blkmem, set) );
 
@@ -4403,6 +4525,9 @@ SCIP_RETCODE SCIPnodeFocus(
       *node != NULL ? SCIPnodeGetNumber(*node) : -1, *node != NULL ? (int)SCIPnodeGetType(*node) : 0,
       *node != NULL ? SCIPnodeGetDepth(*node) : -1);
 
+   /* the objects in node memory only live until the focus node changes */
+   SCIPsetClearNodeMemory(set);
+
    /* remember old cutoff depth in order to know, whether the children and siblings can be deleted */
    oldcutoffdepth = tree->cutoffdepth;
 
@@ -4791,6 +4916,7 @@ SCIP_RETCODE SCIPtreeCreate(
    (*tree)->root = NULL;
 
    SCIP_CALL( SCIPnodepqCreate(&(*tree)->leaves, set, nodesel) );
+   (*tree)->nodeswap = NULL;
 
    /* allocate one slot for the prioritized and the unprioritized bound change */
    for( p = 0; p <= 1; ++p )
@@ -4835,6 +4961,7 @@ SCIP_RETCODE SCIPtreeCreate(
    (*tree)->cutoffdepth = INT_MAX;
    (*tree)->repropdepth = INT_MAX;
    (*tree)->repropsubtreecount = 0;
+   (*tree)->swapnextnkept = 0;
    (*tree)->focusnodehaslp = FALSE;
    (*tree)->probingnodehaslp = FALSE;
    (*tree)->focuslpconstructed = FALSE;
@@ -4879,6 +5006,10 @@ SCIP_RETCODE SCIPtreeFree(
    /* free node queue */
    SCIP_CALL( SCIPnodepqFree(&(*tree)->leaves, blkmem, set, stat, eventfilter, eventqueue, *tree, lp) );
 
+   /* free swap file, which is empty after all leaves were freed */
+   if( (*tree)->nodeswap != NULL )
+      SCIPnodeswapFree(&(*tree)->nodeswap, blkmem);
+
    /* free diving bound change storage */
    for( p = 0; p <= 1; ++p )
    {
@@ -4951,6 +5082,7 @@ SCIP_RETCODE SCIPtreeClear(
    tree->cutoffdepth = INT_MAX;
    tree->repropdepth = INT_MAX;
    tree->repropsubtreecount = 0;
+   tree->swapnextnkept = 0;
    tree->npendingbdchgs = 0;
    tree->focusnodehaslp = FALSE;
    tree->probingnodehaslp = FALSE;
@@ -5216,6 +5348,74 @@ SCIP_RETCODE SCIPtreeCutoff(
    return SCIP_OKAY;
 }
 
+/** writes the domain changes of leaves to the swap file and releases their references to the LP states of their forks,
+ *  until at most half of the leaves keep their domain changes in memory
+ *
+ *  The leaves are taken from the end of the node queue, which are the least likely to be selected soon. After swapping,
+ *  the leaves are only swapped again after a number of new leaves were created.
+ */
+SCIP_RETCODE SCIPtreeSwapLeaves(
+   SCIP_TREE*            tree,               /**< branch and bound tree */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_MESSAGEHDLR*     messagehdlr,        /**< message handler */
+   SCIP_STAT*            stat,               /**< dynamic problem statistics */
+   SCIP_LP*              lp                  /**< current LP data */
+   )
+{
+   SCIP_NODE** leaves;
+   int nleaves;
+   int nkept;
+   int maxnkept;
+   int nswapped;
+   int i;
+
+   assert(tree != NULL);
+   assert(set != NULL);
+   assert(stat != NULL);
+
+   /* the domain changes of cut off leaves are needed for reoptimization and for the visualization */
+   if( set->reopt_enable || strcmp(set->visual_vbcfilename, "-") != 0 || strcmp(set->visual_bakfilename, "-") != 0 )
+      return SCIP_OKAY;
+
+   nleaves = SCIPnodepqLen(tree->leaves);
+   nkept = nleaves - (tree->nodeswap != NULL ? SCIPnodeswapGetNNodes(tree->nodeswap) : 0);
+   if( nkept < tree->swapnextnkept )
+      return SCIP_OKAY;
+
+   leaves = SCIPnodepqNodes(tree->leaves);
+   maxnkept = (int)(SWAP_KEEPFRAC * nleaves);
+   nswapped = 0;
+
+   for( i = nleaves-1; i >= 0 && nkept > maxnkept; --i )
+   {
+      SCIP_NODE* leaf;
+
+      leaf = leaves[i];
+      assert(SCIPnodeGetType(leaf) == SCIP_NODETYPE_LEAF);
+
+      /* leaves without bound changes or with hole changes stay in memory */
+      if( leaf->swapped || leaf->domchg == NULL || leaf->domchg->domchgbound.domchgtype != SCIP_DOMCHGTYPE_BOUND ) /*lint !e641*/
+         continue;
+
+      SCIP_CALL( nodeSwapOut(leaf, blkmem, set, tree, lp) );
+      ++nswapped;
+      --nkept;
+   }
+
+   tree->swapnextnkept = nkept + MAX(SWAP_MINNEWLEAVES, nleaves / 10);
+
+   if( nswapped > 0 )
+   {
+      SCIPmessagePrintVerbInfo(messagehdlr, set->disp_verblevel, SCIP_VERBLEVEL_FULL,
+         "(node %" SCIP_LONGINT_FORMAT ") swapped %d open nodes to disk (%d swapped nodes, swap file: %.1fM)\n",
+         stat->nnodes, nswapped, SCIPnodeswapGetNNodes(tree->nodeswap),
+         (SCIP_Real)SCIPnodeswapGetFileSize(tree->nodeswap)/(1024.0*1024.0));
+   }
+
+   return SCIP_OKAY;
+}
+
 /** calculates the node selection priority for moving the given variable's LP value to the given target value;
  *  this node selection priority can be given to the SCIPcreateChild() call
  */
@@ -7535,6 +7735,9 @@ void SCIPnodeSetReoptID(
 
 /** gets the domain change information of the node, i.e., the information about the differences in the
  *  variables domains to the parent node
+ *
+ *  @note returns NULL for a leaf whose domain changes were swapped to disk (see parameter memory/swapfac) until the
+ *        leaf is focused
  */
 SCIP_DOMCHG* SCIPnodeGetDomchg(
    SCIP_NODE*            node                /**< node */
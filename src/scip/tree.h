@@ -500,6 +500,21 @@ SCIP_RETCODE SCIPtreeCutoff(
    SCIP_Real             cutoffbound         /**< cutoff bound: all nodes with lowerbound >= cutoffbound are cut off */
    );
 
+/** writes the domain changes of leaves to the swap file and releases their references to the LP states of their forks,
+ *  until at most half of the leaves keep their domain changes in memory
+ *
+ *  Swapping is skipped if reoptimization or the visualization is active, since they need the domain changes of cut off
+ *  leaves.
+ */
+SCIP_RETCODE SCIPtreeSwapLeaves(
+   SCIP_TREE*            tree,               /**< branch and bound tree */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_MESSAGEHDLR*     messagehdlr,        /**< message handler */
+   SCIP_STAT*            stat,               /**< dynamic problem statistics */
+   SCIP_LP*              lp                  /**< current LP data */
+   );
+
 /** constructs the LP relaxation of the focus node */
 SCIP_RETCODE SCIPtreeLoadLP(
    SCIP_TREE*            tree,               /**< branch and bound tree */
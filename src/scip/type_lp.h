@@ -90,6 +90,7 @@ typedef enum SCIP_LPAlgo SCIP_LPALGO;
 typedef struct SCIP_ColSolVals SCIP_COLSOLVALS;   /**< collected values of a column which depend on the LP solution */
 typedef struct SCIP_RowSolVals SCIP_ROWSOLVALS;   /**< collected values of a row which depend on the LP solution */
 typedef struct SCIP_LpSolVals SCIP_LPSOLVALS;     /**< collected values of the LP data which depend on the LP solution */
+typedef struct SCIP_LpBasis SCIP_LPBASIS;         /**< packed basis status of an LP, possibly relative to a smaller LP */
 
 /** column of an LP
  *
@@ -110,6 +110,18 @@ typedef struct SCIP_HashMap SCIP_HASHMAP;
  */
 typedef struct SCIP_HashSet SCIP_HASHSET;
 
+/** Concurrent hash table data structure whose elements are distributed over independently locked hash tables
+ *
+ *  - \ref ConcHash "List of all available methods"
+ */
+typedef struct SCIP_ConcHashTable SCIP_CONCHASHTABLE;
+
+/** Concurrent hash map data structure whose entries are distributed over independently locked hash maps
+ *
+ *  - \ref ConcHash "List of all available methods"
+ */
+typedef struct SCIP_ConcHashMap SCIP_CONCHASHMAP;
+
 /** dynamic array for storing SCIP_Real values */
 typedef struct SCIP_RealArray SCIP_REALARRAY;
 
@@ -1245,6 +1245,173 @@ SCIP_RETCODE SCIPdomchgMakeStatic(
    return SCIP_OKAY;
 }
 
+/* a packed bound change consists of a flag byte, the new bound, and the variable, followed by the LP solution value for
+ * branching decisions or by the inference variable, the reason, and the inference information for inferred bound
+ * changes
+ */
+#define BOUNDCHG_PACKEDSIZE         (1 + (int)sizeof(SCIP_Real) + (int)sizeof(SCIP_VAR*))
+#define BOUNDCHG_PACKEDBRANCHSIZE   ((int)sizeof(SCIP_Real))
+#define BOUNDCHG_PACKEDINFERSIZE    ((int)sizeof(SCIP_VAR*) + (int)sizeof(void*) + (int)sizeof(int))
+
+/** returns the number of bytes that SCIPdomchgPack() needs for the given static domain change data without hole
+ *  changes
+ */
+int SCIPdomchgGetPackedSize(
+   SCIP_DOMCHG*          domchg              /**< domain change data */
+   )
+{
+   int size;
+   int i;
+
+   assert(domchg != NULL);
+   assert(domchg->domchgbound.domchgtype == SCIP_DOMCHGTYPE_BOUND); /*lint !e641*/
+
+   size = (int)sizeof(int);
+   for( i = 0; i < (int)domchg->domchgbound.nboundchgs; ++i )
+   {
+      size += BOUNDCHG_PACKEDSIZE;
+      if( domchg->domchgbound.boundchgs[i].boundchgtype == SCIP_BOUNDCHGTYPE_BRANCHING ) /*lint !e641*/
+         size += BOUNDCHG_PACKEDBRANCHSIZE;
+      else
+         size += BOUNDCHG_PACKEDINFERSIZE;
+   }
+
+   return size;
+}
+
+/** writes the bound changes of static domain change data without hole changes into the given buffer and frees the
+ *  domain change data; the variables and constraints of the bound changes stay captured until the buffer is unpacked
+ *  again with SCIPdomchgUnpack(), such that the buffer is only valid in the current process
+ */
+void SCIPdomchgPack(
+   SCIP_DOMCHG**         domchg,             /**< pointer to domain change data */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   char*                 buffer              /**< buffer of at least SCIPdomchgGetPackedSize() bytes */
+   )
+{
+   SCIP_BOUNDCHG* boundchgs;
+   int nboundchgs;
+   int i;
+
+   assert(domchg != NULL);
+   assert(*domchg != NULL);
+   assert((*domchg)->domchgbound.domchgtype == SCIP_DOMCHGTYPE_BOUND); /*lint !e641*/
+   assert(blkmem != NULL);
+   assert(buffer != NULL);
+
+   boundchgs = (*domchg)->domchgbound.boundchgs;
+   nboundchgs = (int)(*domchg)->domchgbound.nboundchgs;
+
+   BMScopyMemorySize(buffer, &nboundchgs, sizeof(int));
+   buffer += sizeof(int);
+
+   for( i = 0; i < nboundchgs; ++i )
+   {
+      unsigned char flags;
+
+      flags = (unsigned char)(boundchgs[i].boundchgtype | (boundchgs[i].boundtype << 2)
+         | (boundchgs[i].inferboundtype << 3) | (boundchgs[i].applied << 4) | (boundchgs[i].redundant << 5));
+      *buffer = (char)flags;
+      ++buffer;
+      BMScopyMemorySize(buffer, &boundchgs[i].newbound, sizeof(SCIP_Real));
+      buffer += sizeof(SCIP_Real);
+      BMScopyMemorySize(buffer, &boundchgs[i].var, sizeof(SCIP_VAR*));
+      buffer += sizeof(SCIP_VAR*);
+
+      if( boundchgs[i].boundchgtype == SCIP_BOUNDCHGTYPE_BRANCHING ) /*lint !e641*/
+      {
+         BMScopyMemorySize(buffer, &boundchgs[i].data.branchingdata.lpsolval, sizeof(SCIP_Real));
+         buffer += sizeof(SCIP_Real);
+      }
+      else
+      {
+         void* reason;
+
+         reason = (boundchgs[i].boundchgtype == SCIP_BOUNDCHGTYPE_CONSINFER /*lint !e641*/
+            ? (void*)boundchgs[i].data.inferencedata.reason.cons : (void*)boundchgs[i].data.inferencedata.reason.prop);
+
+         BMScopyMemorySize(buffer, &boundchgs[i].data.inferencedata.var, sizeof(SCIP_VAR*));
+         buffer += sizeof(SCIP_VAR*);
+         BMScopyMemorySize(buffer, &reason, sizeof(void*));
+         buffer += sizeof(void*);
+         BMScopyMemorySize(buffer, &boundchgs[i].data.inferencedata.info, sizeof(int));
+         buffer += sizeof(int);
+      }
+   }
+
+   /* free the memory without releasing the data of the bound changes, which is now owned by the buffer */
+   BMSfreeBlockMemoryArray(blkmem, &(*domchg)->domchgbound.boundchgs, nboundchgs);
+   BMSfreeBlockMemorySize(blkmem, domchg, sizeof(SCIP_DOMCHGBOUND));
+}
+
+/** recreates static domain change data from a buffer that was written by SCIPdomchgPack() */
+SCIP_RETCODE SCIPdomchgUnpack(
+   SCIP_DOMCHG**         domchg,             /**< pointer to store the domain change data */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   const char*           buffer              /**< buffer written by SCIPdomchgPack() */
+   )
+{
+   SCIP_BOUNDCHG* boundchgs;
+   int nboundchgs;
+   int i;
+
+   assert(domchg != NULL);
+   assert(blkmem != NULL);
+   assert(buffer != NULL);
+
+   BMScopyMemorySize(&nboundchgs, buffer, sizeof(int));
+   buffer += sizeof(int);
+   assert(nboundchgs > 0);
+
+   SCIP_ALLOC( BMSallocBlockMemorySize(blkmem, domchg, sizeof(SCIP_DOMCHGBOUND)) );
+   SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &boundchgs, nboundchgs) );
+   (*domchg)->domchgbound.domchgtype = SCIP_DOMCHGTYPE_BOUND; /*lint !e641*/
+   (*domchg)->domchgbound.nboundchgs = (unsigned int)nboundchgs;
+   (*domchg)->domchgbound.boundchgs = boundchgs;
+
+   for( i = 0; i < nboundchgs; ++i )
+   {
+      unsigned char flags;
+
+      flags = (unsigned char)*buffer;
+      ++buffer;
+      boundchgs[i].boundchgtype = flags & 3u; /*lint !e641*/
+      boundchgs[i].boundtype = (flags >> 2) & 1u; /*lint !e641*/
+      boundchgs[i].inferboundtype = (flags >> 3) & 1u; /*lint !e641*/
+      boundchgs[i].applied = (flags >> 4) & 1u;
+      boundchgs[i].redundant = (flags >> 5) & 1u;
+      BMScopyMemorySize(&boundchgs[i].newbound, buffer, sizeof(SCIP_Real));
+      buffer += sizeof(SCIP_Real);
+      BMScopyMemorySize(&boundchgs[i].var, buffer, sizeof(SCIP_VAR*));
+      buffer += sizeof(SCIP_VAR*);
+
+      if( boundchgs[i].boundchgtype == SCIP_BOUNDCHGTYPE_BRANCHING ) /*lint !e641*/
+      {
+         BMScopyMemorySize(&boundchgs[i].data.branchingdata.lpsolval, buffer, sizeof(SCIP_Real));
+         buffer += sizeof(SCIP_Real);
+      }
+      else
+      {
+         void* reason;
+
+         BMScopyMemorySize(&boundchgs[i].data.inferencedata.var, buffer, sizeof(SCIP_VAR*));
+         buffer += sizeof(SCIP_VAR*);
+         BMScopyMemorySize(&reason, buffer, sizeof(void*));
+         buffer += sizeof(void*);
+         BMScopyMemorySize(&boundchgs[i].data.inferencedata.info, buffer, sizeof(int));
+         buffer += sizeof(int);
+
+         if( boundchgs[i].boundchgtype == SCIP_BOUNDCHGTYPE_CONSINFER ) /*lint !e641*/
+            boundchgs[i].data.inferencedata.reason.cons = (SCIP_CONS*)reason;
+         else
+            boundchgs[i].data.inferencedata.reason.prop = (SCIP_PROP*)reason;
+      }
+      assert(boundchgs[i].var != NULL);
+   }
+
+   return SCIP_OKAY;
+}
+
 /** ensures, that boundchgs array can store at least num entries */
 static
 SCIP_RETCODE domchgEnsureBoundchgsSize(
@@ -16351,10 +16518,12 @@ SCIP_Real SCIPvarGetAvgCutoffsCurrentRun(
  * information methods for bound changes
  */
 
-/** creates an artificial bound change information object with depth = INT_MAX and pos = -1 */
+/** creates an artificial bound change information object with depth = INT_MAX and pos = -1 in node memory, which is
+ *  freed when the focus node changes
+ */
 SCIP_RETCODE SCIPbdchginfoCreate(
    SCIP_BDCHGINFO**      bdchginfo,          /**< pointer to store bound change information */
-   BMS_BLKMEM*           blkmem,             /**< block memory */
+   BMS_ARENAMEM*         nodemem,            /**< node memory */
    SCIP_VAR*             var,                /**< active variable that changed the bounds */
    SCIP_BOUNDTYPE        boundtype,          /**< type of bound for var: lower or upper bound */
    SCIP_Real             oldbound,           /**< old value for bound */
@@ -16363,7 +16532,7 @@ SCIP_RETCODE SCIPbdchginfoCreate(
 {
    assert(bdchginfo != NULL);
 
-   SCIP_ALLOC( BMSallocBlockMemory(blkmem, bdchginfo) );
+   SCIP_ALLOC( BMSallocArenaMemory(nodemem, bdchginfo) );
    (*bdchginfo)->oldbound = oldbound;
    (*bdchginfo)->newbound = newbound;
    (*bdchginfo)->var = var;
@@ -16381,17 +16550,6 @@ SCIP_RETCODE SCIPbdchginfoCreate(
    return SCIP_OKAY;
 }
 
-/** frees a bound change information object */
-void SCIPbdchginfoFree(
-   SCIP_BDCHGINFO**      bdchginfo,          /**< pointer to store bound change information */
-   BMS_BLKMEM*           blkmem              /**< block memory */
-   )
-{
-   assert(bdchginfo != NULL);
-
-   BMSfreeBlockMemory(blkmem, bdchginfo);
-}
-
 /** returns the bound change information for the last lower bound change on given active problem variable before or
  *  after the bound change with the given index was applied;
  *  returns NULL, if no change to the lower bound was applied up to this point of time
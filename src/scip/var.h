@@ -129,6 +129,30 @@ SCIP_RETCODE SCIPdomchgMakeStatic(
    SCIP_LP*              lp                  /**< current LP data */
    );
 
+/** returns the number of bytes that SCIPdomchgPack() needs for the given static domain change data without hole
+ *  changes
+ */
+int SCIPdomchgGetPackedSize(
+   SCIP_DOMCHG*          domchg              /**< domain change data */
+   );
+
+/** writes the bound changes of static domain change data without hole changes into the given buffer and frees the
+ *  domain change data; the variables and constraints of the bound changes stay captured until the buffer is unpacked
+ *  again with SCIPdomchgUnpack(), such that the buffer is only valid in the current process
+ */
+void SCIPdomchgPack(
+   SCIP_DOMCHG**         domchg,             /**< pointer to domain change data */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   char*                 buffer              /**< buffer of at least SCIPdomchgGetPackedSize() bytes */
+   );
+
+/** recreates static domain change data from a buffer that was written by SCIPdomchgPack() */
+SCIP_RETCODE SCIPdomchgUnpack(
+   SCIP_DOMCHG**         domchg,             /**< pointer to store the domain change data */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   const char*           buffer              /**< buffer written by SCIPdomchgPack() */
+   );
+
 /** applies domain change */
 SCIP_RETCODE SCIPdomchgApply(
    SCIP_DOMCHG*          domchg,             /**< domain change to apply */
@@ -180,22 +204,18 @@ SCIP_RETCODE SCIPdomchgAddHolechg(
    SCIP_HOLELIST*        oldlist             /**< old value of list pointer */
    );
 
-/** creates an artificial bound change information object with depth = INT_MAX and pos = -1 */
+/** creates an artificial bound change information object with depth = INT_MAX and pos = -1 in node memory, which is
+ *  freed when the focus node changes
+ */
 SCIP_RETCODE SCIPbdchginfoCreate(
    SCIP_BDCHGINFO**      bdchginfo,          /**< pointer to store bound change information */
-   BMS_BLKMEM*           blkmem,             /**< block memory */
+   BMS_ARENAMEM*         nodemem,            /**< node memory */
    SCIP_VAR*             var,                /**< active variable that changed the bounds */
    SCIP_BOUNDTYPE        boundtype,          /**< type of bound for var: lower or upper bound */
    SCIP_Real             oldbound,           /**< old value for bound */
    SCIP_Real             newbound            /**< new value for bound */
    );
 
-/** frees a bound change information object */
-void SCIPbdchginfoFree(
-   SCIP_BDCHGINFO**      bdchginfo,          /**< pointer to store bound change information */
-   BMS_BLKMEM*           blkmem              /**< block memory */
-   );
-
 /** returns the relaxed bound change type */
 SCIP_Real SCIPbdchginfoGetRelaxedBound(
    SCIP_BDCHGINFO*       bdchginfo           /**< bound change to add to the conflict set */
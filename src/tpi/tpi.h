@@ -96,6 +96,30 @@ SCIP_RETCODE SCIPtpiWaitCondition(
    SCIP_LOCK*            lock                /**< the lock that is held by the caller */
    );
 
+/** atomically adds the given increment to an integer and returns the previous value
+ *
+ *  All writes of the calling thread before the call are visible to a thread that reads the new value with
+ *  SCIPtpiAtomicLoadInt() or SCIPtpiAtomicFetchAddInt().
+ */
+SCIP_EXPORT
+int SCIPtpiAtomicFetchAddInt(
+   int*                  value,              /**< the integer to modify */
+   int                   increment           /**< the increment */
+   );
+
+/** atomically reads an integer that is modified by other threads */
+SCIP_EXPORT
+int SCIPtpiAtomicLoadInt(
+   int*                  value               /**< the integer to read */
+   );
+
+/** atomically writes an integer that is read by other threads */
+SCIP_EXPORT
+void SCIPtpiAtomicStoreInt(
+   int*                  value,              /**< the integer to write */
+   int                   newvalue            /**< the new value */
+   );
+
 /** returns the number of threads */
 SCIP_EXPORT
 int SCIPtpiGetNumThreads(
@@ -108,6 +132,16 @@ int SCIPtpiGetThreadNum(
    void
    );
 
+/** returns whether the tpi is able to process jobs in parallel, i.e., whether SCIPtpiInit() can be called
+ *
+ *  This is only the case for the tinycthread tpi; the jobs of the OpenMP tpi are only processed in parallel inside a
+ *  parallel region, see TPI_PARA.
+ */
+SCIP_EXPORT
+SCIP_Bool SCIPtpiIsAvailable(
+   void
+   );
+
 /** creates a job for parallel processing */
 SCIP_EXPORT
 SCIP_RETCODE SCIPtpiCreateJob(
@@ -123,7 +157,11 @@ int SCIPtpiGetNewJobID(
    void
    );
 
-/** submit a job for parallel processing; the return value is a globally defined status */
+/** submit a job for parallel processing; the return value is a globally defined status
+ *
+ *  Jobs may also be submitted from within a running job. Such nested jobs are preferably processed by the thread that
+ *  submitted them.
+ */
 SCIP_EXPORT
 SCIP_RETCODE SCIPtpiSubmitJob(
    SCIP_JOB*             job,                /**< pointer to the job to be submitted */
@@ -132,13 +170,21 @@ SCIP_RETCODE SCIPtpiSubmitJob(
 
 /** blocks until all jobs of the given jobid have finished
  *  and then returns the smallest SCIP_RETCODE of all the jobs
+ *
+ *  If called from within a job, the calling thread may process other jobs while waiting.
  */
 SCIP_EXPORT
 SCIP_RETCODE SCIPtpiCollectJobs(
    int                   jobid               /**< the jobid of the jobs to wait for */
    );
 
-/** initializes tpi */
+/** initializes tpi
+ *
+ *  The tpi may be initialized several times, e.g., by a plugin while a concurrent solve is running. In this case, the
+ *  existing threads are shared, and the number of threads is increased if more than the current number of threads are
+ *  requested. Each call must be matched by a call to SCIPtpiExit(). Within SCIP, use SCIPinitTpi(), which keeps the
+ *  threads until the transformed problem is freed.
+ */
 SCIP_EXPORT
 SCIP_RETCODE SCIPtpiInit(
    int                   nthreads,           /**< the number of threads to be used */
@@ -147,7 +193,7 @@ SCIP_RETCODE SCIPtpiInit(
    SCIP_Bool             blockwhenfull       /**< should the queue block when full */
    );
 
-/** deinitializes the tpi */
+/** deinitializes the tpi; the threads are shut down when the last initialization has been matched */
 SCIP_EXPORT
 SCIP_RETCODE SCIPtpiExit(
    void
@@ -129,6 +129,49 @@ SCIP_RETCODE SCIPtpiWaitCondition(
    return SCIP_OKAY;
 }
 
+
+
+/*
+ * atomic operations
+ */
+
+/** atomically adds the given increment to an integer and returns the previous value */
+int SCIPtpiAtomicFetchAddInt(
+   int*                  value,              /**< the integer to modify */
+   int                   increment           /**< the increment */
+   )
+{
+   int oldvalue;
+
+   assert(value != NULL);
+
+   oldvalue = *value;
+   *value += increment;
+
+   return oldvalue;
+}
+
+/** atomically reads an integer that is modified by other threads */
+int SCIPtpiAtomicLoadInt(
+   int*                  value               /**< the integer to read */
+   )
+{
+   assert(value != NULL);
+
+   return *value;
+}
+
+/** atomically writes an integer that is read by other threads */
+void SCIPtpiAtomicStoreInt(
+   int*                  value,              /**< the integer to write */
+   int                   newvalue            /**< the new value */
+   )
+{
+   assert(value != NULL);
+
+   *value = newvalue;
+}
+
 /** returns the number of threads */
 int SCIPtpiGetNumThreads(
    void
@@ -145,6 +188,14 @@ int SCIPtpiGetThreadNum(
    return 0;
 }
 
+/** returns whether the tpi is able to process jobs in parallel, i.e., whether SCIPtpiInit() can be called */
+SCIP_Bool SCIPtpiIsAvailable(
+   void
+   )
+{
+   return FALSE;
+}
+
 
 
 /*
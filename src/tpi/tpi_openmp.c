@@ -98,6 +98,7 @@ struct SCIP_JobQueues
 typedef struct SCIP_JobQueues SCIP_JOBQUEUES;
 
 static SCIP_JOBQUEUES* _jobqueues = NULL;
+static int _nreferences = 0;                 /**< number of initializations of the tpi that have not been exited */
 
 
 /** create job queue */
@@ -424,6 +425,19 @@ int SCIPtpiGetThreadNum(
    return omp_get_thread_num();
 }
 
+/** returns whether the tpi is able to process jobs in parallel, i.e., whether SCIPtpiInit() can be called
+ *
+ *  The jobs of the OpenMP tpi are tasks, which are only executed in parallel if they are submitted inside a parallel
+ *  region (see TPI_PARA). Since SCIPtpiInit() does not open such a region, jobs submitted by plugins would run
+ *  sequentially on the submitting thread, so parallel jobs are reported as unavailable.
+ */
+SCIP_Bool SCIPtpiIsAvailable(
+   void
+   )
+{
+   return FALSE;
+}
+
 /** creates a job for parallel processing */
 SCIP_RETCODE SCIPtpiCreateJob(
    SCIP_JOB**            job,                /**< pointer to the job that will be created */
@@ -590,19 +604,34 @@ SCIP_RETCODE SCIPtpiCollectJobs(
    return retcode;
 }
 
-/** initializes tpi */
+/** initializes tpi
+ *
+ *  The reference counter and the creation and destruction of the job queue are protected by a common critical section,
+ *  such that the tpi can be initialized and deinitialized from different threads.
+ */
 SCIP_RETCODE SCIPtpiInit(
    int                   nthreads,           /**< the number of threads to be used */
    int                   queuesize,          /**< the size of the queue */
    SCIP_Bool             blockwhenfull       /**< should the queue block when full */
    )
 {
-   omp_set_num_threads(nthreads);
-   assert(_jobqueues == NULL);
+   SCIP_RETCODE retcode = SCIP_OKAY;
+
+   #pragma omp critical (tpiinit)
+   {
+      /* share the existing job queue */
+      if( _jobqueues != NULL )
+         ++_nreferences;
+      else
+      {
+         omp_set_num_threads(nthreads);
+         _nreferences = 1;
 
-   SCIP_CALL( createJobQueue(nthreads, queuesize, blockwhenfull) );
+         retcode = createJobQueue(nthreads, queuesize, blockwhenfull);
+      }
+   }
 
-   return SCIP_OKAY;
+   return retcode;
 }
 
 /** deinitializes tpi */
@@ -610,14 +639,23 @@ SCIP_RETCODE SCIPtpiExit(
    void
    )
 {
+   SCIP_RETCODE retcode = SCIP_OKAY;
+
    assert(_jobqueues != NULL);
-   assert(_jobqueues->finishedjobs.njobs == 0);
-   assert(_jobqueues->jobqueue.njobs == 0);
-   assert(_jobqueues->ncurrentjobs == 0);
 
-   SCIP_CALL( freeJobQueue() );
+   #pragma omp critical (tpiinit)
+   {
+      if( --_nreferences == 0 )
+      {
+         assert(_jobqueues->finishedjobs.njobs == 0);
+         assert(_jobqueues->jobqueue.njobs == 0);
+         assert(_jobqueues->ncurrentjobs == 0);
 
-   return SCIP_OKAY;
+         retcode = freeJobQueue();
+      }
+   }
+
+   return retcode;
 }
 
 
@@ -701,3 +739,52 @@ void SCIPtpiDestroyCondition(
 
    BMSfreeMemory(condition);
 }
+
+
+/*
+ * atomic operations
+ */
+
+/** atomically adds the given increment to an integer and returns the previous value */
+int SCIPtpiAtomicFetchAddInt(
+   int*                  value,              /**< the integer to modify */
+   int                   increment           /**< the increment */
+   )
+{
+   int oldvalue;
+
+   #pragma omp flush
+   #pragma omp atomic capture
+   {
+      oldvalue = *value;
+      *value += increment;
+   }
+   #pragma omp flush
+
+   return oldvalue;
+}
+
+/** atomically reads an integer that is modified by other threads */
+int SCIPtpiAtomicLoadInt(
+   int*                  value               /**< the integer to read */
+   )
+{
+   int result;
+
+   #pragma omp atomic read
+   result = *value;
+   #pragma omp flush
+
+   return result;
+}
+
+/** atomically writes an integer that is read by other threads */
+void SCIPtpiAtomicStoreInt(
+   int*                  value,              /**< the integer to write */
+   int                   newvalue            /**< the new value */
+   )
+{
+   #pragma omp flush
+   #pragma omp atomic write
+   *value = newvalue;
+}
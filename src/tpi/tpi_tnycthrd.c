@@ -36,6 +36,10 @@
 #include "blockmemshell/memory.h"
 #include "tinycthread/tinycthread.h"
 
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
 /* macros for direct access */
 
 /* lock */
@@ -65,179 +69,386 @@ struct SCIP_Condition
 
 
 typedef struct SCIP_ThreadPool SCIP_THREADPOOL;
+typedef struct SCIP_JobDeque SCIP_JOBDEQUE;
+typedef struct SCIP_JobGroup SCIP_JOBGROUP;
+typedef struct SCIP_JobGroupBucket SCIP_JOBGROUPBUCKET;
 static SCIP_THREADPOOL* _threadpool = NULL;
 _Thread_local int _threadnumber; /*lint !e129*/
+static _Thread_local SCIP_JOBDEQUE* _threaddeque = NULL; /*lint !e129*/
+
+/* the lock protecting the creation, growth, and destruction of the thread pool */
+static once_flag _initonce = ONCE_FLAG_INIT;
+static mtx_t _initlock;
+
+/** initial size of the job deque of each thread */
+#define TPI_INITDEQUESIZE 64
+
+/** maximal number of threads in the pool */
+#define TPI_MAXNTHREADS 64
+
+/** number of buckets of the hash table of job groups, must be a power of two */
+#define TPI_NGROUPBUCKETS 64
 
 /** A job added to the queue */
 struct SCIP_Job
 {
    int                   jobid;              /**< id to identify jobs from a common process */
-   struct                SCIP_Job* nextjob;  /**< pointer to the next job in the queue */
+   SCIP_JOBGROUP*        group;              /**< group of jobs with the same id; set when the job is submitted */
    SCIP_RETCODE          (*jobfunc)(void* args);/**< pointer to the job function */
    void*                 args;               /**< pointer to the function arguments */
-   SCIP_RETCODE          retcode;            /**< return code of the job */
 };
 
-/** the thread pool job queue */
-struct SCIP_JobQueue
+/** the jobs with a common job id
+ *
+ *  A group is created by the first submission of a job with its id and freed when the jobs are collected. Finished
+ *  jobs are freed immediately by the executing thread; only their return code is kept in the group.
+ */
+struct SCIP_JobGroup
+{
+   int                   jobid;              /**< id of the jobs in the group */
+   int                   nunfinished;        /**< number of submitted jobs that have not finished yet */
+   SCIP_RETCODE          retcode;            /**< smallest return code of the finished jobs */
+   mtx_t                 lock;               /**< lock protecting the counters of the group */
+   cnd_t                 finished;           /**< condition to broadcast that all jobs of the group have finished */
+   SCIP_JOBGROUP*        nextgroup;          /**< next group in the same bucket */
+};
+
+/** a bucket of the hash table of uncollected job groups, indexed by the job id
+ *
+ *  Since job ids are assigned consecutively, the groups of the jobs that are processed at the same time usually lie in
+ *  different buckets, such that looking up a group rarely needs to wait for another thread.
+ */
+struct SCIP_JobGroupBucket
 {
-   SCIP_JOB*             firstjob;           /**< pointer to the first job in the queue */
-   SCIP_JOB*             lastjob;            /**< pointer to the last job in the queue */
-   int                   njobs;              /**< number of jobs in the queue */
+   SCIP_JOBGROUP*        groups;             /**< list of groups in the bucket */
+   mtx_t                 lock;               /**< lock protecting the list */
 };
-typedef struct SCIP_JobQueue SCIP_JOBQUEUE;
 
-/** The thread pool */
+/** a double-ended job queue owned by a single thread of the pool
+ *
+ *  The owning thread adds and removes jobs at the bottom, such that nested jobs are processed depth-first by the
+ *  thread that created them. Idle threads steal jobs from the top, i.e., the oldest jobs of the deque. Each deque has
+ *  its own lock, so threads only contend with each other when stealing.
+ */
+struct SCIP_JobDeque
+{
+   SCIP_JOB**            jobs;               /**< circular buffer of jobs */
+   int                   size;               /**< size of the buffer, always a power of two */
+   int                   top;                /**< position of the oldest job in the buffer */
+   int                   njobs;              /**< number of jobs in the deque */
+   mtx_t                 lock;               /**< lock protecting the deque */
+};
+
+/** The thread pool
+ *
+ *  Jobs are submitted without taking the pool lock: the job id, the round robin counter, and the shutdown flag are
+ *  accessed atomically, the job groups are found in a hash table with a lock per bucket, and the jobs are pushed to
+ *  the deques with their own locks. The pool lock is only needed by threads that wait for jobs and by submitters that
+ *  wake them up.
+ */
 struct SCIP_ThreadPool
 {
    /* Pool Characteristics */
-   int                   nthreads;           /**< number of threads in the pool */
-   int                   queuesize;          /**< the total number of items to enter the queue */
+   int                   nthreads;           /**< number of threads in the pool, accessed atomically */
+   int                   queuesize;          /**< maximal number of jobs in a deque if blockwhenfull is set */
+   int                   nreferences;        /**< number of initializations of the tpi that have not been exited,
+                                              *   protected by the init lock */
 
    /* Current pool state */
-   thrd_t*               threads;            /**< the threads included in the pool */
-   SCIP_JOBQUEUE*        jobqueue;           /**< the job queue */
-   SCIP_JOBQUEUE*        currentjobs;        /**< the jobs currently being processed on a thread;
-                                              *   only a single job is allowed per thread. */
-   SCIP_JOBQUEUE*        finishedjobs;       /**< finished jobs that are not yet collected */
-   int                   currworkingthreads; /**< the threads currently processing jobs */
-   SCIP_Bool             blockwhenfull;      /**< indicates that the queue can only be as large as nthreads */
-   int                   currentid;          /**< current job id */
+   thrd_t                threads[TPI_MAXNTHREADS]; /**< the threads included in the pool */
+   SCIP_JOBDEQUE         deques[TPI_MAXNTHREADS];  /**< the job deques, one for each thread */
+   SCIP_JOBGROUPBUCKET   groups[TPI_NGROUPBUCKETS]; /**< hash table of job groups that have not been collected */
+   SCIP_Bool             blockwhenfull;      /**< indicates that a deque can only hold queuesize many jobs */
+   int                   currentid;          /**< current job id, accessed atomically */
+   int                   nextdeque;          /**< counter for the deque receiving the next job submitted from outside
+                                              *   the pool, accessed atomically */
+   int                   nidlethreads;       /**< number of threads waiting for jobs, accessed atomically */
 
    /* Control indicators */
-   SCIP_Bool             shutdown;           /**< indicates whether the pool needs to be shut down */
-   SCIP_Bool             queueopen;          /**< indicates whether the queue is open */
+   int                   shutdown;           /**< indicates whether the pool needs to be shut down, accessed atomically */
 
    /* mutex and locks for the thread pool */
-   mtx_t                 poollock;           /**< mutex to allow read and write of the pool features */
-   cnd_t                 queuenotempty;      /**< condition to broadcast the queue has jobs */
-   cnd_t                 queuenotfull;       /**< condition to broadcast the queue is not full */
-   cnd_t                 queueempty;         /**< condition to broadcast that the queue is empty */
-   cnd_t                 jobfinished;        /**< condition to broadcast that a job has been finished */
+   mtx_t                 poollock;           /**< mutex for waiting for jobs */
+   cnd_t                 worknotempty;       /**< condition to signal idle threads that jobs are available */
 };
 
-/** this function controls the execution of each of the threads */
+
+/*
+ * job deques
+ */
+
+/** initializes a job deque */
 static
-SCIP_RETCODE threadPoolThreadRetcode(
-   void*                 threadnum           /**< thread number is passed in as argument stored inside a void pointer */
+SCIP_RETCODE jobDequeInit(
+   SCIP_JOBDEQUE*        deque               /**< the deque to initialize */
    )
 {
-   SCIP_JOB* newjob;
-   SCIP_JOB* prevjob;
-   SCIP_JOB* currjob;
+   assert(deque != NULL);
 
-   _threadnumber = (int)(uintptr_t) threadnum;
+   SCIP_ALLOC( BMSallocMemoryArray(&deque->jobs, TPI_INITDEQUESIZE) );
+   deque->size = TPI_INITDEQUESIZE;
+   deque->top = 0;
+   deque->njobs = 0;
 
-   /* Increase the number of active threads */
-   SCIP_CALL( SCIPtnyAcquireLock(&(_threadpool->poollock)) );
-   _threadpool->currworkingthreads += 1;
-   SCIP_CALL( SCIPtnyReleaseLock(&(_threadpool->poollock)) );
+   SCIP_CALL( SCIPtnyInitLock(&deque->lock) );
 
-   /* this is an endless loop that runs until the thrd_exit function is called */
-   while( TRUE ) /*lint !e716*/
+   return SCIP_OKAY;
+}
+
+/** frees the memory of a job deque; jobs that are still contained in the deque are freed */
+static
+void jobDequeFree(
+   SCIP_JOBDEQUE*        deque               /**< the deque to free */
+   )
+{
+   assert(deque != NULL);
+
+   while( deque->njobs > 0 )
    {
-      SCIP_CALL( SCIPtnyAcquireLock(&(_threadpool->poollock)) );
+      BMSfreeMemory(&deque->jobs[deque->top]);
+      deque->top = (deque->top + 1) & (deque->size - 1);
+      --deque->njobs;
+   }
 
-      /* the queue is empty but the shutdown command has not been given */
-      while( _threadpool->jobqueue->njobs == 0 && !_threadpool->shutdown )
-      {
-         SCIP_CALL( SCIPtnyWaitCondition(&(_threadpool->queuenotempty), &(_threadpool->poollock)) );
-      }
+   SCIPtnyDestroyLock(&deque->lock);
+   BMSfreeMemoryArray(&deque->jobs);
+}
 
-      /* if the shutdown command has been given, then exit the thread */
-      if( _threadpool->shutdown )
-      {
-         /* Decrease the thread count when execution of job queue has completed */
-         _threadpool->currworkingthreads -= 1;
-         SCIP_CALL( SCIPtnyReleaseLock(&(_threadpool->poollock)) );
+/** adds a job at the bottom of the deque
+ *
+ *  If the deque holds queuesize many jobs and blockwhenfull is set, the job is not added and the status is set to
+ *  SCIP_SUBMIT_QUEUEFULL; otherwise, the deque grows as needed.
+ */
+static
+SCIP_RETCODE jobDequePush(
+   SCIP_JOBDEQUE*        deque,              /**< the deque */
+   SCIP_JOB*             job,                /**< the job to add */
+   SCIP_SUBMITSTATUS*    status              /**< pointer to store the job's submit status */
+   )
+{
+   SCIP_CALL( SCIPtnyAcquireLock(&deque->lock) );
 
-         thrd_exit((int)SCIP_OKAY);
-      }
+   if( _threadpool->blockwhenfull && deque->njobs >= _threadpool->queuesize )
+   {
+      SCIP_CALL( SCIPtnyReleaseLock(&deque->lock) );
+      *status = SCIP_SUBMIT_QUEUEFULL;
+      return SCIP_OKAY;
+   }
 
-      /* getting the next job in the queue */
-      newjob = _threadpool->jobqueue->firstjob;
-      _threadpool->jobqueue->njobs--;            /* decreasing the number of jobs in the queue */
+   /* double the size of the buffer and move the jobs to the front */
+   if( deque->njobs == deque->size )
+   {
+      SCIP_JOB** newjobs;
+      int i;
 
-      if( _threadpool->jobqueue->njobs == 0 )
-      {
-         _threadpool->jobqueue->firstjob = NULL;
-         _threadpool->jobqueue->lastjob = NULL;
-      }
-      else
-         _threadpool->jobqueue->firstjob = newjob->nextjob;     /* updating the queue */
+      SCIP_ALLOC( BMSallocMemoryArray(&newjobs, 2 * deque->size) );
 
-      /* if we want to wait when the queue is full, then we broadcast that the queue can now take new jobs */
-      if( _threadpool->blockwhenfull &&
-          _threadpool->jobqueue->njobs == _threadpool->queuesize - 1 )
-      {
-         SCIP_CALL( SCIPtnyBroadcastCondition(&(_threadpool->queuenotfull)) );
-      }
+      for( i = 0; i < deque->njobs; ++i )
+         newjobs[i] = deque->jobs[(deque->top + i) & (deque->size - 1)];
 
-      /* indicating that the queue is empty */
-      if( _threadpool->jobqueue->njobs == 0 )
-      {
-         SCIP_CALL( SCIPtnyBroadcastCondition(&(_threadpool->queueempty)) );
-      }
+      BMSfreeMemoryArray(&deque->jobs);
+      deque->jobs = newjobs;
+      deque->size *= 2;
+      deque->top = 0;
+   }
 
-      /* updating the current job list */
-      if( _threadpool->currentjobs->njobs == 0 )
-      {
-         _threadpool->currentjobs->firstjob = newjob;
-         _threadpool->currentjobs->lastjob = newjob;
-      }
-      else
-      {
-         _threadpool->currentjobs->lastjob->nextjob = newjob;
-         _threadpool->currentjobs->lastjob = newjob;
-      }
+   deque->jobs[(deque->top + deque->njobs) & (deque->size - 1)] = job;
+   ++deque->njobs;
 
-      _threadpool->currentjobs->njobs++;
+   SCIP_CALL( SCIPtnyReleaseLock(&deque->lock) );
 
-      SCIP_CALL( SCIPtnyReleaseLock(&(_threadpool->poollock)) );
+   *status = SCIP_SUBMIT_SUCCESS;
 
-      /* setting the job to run on this thread */
-      newjob->retcode = (*(newjob->jobfunc))(newjob->args);
+   return SCIP_OKAY;
+}
 
-      /* setting the current job on this thread to NULL */
-      SCIP_CALL( SCIPtnyAcquireLock(&(_threadpool->poollock)) );
+/** removes and returns the most recently added job of the deque, or NULL if the deque is empty */
+static
+SCIP_JOB* jobDequePop(
+   SCIP_JOBDEQUE*        deque               /**< the deque */
+   )
+{
+   SCIP_JOB* job = NULL;
 
-      /* finding the location of the processed job in the currentjobs queue */
-      currjob = _threadpool->currentjobs->firstjob;
-      prevjob = NULL;
+   SCIP_CALL_ABORT( SCIPtnyAcquireLock(&deque->lock) );
 
-      while( currjob != newjob )
-      {
-         prevjob = currjob;
-         currjob = prevjob->nextjob;
-      }
+   if( deque->njobs > 0 )
+   {
+      --deque->njobs;
+      job = deque->jobs[(deque->top + deque->njobs) & (deque->size - 1)];
+   }
 
-      /* removing the processed job from current jobs list */
-      if( currjob == _threadpool->currentjobs->firstjob )
-         _threadpool->currentjobs->firstjob = currjob->nextjob;
-      else
-         prevjob->nextjob = currjob->nextjob; /*lint !e794*/
+   SCIP_CALL_ABORT( SCIPtnyReleaseLock(&deque->lock) );
 
-      if( currjob == _threadpool->currentjobs->lastjob )
-         _threadpool->currentjobs->lastjob = prevjob;
+   return job;
+}
 
-      _threadpool->currentjobs->njobs--;
+/** removes and returns the oldest job of the deque, or NULL if the deque is empty or currently locked by another
+ *  thread
+ */
+static
+SCIP_JOB* jobDequeSteal(
+   SCIP_JOBDEQUE*        deque               /**< the deque */
+   )
+{
+   SCIP_JOB* job = NULL;
+
+   /* do not wait for a busy deque, another victim may be available */
+   if( mtx_trylock(&deque->lock) != thrd_success )
+      return NULL;
 
-      /* updating the finished job list */
-      if( _threadpool->finishedjobs->njobs == 0 )
+   if( deque->njobs > 0 )
+   {
+      job = deque->jobs[deque->top];
+      deque->top = (deque->top + 1) & (deque->size - 1);
+      --deque->njobs;
+   }
+
+   SCIP_CALL_ABORT( SCIPtnyReleaseLock(&deque->lock) );
+
+   return job;
+}
+
+/** returns whether any deque of the pool contains a job */
+static
+SCIP_Bool threadPoolHasQueuedJobs(
+   SCIP_THREADPOOL*      thrdpool            /**< the thread pool */
+   )
+{
+   int nthreads;
+   int i;
+
+   nthreads = SCIPtpiAtomicLoadInt(&thrdpool->nthreads);
+
+   for( i = 0; i < nthreads; ++i )
+   {
+      int njobs;
+
+      SCIP_CALL_ABORT( SCIPtnyAcquireLock(&thrdpool->deques[i].lock) );
+      njobs = thrdpool->deques[i].njobs;
+      SCIP_CALL_ABORT( SCIPtnyReleaseLock(&thrdpool->deques[i].lock) );
+
+      if( njobs > 0 )
+         return TRUE;
+   }
+
+   return FALSE;
+}
+
+/** returns the next job to be processed by the calling pool thread: its own most recent job if there is one, otherwise
+ *  the oldest job of another thread
+ */
+static
+SCIP_JOB* threadPoolFindJob(
+   SCIP_THREADPOOL*      thrdpool,           /**< the thread pool */
+   SCIP_JOBDEQUE*        deque               /**< deque of the calling thread */
+   )
+{
+   SCIP_JOB* job;
+   int nthreads;
+   int start;
+   int i;
+
+   job = jobDequePop(deque);
+
+   if( job != NULL )
+      return job;
+
+   /* start stealing at the neighbor of the calling thread, such that the victims are spread over the pool */
+   start = (int)(deque - thrdpool->deques);
+   nthreads = SCIPtpiAtomicLoadInt(&thrdpool->nthreads);
+
+   for( i = 1; i < nthreads; ++i )
+   {
+      job = jobDequeSteal(&thrdpool->deques[(start + i) % nthreads]);
+
+      if( job != NULL )
+         return job;
+   }
+
+   return NULL;
+}
+
+/** runs a job, frees it, and reports its return code to the job's group */
+static
+SCIP_RETCODE threadPoolExecuteJob(
+   SCIP_JOB*             job                 /**< the job to execute */
+   )
+{
+   SCIP_JOBGROUP* group;
+   SCIP_RETCODE retcode;
+
+   group = job->group;
+   assert(group != NULL);
+
+   retcode = (*(job->jobfunc))(job->args);
+   BMSfreeMemory(&job);
+
+   SCIP_CALL( SCIPtnyAcquireLock(&group->lock) );
+
+   group->retcode = MIN(group->retcode, retcode);
+   --group->nunfinished;
+
+   /* the group must not be accessed after the lock is released, since the collecting thread may free it */
+   if( group->nunfinished == 0 )
+   {
+      SCIP_CALL( SCIPtnyBroadcastCondition(&group->finished) );
+   }
+
+   SCIP_CALL( SCIPtnyReleaseLock(&group->lock) );
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * thread pool
+ */
+
+/** this function controls the execution of each of the threads */
+static
+SCIP_RETCODE threadPoolThreadRetcode(
+   void*                 threadnum           /**< thread number is passed in as argument stored inside a void pointer */
+   )
+{
+   SCIP_JOBDEQUE* deque;
+   SCIP_JOB* job;
+
+   _threadnumber = (int)(uintptr_t) threadnum;
+   deque = &_threadpool->deques[_threadnumber];
+   _threaddeque = deque;
+
+   /* this is an endless loop that runs until the pool is shut down and no jobs are left */
+   while( TRUE ) /*lint !e716*/
+   {
+      job = threadPoolFindJob(_threadpool, deque);
+
+      if( job != NULL )
       {
-         _threadpool->finishedjobs->firstjob = newjob;
-         _threadpool->finishedjobs->lastjob = newjob;
+         SCIP_CALL( threadPoolExecuteJob(job) );
+         continue;
       }
-      else
+
+      SCIP_CALL( SCIPtnyAcquireLock(&(_threadpool->poollock)) );
+
+      /* a submitter pushes its job before it checks for idle threads, and this thread announces itself as idle before
+       * it checks the deques; so either this thread finds the job or the submitter wakes it up, which it can only do
+       * after this thread waits and thereby releases the pool lock
+       */
+      (void) SCIPtpiAtomicFetchAddInt(&_threadpool->nidlethreads, 1);
+      while( !SCIPtpiAtomicLoadInt(&_threadpool->shutdown) && !threadPoolHasQueuedJobs(_threadpool) )
       {
-         _threadpool->finishedjobs->lastjob->nextjob = newjob;
-         _threadpool->finishedjobs->lastjob = newjob;
+         SCIP_CALL( SCIPtnyWaitCondition(&(_threadpool->worknotempty), &(_threadpool->poollock)) );
       }
+      (void) SCIPtpiAtomicFetchAddInt(&_threadpool->nidlethreads, -1);
 
-      _threadpool->finishedjobs->njobs++;
+      /* if the shutdown command has been given and all jobs have been processed, then exit the thread */
+      if( SCIPtpiAtomicLoadInt(&_threadpool->shutdown) && !threadPoolHasQueuedJobs(_threadpool) )
+      {
+         SCIP_CALL( SCIPtnyReleaseLock(&(_threadpool->poollock)) );
 
-      /* signalling that a job has been finished */
-      SCIP_CALL( SCIPtnyBroadcastCondition(&(_threadpool)->jobfinished) );
+         thrd_exit((int)SCIP_OKAY);
+      }
 
       SCIP_CALL( SCIPtnyReleaseLock(&(_threadpool->poollock)) );
    }
@@ -252,6 +463,52 @@ int threadPoolThread(
    return (int) threadPoolThreadRetcode(threadnum);
 }
 
+/** adds threads to the pool until it has the given number of threads
+ *
+ *  This function needs to be called while holding the init lock.
+ */
+static
+SCIP_RETCODE threadPoolGrow(
+   SCIP_THREADPOOL*      thrdpool,           /**< the thread pool */
+   int                   nthreads            /**< the new number of threads */
+   )
+{
+   uintptr_t i;
+   int oldnthreads;
+
+   oldnthreads = thrdpool->nthreads;
+   nthreads = MIN(nthreads, TPI_MAXNTHREADS);
+
+   if( nthreads <= oldnthreads )
+      return SCIP_OKAY;
+
+   for( i = (uintptr_t)oldnthreads; i < (uintptr_t)nthreads; i++ )
+   {
+      SCIP_CALL( jobDequeInit(&thrdpool->deques[i]) );
+   }
+
+   /* the new threads only work on their own deques and steal from the old ones until the number of threads is
+    * published, such that no job is submitted to the deque of a thread that could not be created
+    */
+   for( i = (uintptr_t)oldnthreads; i < (uintptr_t)nthreads; i++ )
+   {
+      if( thrd_create(&(thrdpool->threads[i]), threadPoolThread, (void*)i) != thrd_success )
+      {
+         int j;
+
+         for( j = (int)i; j < nthreads; j++ )
+            jobDequeFree(&thrdpool->deques[j]);
+
+         SCIPtpiAtomicStoreInt(&thrdpool->nthreads, (int)i);
+         return SCIP_ERROR;
+      }
+   }
+
+   SCIPtpiAtomicStoreInt(&thrdpool->nthreads, nthreads);
+
+   return SCIP_OKAY;
+}
+
 /** creates a threadpool */
 static
 SCIP_RETCODE createThreadPool(
@@ -261,7 +518,7 @@ SCIP_RETCODE createThreadPool(
    SCIP_Bool             blockwhenfull       /**< should the jobqueue block if it is full */
    )
 {
-   uintptr_t i;
+   int i;
 
    assert(nthreads >= 0);
    assert(qsize >= 0);
@@ -270,229 +527,203 @@ SCIP_RETCODE createThreadPool(
    SCIP_ALLOC( BMSallocMemory(thrdpool) );
    (*thrdpool)->currentid = 0;
    (*thrdpool)->queuesize = qsize;
-   (*thrdpool)->nthreads = nthreads;
+   (*thrdpool)->nthreads = 0;
+   (*thrdpool)->nreferences = 1;
    (*thrdpool)->blockwhenfull = blockwhenfull;
    (*thrdpool)->shutdown = FALSE;
-   (*thrdpool)->queueopen = TRUE;
-
-   /* allocating memory for the job queue */
-   SCIP_ALLOC( BMSallocMemory(&(*thrdpool)->jobqueue) );
-   (*thrdpool)->jobqueue->firstjob = NULL;
-   (*thrdpool)->jobqueue->lastjob = NULL;
-   (*thrdpool)->jobqueue->njobs = 0;
-
-   /* allocating memory for the job queue */
-   SCIP_ALLOC( BMSallocMemory(&(*thrdpool)->currentjobs) );
-   (*thrdpool)->currentjobs->firstjob = NULL;
-   (*thrdpool)->currentjobs->lastjob = NULL;
-   (*thrdpool)->currentjobs->njobs = 0;
-
-   /* allocating memory for the job queue */
-   SCIP_ALLOC( BMSallocMemory(&(*thrdpool)->finishedjobs) );
-   (*thrdpool)->finishedjobs->firstjob = NULL;
-   (*thrdpool)->finishedjobs->lastjob = NULL;
-   (*thrdpool)->finishedjobs->njobs = 0;
+   (*thrdpool)->nextdeque = 0;
+   (*thrdpool)->nidlethreads = 0;
+
+   for( i = 0; i < TPI_NGROUPBUCKETS; i++ )
+   {
+      (*thrdpool)->groups[i].groups = NULL;
+      SCIP_CALL( SCIPtnyInitLock(&(*thrdpool)->groups[i].lock) );
+   }
 
    /* initialising the mutex */
    SCIP_CALL( SCIPtnyInitLock(&(*thrdpool)->poollock) ); /*lint !e2482*/
 
    /* initialising the conditions */
-   SCIP_CALL( SCIPtnyInitCondition(&(*thrdpool)->queuenotempty) );
-   SCIP_CALL( SCIPtnyInitCondition(&(*thrdpool)->queuenotfull) );
-   SCIP_CALL( SCIPtnyInitCondition(&(*thrdpool)->queueempty) );
-   SCIP_CALL( SCIPtnyInitCondition(&(*thrdpool)->jobfinished) );
-
-   /* creating the threads */
-   (*thrdpool)->currworkingthreads = 0;
+   SCIP_CALL( SCIPtnyInitCondition(&(*thrdpool)->worknotempty) );
 
-   /* allocating memory for the threads */
-   SCIP_ALLOC( BMSallocMemoryArray(&((*thrdpool)->threads), nthreads) );
+   /* the pool has to be visible to the threads when they start */
+   _threadpool = *thrdpool;
 
-   /* create the threads */
-   for( i = 0; i < (unsigned)nthreads; i++ )
-   {
-      if( thrd_create(&((*thrdpool)->threads[i]), threadPoolThread, (void*)i) != thrd_success )
-         return SCIP_ERROR;
-   }
+   SCIP_CALL( threadPoolGrow(*thrdpool, MAX(nthreads, 1)) );
 
-   _threadnumber = nthreads;
-   /* halt while all threads are not active TODO: is synchronization required here ? */
-   /*TODO: this caused a deadlock, is it important to wait for all threads to start?
-    * while( (*thrdpool)->currworkingthreads != nthreads )
-   {}*/
+   _threadnumber = (*thrdpool)->nthreads;
 
    return SCIP_OKAY;
 }
 
-/** adding a job to the job queue.
- *
- *  This gives some more flexibility in the handling of new jobs.
- *  This function needs to be called from within a mutex.
- */
+/** returns the bucket of the hash table of job groups for the given job id */
+static
+SCIP_JOBGROUPBUCKET* threadPoolGetGroupBucket(
+   SCIP_THREADPOOL*      thrdpool,           /**< the thread pool */
+   int                   jobid               /**< the job id */
+   )
+{
+   return &thrdpool->groups[(unsigned int)jobid & (TPI_NGROUPBUCKETS - 1)];
+}
+
+/** returns the group of the given job id; a new group is created if none exists and create is TRUE */
 static
-void jobQueueAddJob(
-   SCIP_THREADPOOL*      threadpool,         /**< pointer to store threadpool */
-   SCIP_JOB*             newjob              /**< pointer to new job */
+SCIP_RETCODE threadPoolGetJobGroup(
+   SCIP_THREADPOOL*      thrdpool,           /**< the thread pool */
+   int                   jobid,              /**< the job id */
+   SCIP_Bool             create,             /**< should the group be created if it does not exist? */
+   SCIP_JOBGROUP**       group               /**< pointer to store the group, or NULL if it does not exist */
    )
 {
-   /* @todo we want to work out what to do with a full job queue. Is there a problem if the limit is hit? */
-   /* @note it is important to have a queuesize. This will stop the code submitting infinitely many jobs. */
-   assert(threadpool->jobqueue->njobs < threadpool->queuesize);
+   SCIP_JOBGROUPBUCKET* bucket;
+
+   bucket = threadPoolGetGroupBucket(thrdpool, jobid);
 
-   newjob->nextjob = NULL;
+   SCIP_CALL( SCIPtnyAcquireLock(&bucket->lock) );
 
-   /* checking the status of the job queue */
-   if( threadpool->jobqueue->njobs == 0 )
+   for( *group = bucket->groups; *group != NULL; *group = (*group)->nextgroup )
    {
-      threadpool->jobqueue->firstjob = newjob;
-      threadpool->jobqueue->lastjob = newjob;
+      if( (*group)->jobid == jobid )
+         break;
    }
-   else /* it is assumed that the jobqueue is not full */
+
+   if( *group == NULL && create )
    {
-      threadpool->jobqueue->lastjob->nextjob = newjob;
-      threadpool->jobqueue->lastjob = newjob;
+      SCIP_ALLOC( BMSallocMemory(group) );
+      (*group)->jobid = jobid;
+      (*group)->nunfinished = 0;
+      (*group)->retcode = SCIP_OKAY;
+      SCIP_CALL( SCIPtnyInitLock(&(*group)->lock) );
+      SCIP_CALL( SCIPtnyInitCondition(&(*group)->finished) );
+
+      (*group)->nextgroup = bucket->groups;
+      bucket->groups = *group;
    }
 
-   /* signalling to all threads that the queue has jobs using the signal instead of broadcast because only one thread
-    * should be awakened */
-   SCIP_CALL_ABORT( SCIPtnySignalCondition(&(threadpool->queuenotempty)) );
+   SCIP_CALL( SCIPtnyReleaseLock(&bucket->lock) );
 
-   threadpool->jobqueue->njobs++;
+   return SCIP_OKAY;
 }
 
-/** adds a job to the threadpool */
+/** removes a group from the hash table of uncollected groups of the pool and frees it */
 static
-SCIP_RETCODE threadPoolAddWork(
-   SCIP_JOB*             newjob,             /**< job to add to threadpool */
-   SCIP_SUBMITSTATUS*    status              /**< pointer to store the job's submit status */
+SCIP_RETCODE threadPoolFreeJobGroup(
+   SCIP_THREADPOOL*      thrdpool,           /**< the thread pool */
+   SCIP_JOBGROUP*        group               /**< the group to free */
    )
 {
-   assert(newjob != NULL);
-   assert(_threadpool != NULL);
+   SCIP_JOBGROUPBUCKET* bucket;
+   SCIP_JOBGROUP** prev;
 
-   SCIP_CALL( SCIPtnyAcquireLock(&(_threadpool->poollock)) );
-
-   /* if the queue is full and we are blocking, then return an error. */
-   if( _threadpool->jobqueue->njobs == _threadpool->queuesize && _threadpool->blockwhenfull )
-   {
-      SCIP_CALL( SCIPtnyReleaseLock(&(_threadpool->poollock)) );
-      *status = SCIP_SUBMIT_QUEUEFULL;
-      return SCIP_OKAY;
-   }
+   assert(group->nunfinished == 0);
 
-   /* Wait until the job queue is not full. If the queue is closed or the thread pool is shut down, then stop waiting. */
-   /* @todo this needs to be checked. It is possible that a job can be submitted and then the queue is closed or the
-    * thread pool is shut down. Need to work out the best way to handle this. */
-   while( _threadpool->jobqueue->njobs == _threadpool->queuesize && !(_threadpool->shutdown || !_threadpool->queueopen) )
-   {
-      SCIP_CALL( SCIPtnyWaitCondition(&(_threadpool->queuenotfull), &(_threadpool->poollock)) );
-   }
+   bucket = threadPoolGetGroupBucket(thrdpool, group->jobid);
 
-   /* if the thread pool is shut down or the queue is closed, then we need to leave the job submission */
-   if( !_threadpool->queueopen )
-   {
-      SCIP_CALL( SCIPtnyReleaseLock(&(_threadpool->poollock)) );
-      *status = SCIP_SUBMIT_QUEUECLOSED;
-      return SCIP_OKAY;
-   }
-   else if( _threadpool->shutdown )
-   {
-      SCIP_CALL( SCIPtnyReleaseLock(&(_threadpool->poollock)) );
-      *status =  SCIP_SUBMIT_SHUTDOWN;
-      return SCIP_OKAY;
-   }
+   SCIP_CALL( SCIPtnyAcquireLock(&bucket->lock) );
 
-   /* creating the job for submission */
-   newjob->nextjob = NULL;
+   for( prev = &bucket->groups; *prev != group; prev = &(*prev)->nextgroup )
+      assert(*prev != NULL);
 
-   /* adding the job to the queue */
-   /* this can only happen if the queue is not full */
-   assert(_threadpool->jobqueue->njobs != _threadpool->queuesize);
-   jobQueueAddJob(_threadpool, newjob);
+   *prev = group->nextgroup;
 
-   SCIP_CALL( SCIPtnyReleaseLock(&(_threadpool->poollock)) );
+   SCIP_CALL( SCIPtnyReleaseLock(&bucket->lock) );
 
-   *status = SCIP_SUBMIT_SUCCESS;
+   SCIPtnyDestroyCondition(&group->finished);
+   SCIPtnyDestroyLock(&group->lock);
+   BMSfreeMemory(&group);
 
    return SCIP_OKAY;
 }
 
-/** frees the jobqueue of the threadpool */
+/** adds a job to the threadpool
+ *
+ *  Jobs submitted by a thread of the pool are added to the deque of that thread, jobs submitted from outside the pool
+ *  are distributed over the deques in a round robin fashion.
+ */
 static
-void freeJobQueue(
-   SCIP_THREADPOOL*      thrdpool            /**< pointer to thread pool */
+SCIP_RETCODE threadPoolAddWork(
+   SCIP_JOB*             newjob,             /**< job to add to threadpool */
+   SCIP_SUBMITSTATUS*    status              /**< pointer to store the job's submit status */
    )
 {
-   SCIP_JOB* currjob;
+   SCIP_JOBDEQUE* deque;
+   SCIP_JOBGROUP* group;
+
+   assert(newjob != NULL);
+   assert(_threadpool != NULL);
 
-   assert(!thrdpool->queueopen);
-   assert(thrdpool->shutdown);
+   /* if the thread pool is shut down, then we need to leave the job submission */
+   if( SCIPtpiAtomicLoadInt(&_threadpool->shutdown) )
+   {
+      *status =  SCIP_SUBMIT_SHUTDOWN;
+      return SCIP_OKAY;
+   }
 
-   /* iterating through all jobs until all have been freed */
-   while( thrdpool->jobqueue->firstjob != NULL )
+   if( _threaddeque != NULL )
+      deque = _threaddeque;
+   else
    {
-      currjob = thrdpool->jobqueue->firstjob->nextjob;
-      thrdpool->jobqueue->firstjob = thrdpool->jobqueue->firstjob->nextjob;
-      BMSfreeMemory(&currjob);
+      unsigned int next;
+
+      next = (unsigned int) SCIPtpiAtomicFetchAddInt(&_threadpool->nextdeque, 1);
+      deque = &_threadpool->deques[next % (unsigned int) SCIPtpiAtomicLoadInt(&_threadpool->nthreads)];
    }
 
-   assert(thrdpool->jobqueue->firstjob == NULL);
-   assert(thrdpool->jobqueue->lastjob == NULL);
+   SCIP_CALL( threadPoolGetJobGroup(_threadpool, newjob->jobid, TRUE, &group) );
+   newjob->group = group;
+
+   /* the job has to be counted before it becomes visible to the other threads */
+   SCIP_CALL( SCIPtnyAcquireLock(&group->lock) );
+   ++group->nunfinished;
+   SCIP_CALL( SCIPtnyReleaseLock(&group->lock) );
+
+   SCIP_CALL( jobDequePush(deque, newjob, status) );
+
+   if( *status != SCIP_SUBMIT_SUCCESS )
+   {
+      SCIP_CALL( SCIPtnyAcquireLock(&group->lock) );
+      --group->nunfinished;
+      SCIP_CALL( SCIPtnyReleaseLock(&group->lock) );
+   }
+   else if( SCIPtpiAtomicLoadInt(&_threadpool->nidlethreads) > 0 )
+   {
+      /* only a single thread needs to be awakened; the others may steal from it */
+      SCIP_CALL( SCIPtnyAcquireLock(&(_threadpool->poollock)) );
+      SCIP_CALL( SCIPtnySignalCondition(&(_threadpool->worknotempty)) );
+      SCIP_CALL( SCIPtnyReleaseLock(&(_threadpool->poollock)) );
+   }
 
-   BMSfreeMemory(&thrdpool->jobqueue);
+   return SCIP_OKAY;
 }
 
-/** free the thread pool */
+/** free the thread pool
+ *
+ *  The threads process all remaining jobs before they terminate.
+ */
 static
 SCIP_RETCODE freeThreadPool(
-   SCIP_THREADPOOL**     thrdpool,           /**< pointer to thread pool */
-   SCIP_Bool             finishjobs,         /**< currently unused */
-   SCIP_Bool             completequeue       /**< Wait until the queue has complete? */
+   SCIP_THREADPOOL**     thrdpool            /**< pointer to thread pool */
    )
 {
-   int          i;
    SCIP_RETCODE retcode;
-
-   /*TODO remove argument? */
-   SCIP_UNUSED( finishjobs );
+   int nthreads;
+   int i;
 
    SCIP_CALL( SCIPtnyAcquireLock(&((*thrdpool)->poollock)) );
 
-   /* if the shutdown is already in progress, then we don't need to complete this function */
-   if( !(*thrdpool)->queueopen || (*thrdpool)->shutdown )
-   {
-      SCIP_CALL( SCIPtnyReleaseLock(&((*thrdpool)->poollock)) );
-
-      return SCIP_OKAY;
-   }
-
-   /* indicating that the job queue is now closed for new jobs */
-   (*thrdpool)->queueopen = FALSE;
-
-   /* if the jobs in the queue should be completed, then we wait until the queueempty condition is set */
-   if( completequeue )
-   {
-      while( (*thrdpool)->jobqueue->njobs > 0 )
-      {
-         SCIP_CALL( SCIPtnyWaitCondition(&((*thrdpool)->queueempty), &((*thrdpool)->poollock)) );
-      }
-   }
-
    /* indicating that the tpi has commenced the shutdown process */
-   (*thrdpool)->shutdown = TRUE;
+   SCIPtpiAtomicStoreInt(&(*thrdpool)->shutdown, TRUE);
 
-   SCIP_CALL( SCIPtnyReleaseLock(&((*thrdpool)->poollock)) );
+   /* waking up all threads so that they can check the shutdown condition */
+   SCIP_CALL( SCIPtnyBroadcastCondition(&((*thrdpool)->worknotempty)) );
 
-   /* waking up all threads so that they can check the shutdown condition;
-    * this requires that the conditions queuenotempty and queuenotfull is broadcast
-    */
-   SCIP_CALL( SCIPtnyBroadcastCondition(&((*thrdpool)->queuenotempty)) );
-   SCIP_CALL( SCIPtnyBroadcastCondition(&((*thrdpool)->queuenotfull)) );
+   SCIP_CALL( SCIPtnyReleaseLock(&((*thrdpool)->poollock)) );
 
    retcode = SCIP_OKAY;
+   nthreads = (*thrdpool)->nthreads;
 
    /* calling a join to ensure that all worker finish before the thread pool is closed */
-   for( i = 0; i < (*thrdpool)->nthreads; i++ )
+   for( i = 0; i < nthreads; i++ )
    {
       int thrdretcode;
 
@@ -502,22 +733,21 @@ SCIP_RETCODE freeThreadPool(
          retcode = (SCIP_RETCODE) MIN(thrdretcode, (int)retcode);
    }
 
-   /* freeing memory and data structures */
-   BMSfreeMemoryArray(&(*thrdpool)->threads);
-
-   /* Freeing the current jobs list. This assumes that all jobs complete before the tpi is closed. */
-   assert((*thrdpool)->currentjobs->njobs == 0);
-   BMSfreeMemory(&(*thrdpool)->currentjobs);
-   assert((*thrdpool)->finishedjobs->njobs == 0);
-   BMSfreeMemory(&(*thrdpool)->finishedjobs);
+   /* freeing the groups whose jobs have not been collected */
+   for( i = 0; i < TPI_NGROUPBUCKETS; i++ )
+   {
+      while( (*thrdpool)->groups[i].groups != NULL )
+      {
+         SCIP_CALL( threadPoolFreeJobGroup(*thrdpool, (*thrdpool)->groups[i].groups) );
+      }
+      SCIPtnyDestroyLock(&(*thrdpool)->groups[i].lock);
+   }
 
-   freeJobQueue(*thrdpool);
+   for( i = 0; i < nthreads; i++ )
+      jobDequeFree(&(*thrdpool)->deques[i]);
 
    /* destroying the conditions */
-   SCIPtnyDestroyCondition(&(*thrdpool)->jobfinished);
-   SCIPtnyDestroyCondition(&(*thrdpool)->queueempty);
-   SCIPtnyDestroyCondition(&(*thrdpool)->queuenotfull);
-   SCIPtnyDestroyCondition(&(*thrdpool)->queuenotempty);
+   SCIPtnyDestroyCondition(&(*thrdpool)->worknotempty);
 
    /* destroying the mutex */
    SCIPtnyDestroyLock(&(*thrdpool)->poollock);
@@ -527,77 +757,84 @@ SCIP_RETCODE freeThreadPool(
    return retcode;
 }
 
-
-/* checking a job queue */
+/** initializes the lock protecting the creation, growth, and destruction of the thread pool */
 static
-SCIP_JOBSTATUS checkJobQueue(
-   SCIP_JOBQUEUE*        jobqueue,           /**< pointer to the job queue */
-   int                   jobid               /**< id of job to check */
+void initInitLock(
+   void
    )
 {
-   SCIP_JOB* currjob = jobqueue->firstjob;
-
-   /* checking the job ids */
-   if( currjob != NULL )
-   {
-      while( currjob != jobqueue->lastjob )
-      {
-         if( currjob->jobid == jobid )
-            return SCIP_JOB_INQUEUE;
-
-         currjob = currjob->nextjob;
-      }
-
-      if( currjob->jobid == jobid )
-         return SCIP_JOB_INQUEUE;
-   }
-
-   return SCIP_JOB_DOESNOTEXIST;
+   (void) mtx_init(&_initlock, mtx_plain);
 }
 
-/** returns whether the job id is running */
-static
-SCIP_Bool isJobRunning(
-   SCIP_JOBQUEUE*        currentjobs,        /**< queue of current jobs */
-   int                   jobid               /**< id of job to check */
+/** returns the number of threads */
+int SCIPtpiGetNumThreads(
+   void
    )
 {
-   if( checkJobQueue(currentjobs, jobid) == SCIP_JOB_INQUEUE )
-      return TRUE;
-   else
-      return FALSE;
+   return SCIPtpiAtomicLoadInt(&_threadpool->nthreads);
 }
 
-/** returns the number of threads */
-int SCIPtpiGetNumThreads(
+/** returns whether the tpi is able to process jobs in parallel */
+SCIP_Bool SCIPtpiIsAvailable(
    void
    )
 {
-   return _threadpool->nthreads;
+   return TRUE;
 }
 
-/** initializes tpi */
+/** initializes tpi
+ *
+ *  If the tpi has already been initialized, the existing threads are shared and only the number of references is
+ *  increased; if more threads are requested than the pool has, the pool is enlarged.
+ */
 SCIP_RETCODE SCIPtpiInit(
    int                   nthreads,           /**< the number of threads to be used */
    int                   queuesize,          /**< the size of the queue */
    SCIP_Bool             blockwhenfull       /**< should the queue block when full */
    )
 {
-   assert(_threadpool == NULL);
-   SCIP_CALL( createThreadPool(&_threadpool, nthreads, queuesize, blockwhenfull) );
-   return SCIP_OKAY;
+   SCIP_RETCODE retcode;
+
+   call_once(&_initonce, initInitLock);
+
+   SCIP_CALL( SCIPtnyAcquireLock(&_initlock) );
+
+   if( _threadpool != NULL )
+   {
+      ++_threadpool->nreferences;
+      retcode = threadPoolGrow(_threadpool, nthreads);
+   }
+   else
+      retcode = createThreadPool(&_threadpool, nthreads, queuesize, blockwhenfull);
+
+   SCIP_CALL( SCIPtnyReleaseLock(&_initlock) );
+
+   return retcode;
 }
 
-/** deinitializes tpi */
+/** deinitializes tpi
+ *
+ *  The threads are shut down when the last reference to the tpi is released.
+ */
 SCIP_RETCODE SCIPtpiExit(
    void
    )
 {
+   SCIP_RETCODE retcode = SCIP_OKAY;
+
    assert(_threadpool != NULL);
 
-   SCIP_CALL( freeThreadPool(&_threadpool, TRUE, TRUE) );
+   SCIP_CALL( SCIPtnyAcquireLock(&_initlock) );
 
-   return SCIP_OKAY;
+   if( --_threadpool->nreferences == 0 )
+   {
+      retcode = freeThreadPool(&_threadpool);
+      _threadpool = NULL;
+   }
+
+   SCIP_CALL( SCIPtnyReleaseLock(&_initlock) );
+
+   return retcode;
 }
 
 /** creates a job for parallel processing */
@@ -613,7 +850,7 @@ SCIP_RETCODE SCIPtpiCreateJob(
    (*job)->jobid = jobid;
    (*job)->jobfunc = jobfunc;
    (*job)->args = jobarg;
-   (*job)->nextjob = NULL;
+   (*job)->group = NULL;
 
    return SCIP_OKAY;
 }
@@ -623,17 +860,15 @@ int SCIPtpiGetNewJobID(
    void
    )
 {
-   int id;
    assert(_threadpool != NULL);
 
-   SCIP_CALL_ABORT( SCIPtnyAcquireLock(&_threadpool->poollock) );
-   id = ++_threadpool->currentid;
-   SCIP_CALL_ABORT( SCIPtnyReleaseLock(&_threadpool->poollock) );
-
-   return id;
+   return SCIPtpiAtomicFetchAddInt(&_threadpool->currentid, 1) + 1;
 }
 
-/** submit a job for parallel processing; the return value is a globally defined status */
+/** submit a job for parallel processing; the return value is a globally defined status
+ *
+ *  Jobs may be submitted from within other jobs; such nested jobs are queued on the submitting thread.
+ */
 SCIP_RETCODE SCIPtpiSubmitJob(
    SCIP_JOB*             job,                /**< pointer to the job to be submitted */
    SCIP_SUBMITSTATUS*    status              /**< pointer to store the job's submit status */
@@ -642,7 +877,7 @@ SCIP_RETCODE SCIPtpiSubmitJob(
    assert(job != NULL);
 
    /* the job id must be set before submitting the job. The submitter controls whether a new id is required. */
-   assert(job->jobid == _threadpool->currentid);
+   assert(job->jobid > 0);
    SCIP_CALL( threadPoolAddWork(job, status) );
 
    return SCIP_OKAY;
@@ -650,68 +885,54 @@ SCIP_RETCODE SCIPtpiSubmitJob(
 
 /** blocks until all jobs of the given jobid have finished
  *  and then returns the smallest SCIP_RETCODE of all the jobs
+ *
+ *  If called by a thread of the pool, e.g., from within a job, the calling thread processes queued jobs while waiting,
+ *  such that nested jobs cannot deadlock the pool.
  */
 SCIP_RETCODE SCIPtpiCollectJobs(
    int                   jobid               /**< the jobid of the jobs to wait for */
    )
 {
    SCIP_RETCODE retcode;
-   SCIP_JOB* currjob;
-   SCIP_JOB* prevjob;
+   SCIP_JOBGROUP* group;
 
-   SCIP_CALL( SCIPtnyAcquireLock(&(_threadpool->poollock)) );
+   SCIP_CALL( threadPoolGetJobGroup(_threadpool, jobid, FALSE, &group) );
 
-   while( isJobRunning(_threadpool->currentjobs, jobid) || isJobRunning(_threadpool->jobqueue, jobid) )
-   {
-      SCIP_CALL( SCIPtnyWaitCondition(&_threadpool->jobfinished, &_threadpool->poollock) );
-   }
+   /* no job with this id has been submitted */
+   if( group == NULL )
+      return SCIP_OKAY;
 
-   /* finding the location of the processed job in the currentjobs queue */
-   retcode = SCIP_OKAY;
-   currjob = _threadpool->finishedjobs->firstjob;
-   prevjob = NULL;
+   SCIP_CALL( SCIPtnyAcquireLock(&group->lock) );
 
-   while( currjob )
+   while( group->nunfinished > 0 )
    {
-      if( currjob->jobid == jobid )
-      {
-         SCIP_JOB* nextjob;
+      SCIP_JOB* job = NULL;
 
-         /* if the job has the right jobid collect its retcode,
-          * remove it from the finished job list, and free it
-          */
-         retcode = MIN(retcode, currjob->retcode);
+      if( _threaddeque != NULL )
+      {
+         SCIP_CALL( SCIPtnyReleaseLock(&group->lock) );
+         job = threadPoolFindJob(_threadpool, _threaddeque);
 
-         /* removing the finished job from finished jobs list */
-         if( currjob == _threadpool->finishedjobs->firstjob )
-         {
-            _threadpool->finishedjobs->firstjob = currjob->nextjob;
-         }
-         else
+         if( job != NULL )
          {
-            assert(prevjob != NULL);
-            prevjob->nextjob = currjob->nextjob;
+            SCIP_CALL( threadPoolExecuteJob(job) );
          }
 
-         if( currjob == _threadpool->finishedjobs->lastjob )
-            _threadpool->finishedjobs->lastjob = prevjob;
-
-         _threadpool->finishedjobs->njobs--;
-
-         /* update currjob and free finished job; prevjob stays the same */
-         nextjob = currjob->nextjob;
-         BMSfreeMemory(&currjob);
-         currjob = nextjob;
+         SCIP_CALL( SCIPtnyAcquireLock(&group->lock) );
       }
-      else
+
+      /* all remaining jobs of the group are running on other threads */
+      if( job == NULL && group->nunfinished > 0 )
       {
-         /* otherwise leave job untouched */
-         prevjob = currjob;
-         currjob = prevjob->nextjob;
+         SCIP_CALL( SCIPtnyWaitCondition(&group->finished, &group->lock) );
       }
    }
 
-   SCIP_CALL( SCIPtnyReleaseLock(&_threadpool->poollock) );
+   retcode = group->retcode;
+
+   SCIP_CALL( SCIPtnyReleaseLock(&group->lock) );
+
+   SCIP_CALL( threadPoolFreeJobGroup(_threadpool, group) );
 
    return retcode;
 }
@@ -832,6 +1053,82 @@ SCIP_RETCODE SCIPtpiWaitCondition(
    return SCIP_ERROR;
 }
 
+
+
+/*
+ * atomic operations
+ */
+
+#if !defined(__GNUC__) && !defined(_MSC_VER)
+/* without compiler support, the atomic operations are protected by a global lock */
+static once_flag _atomiconce = ONCE_FLAG_INIT;
+static mtx_t _atomiclock;
+
+/** initializes the global lock for the atomic operations */
+static
+void initAtomicLock(
+   void
+   )
+{
+   (void) mtx_init(&_atomiclock, mtx_plain);
+}
+#endif
+
+/** atomically adds the given increment to an integer and returns the previous value */
+int SCIPtpiAtomicFetchAddInt(
+   int*                  value,              /**< the integer to modify */
+   int                   increment           /**< the increment */
+   )
+{
+#if defined(__GNUC__)
+   return __atomic_fetch_add(value, increment, __ATOMIC_ACQ_REL);
+#elif defined(_MSC_VER)
+   return (int) _InterlockedExchangeAdd((volatile long*) value, (long) increment);
+#else
+   int oldvalue;
+
+   call_once(&_atomiconce, initAtomicLock);
+   (void) mtx_lock(&_atomiclock);
+   oldvalue = *value;
+   *value += increment;
+   (void) mtx_unlock(&_atomiclock);
+
+   return oldvalue;
+#endif
+}
+
+/** atomically reads an integer that is modified by other threads */
+int SCIPtpiAtomicLoadInt(
+   int*                  value               /**< the integer to read */
+   )
+{
+#if defined(__GNUC__)
+   return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+#elif defined(_MSC_VER)
+   return (int) _InterlockedOr((volatile long*) value, 0L);
+#else
+   return SCIPtpiAtomicFetchAddInt(value, 0);
+#endif
+}
+
+/** atomically writes an integer that is read by other threads */
+void SCIPtpiAtomicStoreInt(
+   int*                  value,              /**< the integer to write */
+   int                   newvalue            /**< the new value */
+   )
+{
+#if defined(__GNUC__)
+   __atomic_store_n(value, newvalue, __ATOMIC_RELEASE);
+#elif defined(_MSC_VER)
+   (void) _InterlockedExchange((volatile long*) value, (long) newvalue);
+#else
+   call_once(&_atomiconce, initAtomicLock);
+   (void) mtx_lock(&_atomiclock);
+   *value = newvalue;
+   (void) mtx_unlock(&_atomiclock);
+#endif
+}
+
 /** returns the thread number */
 int SCIPtpiGetThreadNum(
    void
@@ -0,0 +1,114 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2023 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   sbnthreads.c
+ * @brief  unit test checking that full strong branching makes the same decisions for any number of threads
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <string.h>
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+#include "tpi/tpi.h"
+#include "include/scip_test.h"
+
+/** results of a solve that depend on the branching decisions */
+typedef struct SolveResult
+{
+   SCIP_Longint          nnodes;             /**< number of processed nodes */
+   SCIP_Longint          ncutoffs;           /**< number of cutoffs found by the branching rule */
+   SCIP_Longint          ndomreds;           /**< number of domain reductions found by the branching rule */
+   SCIP_Longint          nchildren;          /**< number of children created by the branching rule */
+   SCIP_Real             primalbound;        /**< primal bound */
+   SCIP_Real             dualbound;          /**< dual bound */
+} SOLVERESULT;
+
+/** solves the instance with full strong branching using the given number of threads */
+static
+SCIP_RETCODE solveFullstrong(
+   int                   sbnthreads,         /**< number of threads used to evaluate strong branching candidates */
+   SOLVERESULT*          result              /**< pointer to store the results of the solve */
+   )
+{
+   SCIP* scip;
+   SCIP_BRANCHRULE* branchrule;
+   char testfile[SCIP_MAXSTRLEN];
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+
+   strcpy(testfile, __FILE__);
+   testfile[strlen(testfile) - 12] = '\0';  /* cutoff "sbnthreads.c" */
+   strcat(testfile, "../../../check/instances/MIP/lseu.mps");
+   SCIP_CALL( SCIPreadProb(scip, testfile, NULL) );
+
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+   SCIP_CALL( SCIPsetIntParam(scip, "branching/fullstrong/priority", 1000000) );
+   SCIP_CALL( SCIPsetIntParam(scip, "parallel/mode", 1) );
+   SCIP_CALL( SCIPsetIntParam(scip, "parallel/maxnthreads", sbnthreads) );
+   SCIP_CALL( SCIPsetIntParam(scip, "branching/sbnthreads", sbnthreads) );
+   SCIP_CALL( SCIPsetLongintParam(scip, "limits/nodes", 200LL) );
+
+   SCIP_CALL( SCIPsolve(scip) );
+
+   branchrule = SCIPfindBranchrule(scip, "fullstrong");
+   cr_assert_not_null(branchrule);
+
+   result->nnodes = SCIPgetNNodes(scip);
+   result->ncutoffs = SCIPbranchruleGetNCutoffs(branchrule);
+   result->ndomreds = SCIPbranchruleGetNDomredsFound(branchrule);
+   result->nchildren = SCIPbranchruleGetNChildren(branchrule);
+   result->primalbound = SCIPgetPrimalbound(scip);
+   result->dualbound = SCIPgetDualbound(scip);
+
+   SCIP_CALL( SCIPfree(&scip) );
+
+   return SCIP_OKAY;
+}
+
+/* TESTS */
+
+/** checks that the candidate selection, cutoffs, domain reductions, and bounds do not depend on the number of threads */
+Test(sbnthreads, fullstrong)
+{
+   SOLVERESULT sequential;
+   SOLVERESULT parallel;
+
+   if( !SCIPtpiIsAvailable() )
+      return;
+
+   SCIP_CALL( solveFullstrong(1, &sequential) );
+   SCIP_CALL( solveFullstrong(4, &parallel) );
+
+   cr_assert_eq(parallel.nnodes, sequential.nnodes);
+   cr_assert_eq(parallel.ncutoffs, sequential.ncutoffs);
+   cr_assert_eq(parallel.ndomreds, sequential.ndomreds);
+   cr_assert_eq(parallel.nchildren, sequential.nchildren);
+   cr_assert_float_eq(parallel.primalbound, sequential.primalbound, 1e-6);
+   cr_assert_float_eq(parallel.dualbound, sequential.dualbound, 1e-6);
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
@@ -0,0 +1,129 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2023 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   alns.c
+ * @brief  unit test running several ALNS neighborhoods in parallel
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <string.h>
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+#include "tpi/tpi.h"
+#include "include/scip_test.h"
+
+static SCIP* scip;
+
+/** setup of test run */
+static
+void setup(void)
+{
+   char testfile[SCIP_MAXSTRLEN];
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+
+   strcpy(testfile, __FILE__);
+   testfile[strlen(testfile) - 6] = '\0';  /* cutoff "alns.c" */
+   strcat(testfile, "../../../check/instances/MIP/p0548.mps");
+   SCIP_CALL( SCIPreadProb(scip, testfile, NULL) );
+
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+
+   /* call ALNS at every node of the first levels */
+   SCIP_CALL( SCIPsetIntParam(scip, "heuristics/alns/freq", 1) );
+   SCIP_CALL( SCIPsetIntParam(scip, "heuristics/alns/freqofs", 0) );
+   SCIP_CALL( SCIPsetIntParam(scip, "heuristics/alns/maxdepth", 5) );
+   SCIP_CALL( SCIPsetLongintParam(scip, "limits/nodes", 50LL) );
+}
+
+/** deinitialization method */
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+/** solves the instance with the given number of threads for ALNS and checks the solutions that were found */
+static
+SCIP_RETCODE solveAlns(
+   int                   nthreads,           /**< number of threads to run neighborhoods in parallel */
+   int                   parallelmode        /**< parallel mode (0: opportunistic, 1: deterministic) */
+   )
+{
+   SCIP_HEUR* heur;
+   SCIP_SOL** sols;
+   int nsols;
+   int s;
+
+   SCIP_CALL( SCIPsetIntParam(scip, "parallel/mode", parallelmode) );
+   SCIP_CALL( SCIPsetIntParam(scip, "parallel/maxnthreads", nthreads) );
+   SCIP_CALL( SCIPsetIntParam(scip, "heuristics/alns/nthreads", nthreads) );
+
+   SCIP_CALL( SCIPsolve(scip) );
+
+   heur = SCIPfindHeur(scip, "alns");
+   cr_assert_not_null(heur);
+   cr_assert_gt(SCIPheurGetNCalls(heur), 0);
+
+   /* all solutions, in particular the ones transferred from the parallel sub-SCIPs, have to be feasible */
+   sols = SCIPgetSols(scip);
+   nsols = SCIPgetNSols(scip);
+
+   for( s = 0; s < nsols; ++s )
+   {
+      SCIP_Bool feasible;
+
+      SCIP_CALL( SCIPcheckSolOrig(scip, sols[s], &feasible, FALSE, FALSE) );
+      cr_assert(feasible);
+   }
+
+   return SCIP_OKAY;
+}
+
+TestSuite(alns, .init = setup, .fini = teardown);
+
+/* TESTS */
+
+/** runs several neighborhoods in parallel in deterministic mode */
+Test(alns, deterministic)
+{
+   if( !SCIPtpiIsAvailable() )
+      return;
+
+   SCIP_CALL( solveAlns(4, 1) );
+}
+
+/** runs several neighborhoods in parallel in opportunistic mode, where the remaining runs are interrupted */
+Test(alns, opportunistic)
+{
+   if( !SCIPtpiIsAvailable() )
+      return;
+
+   SCIP_CALL( solveAlns(4, 0) );
+}
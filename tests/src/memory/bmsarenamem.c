@@ -0,0 +1,149 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2023 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   bmsarenamem.c
+ * @brief  unit test for BMS arena memory
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <string.h>
+
+#include "blockmemshell/memory.h"
+#include "include/scip_test.h"
+
+#define BLOCKSIZE   1024   /* initial size of the memory blocks of the arena */
+#define NELEMS      1000   /* number of objects allocated in each round */
+
+/* global variables */
+static BMS_ARENAMEM* arena;
+
+/** setup of test run */
+static
+void setup(void)
+{
+   arena = BMScreateArenaMemory(BLOCKSIZE);
+   cr_assert_not_null(arena);
+}
+
+/** deinitialization method */
+static
+void teardown(void)
+{
+   BMSdestroyArenaMemory(&arena);
+   cr_assert_null(arena);
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(bmsarenamem, .init = setup, .fini = teardown);
+
+/* TESTS */
+
+/** allocates objects of different sizes and checks that they are aligned and do not overlap */
+Test(bmsarenamem, alloc)
+{
+   char* objs[NELEMS];
+   int i;
+
+   for( i = 0; i < NELEMS; ++i )
+   {
+      size_t size = (size_t) (1 + (i * 37) % 200);
+
+      BMSallocArenaMemorySize(arena, &objs[i], size);
+      cr_assert_not_null(objs[i]);
+      cr_assert_eq(((size_t) objs[i]) % sizeof(double), 0, "object %d is not aligned", i);
+
+      memset(objs[i], i % 128, size);
+   }
+
+   for( i = 0; i < NELEMS; ++i )
+   {
+      size_t size = (size_t) (1 + (i * 37) % 200);
+      size_t j;
+
+      for( j = 0; j < size; ++j )
+         cr_assert_eq(objs[i][j], i % 128, "object %d was overwritten", i);
+   }
+
+   /* objects larger than a block get their own block */
+   BMSallocArenaMemorySize(arena, &objs[0], 10 * BLOCKSIZE);
+   cr_assert_not_null(objs[0]);
+   memset(objs[0], 0, 10 * BLOCKSIZE);
+}
+
+/** checks that arrays are cleared and duplicated correctly */
+Test(bmsarenamem, arrays)
+{
+   double source[100];
+   double* copy;
+   int* clean;
+   int i;
+
+   for( i = 0; i < 100; ++i )
+      source[i] = 0.5 * i;
+
+   BMSduplicateArenaMemoryArray(arena, &copy, source, 100);
+   cr_assert_not_null(copy);
+
+   BMSallocClearArenaMemoryArray(arena, &clean, 100);
+   cr_assert_not_null(clean);
+
+   for( i = 0; i < 100; ++i )
+   {
+      cr_assert_eq(copy[i], 0.5 * i);
+      cr_assert_eq(clean[i], 0);
+   }
+}
+
+/** checks that clearing the arena keeps a single block that fits all objects of the previous round */
+Test(bmsarenamem, clear)
+{
+   long long used;
+   int round;
+
+   for( round = 0; round < 5; ++round )
+   {
+      long long* objs;
+      int i;
+
+      for( i = 0; i < NELEMS; ++i )
+      {
+         BMSallocArenaMemoryArray(arena, &objs, 4);
+         cr_assert_not_null(objs);
+         objs[3] = i;
+      }
+
+      used = BMSgetArenaMemoryUsed(arena);
+      cr_assert_geq(used, NELEMS * 4 * (long long) sizeof(long long));
+
+      BMSclearArenaMemory(arena);
+
+      /* after the first round, all objects fit into the block that is kept, such that the arena does not grow */
+      if( round > 0 )
+         cr_assert_eq(BMSgetArenaMemoryUsed(arena), used);
+      else
+         cr_assert_leq(BMSgetArenaMemoryUsed(arena), used);
+   }
+}
@@ -0,0 +1,241 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2023 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   bmschunkpool.c
+ * @brief  unit tests and allocation benchmarks for the chunk pool shared by all block memories
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <time.h>
+
+#include "blockmemshell/memory.h"
+#include "include/scip_test.h"
+
+#define NELEMS      10000    /* number of elements allocated in each block memory */
+#define NROUNDS       200    /* number of block memories created one after the other in the benchmarks */
+
+/** allocates elements of different sizes in the given block memory and frees them again in a different order */
+static
+void allocFreeElements(
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   void**                elems,              /**< array to store the elements */
+   int                   nelems              /**< number of elements */
+   )
+{
+   int i;
+
+   for( i = 0; i < nelems; ++i )
+   {
+      BMSallocBlockMemorySize(blkmem, &elems[i], 8 * (1 + i % 16));
+      cr_assert_not_null(elems[i]);
+   }
+
+   /* free every second element first, so that the chunks are only released by the garbage collection */
+   for( i = 0; i < nelems; i += 2 )
+      BMSfreeBlockMemorySize(blkmem, &elems[i], 8 * (1 + i % 16));
+   for( i = 1; i < nelems; i += 2 )
+      BMSfreeBlockMemorySize(blkmem, &elems[i], 8 * (1 + i % 16));
+}
+
+/** creates and destroys block memories, as done for sub-SCIPs, and returns the elapsed time in seconds */
+static
+double runBlockMemoryRounds(
+   int                   nrounds             /**< number of block memories to create */
+   )
+{
+   void** elems;
+   clock_t start;
+   int r;
+
+   BMSallocMemoryArray(&elems, NELEMS);
+   cr_assert_not_null(elems);
+
+   start = clock();
+   for( r = 0; r < nrounds; ++r )
+   {
+      BMS_BLKMEM* blkmem;
+
+      blkmem = BMScreateBlockMemory(1, 10);
+      cr_assert_not_null(blkmem);
+
+      allocFreeElements(blkmem, elems, NELEMS);
+      cr_assert_eq(BMSgetBlockMemoryUsed(blkmem), 0, "There is a memory leak!");
+
+      BMSdestroyBlockMemory(&blkmem);
+   }
+
+   BMSfreeMemoryArray(&elems);
+
+   return (double) (clock() - start) / CLOCKS_PER_SEC;
+}
+
+/* chunk block that lives during the whole test, like the block memory of a main SCIP instance, since the chunk pool is
+ * freed when the last chunk block is destroyed
+ */
+static BMS_CHKMEM* mainchkmem = NULL;
+
+/** setup of test run */
+static
+void setup(void)
+{
+   mainchkmem = BMScreateChunkMemory(sizeof(double), 10, -1);
+   cr_assert_not_null(mainchkmem);
+
+   BMSclearChunkPool();
+   BMSsetChunkPoolMaxSize(32LL << 20);
+}
+
+/** deinitialization method */
+static
+void teardown(void)
+{
+   BMSdestroyChunkMemory(&mainchkmem);
+
+   /* destroying the last chunk block frees the pool */
+   cr_assert_eq(BMSgetChunkPoolSize(), 0);
+}
+
+TestSuite(bmschunkpool, .init = setup, .fini = teardown);
+
+/* TESTS */
+
+/** chunks of a destroyed block memory are kept in the pool and reused by the next block memory */
+Test(bmschunkpool, reuse)
+{
+   BMS_BLKMEM* blkmem;
+   void* elems[NELEMS];
+   long long poolsize;
+   int i;
+
+   /* nothing is pooled if the pool is compiled out */
+   if( !BMSisChunkPoolEnabled() )
+      return;
+
+   blkmem = BMScreateBlockMemory(1, 10);
+   allocFreeElements(blkmem, elems, NELEMS);
+   BMSdestroyBlockMemory(&blkmem);
+
+   poolsize = BMSgetChunkPoolSize();
+   cr_assert_gt(poolsize, 0, "destroyed chunks were not pooled");
+
+   /* the same allocations in a new block memory take all chunks from the pool */
+   blkmem = BMScreateBlockMemory(1, 10);
+   for( i = 0; i < NELEMS; ++i )
+      BMSallocBlockMemorySize(blkmem, &elems[i], 8 * (1 + i % 16));
+
+   cr_assert_eq(BMSgetChunkPoolSize(), 0, "chunks were allocated although the pool contained chunks of the same size");
+
+   for( i = 0; i < NELEMS; ++i )
+      BMSfreeBlockMemorySize(blkmem, &elems[i], 8 * (1 + i % 16));
+   BMSdestroyBlockMemory(&blkmem);
+
+   cr_assert_eq(BMSgetChunkPoolSize(), poolsize);
+}
+
+/** chunks are kept while some chunk block exists and are freed with the last chunk block */
+Test(bmschunkpool, release)
+{
+   BMS_BLKMEM* blkmem;
+   void* elems[NELEMS];
+
+   if( !BMSisChunkPoolEnabled() )
+      return;
+
+   blkmem = BMScreateBlockMemory(1, 10);
+   allocFreeElements(blkmem, elems, NELEMS);
+   BMSdestroyBlockMemory(&blkmem);
+
+   cr_assert_gt(BMSgetChunkPoolSize(), 0, "destroyed chunks were not pooled");
+
+   BMSdestroyChunkMemory(&mainchkmem);
+   cr_assert_eq(BMSgetChunkPoolSize(), 0, "pool was not freed with the last chunk block");
+
+   /* recreate the chunk block for the teardown */
+   mainchkmem = BMScreateChunkMemory(sizeof(double), 10, -1);
+   cr_assert_not_null(mainchkmem);
+}
+
+/** the pool does not grow beyond its maximal size */
+Test(bmschunkpool, maxsize)
+{
+   BMS_BLKMEM* blkmem;
+   void* elems[NELEMS];
+
+   BMSsetChunkPoolMaxSize(0LL);
+
+   blkmem = BMScreateBlockMemory(1, 10);
+   allocFreeElements(blkmem, elems, NELEMS);
+   BMSdestroyBlockMemory(&blkmem);
+
+   cr_assert_eq(BMSgetChunkPoolSize(), 0);
+
+   BMSsetChunkPoolMaxSize(4096LL);
+
+   blkmem = BMScreateBlockMemory(1, 10);
+   allocFreeElements(blkmem, elems, NELEMS);
+   BMSdestroyBlockMemory(&blkmem);
+
+   cr_assert_leq(BMSgetChunkPoolSize(), 4096LL);
+}
+
+/** benchmark: many short-lived block memories with and without the chunk pool */
+Test(bmschunkpool, benchmark_blockmemories)
+{
+   double timenopool;
+   double timepool;
+
+   BMSsetChunkPoolMaxSize(0LL);
+   timenopool = runBlockMemoryRounds(NROUNDS);
+
+   BMSsetChunkPoolMaxSize(32LL << 20);
+   timepool = runBlockMemoryRounds(NROUNDS);
+
+   cr_log_info("%d block memories with %d allocations each: %.3fs without chunk pool, %.3fs with chunk pool\n",
+      NROUNDS, NELEMS, timenopool, timepool);
+}
+
+/** benchmark: allocation-heavy work in a single long-lived block memory with repeated garbage collection */
+Test(bmschunkpool, benchmark_garbagecollection)
+{
+   BMS_BLKMEM* blkmem;
+   void* elems[NELEMS];
+   clock_t start;
+   int r;
+
+   blkmem = BMScreateBlockMemory(1, 10);
+
+   start = clock();
+   for( r = 0; r < NROUNDS; ++r )
+   {
+      allocFreeElements(blkmem, elems, NELEMS);
+      BMSgarbagecollectBlockMemory(blkmem);
+   }
+
+   cr_log_info("%d rounds of %d allocations with garbage collection: %.3fs\n", NROUNDS, NELEMS,
+      (double) (clock() - start) / CLOCKS_PER_SEC);
+
+   cr_assert_eq(BMSgetBlockMemoryUsed(blkmem), 0, "There is a memory leak!");
+   BMSdestroyBlockMemory(&blkmem);
+}
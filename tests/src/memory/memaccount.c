@@ -0,0 +1,185 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2023 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+
+/**@file   memaccount.c
+ * @brief  unit tests for the memory usage per source file and per owner
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <string.h>
+
+#include "blockmemshell/memory.h"
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+#include "include/scip_test.h"
+
+#define NELEMS      100    /* number of arrays allocated in block memory */
+
+/* global variables */
+static BMS_MEMACCOUNT* account;
+
+/** setup of test run */
+static
+void setup(void)
+{
+   account = BMScreateMemoryAccount();
+   cr_assert_not_null(account);
+}
+
+/** deinitialization method */
+static
+void teardown(void)
+{
+   BMSdestroyMemoryAccount(&account);
+   cr_assert_null(account);
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(memaccount, .init = setup, .fini = teardown);
+
+/* TESTS */
+
+/** checks that allocations and frees in block memory are recorded for this file */
+Test(memaccount, blockmem)
+{
+   BMS_BLKMEM* blkmem;
+   double* arrays[NELEMS];
+   int i;
+
+   blkmem = BMScreateBlockMemory(1, 10);
+   cr_assert_not_null(blkmem);
+
+   /* allocations before attaching the account are not recorded */
+   BMSallocBlockMemoryArray(blkmem, &arrays[0], 8);
+   BMSfreeBlockMemoryArray(blkmem, &arrays[0], 8);
+   cr_assert_eq(BMSgetMemoryAccountNFiles(account), 0);
+
+   BMSsetBlockMemoryAccount(blkmem, account);
+
+   for( i = 0; i < NELEMS; ++i )
+   {
+      BMSallocBlockMemoryArray(blkmem, &arrays[i], 8);
+      cr_assert_not_null(arrays[i]);
+   }
+
+   cr_assert_eq(BMSgetMemoryAccountNFiles(account), 1);
+   cr_assert_not_null(strstr(BMSgetMemoryAccountFile(account, 0), "memaccount"));
+   cr_assert_eq(BMSgetMemoryAccountUsed(account, 0), NELEMS * 8 * (long long)sizeof(double));
+   cr_assert_eq(BMSgetMemoryAccountUsed(account, 0), BMSgetBlockMemoryUsed(blkmem));
+
+   /* reallocations are recorded as well */
+   BMSreallocBlockMemoryArray(blkmem, &arrays[0], 8, 16);
+   cr_assert_eq(BMSgetMemoryAccountUsed(account, 0), (NELEMS + 1) * 8 * (long long)sizeof(double));
+
+   BMSfreeBlockMemoryArray(blkmem, &arrays[0], 16);
+   for( i = 1; i < NELEMS; ++i )
+      BMSfreeBlockMemoryArray(blkmem, &arrays[i], 8);
+
+   /* the peak was reached during the reallocation, which allocates the new array before freeing the old one */
+   cr_assert_eq(BMSgetMemoryAccountUsed(account, 0), 0);
+   cr_assert_eq(BMSgetMemoryAccountUsedMax(account, 0), (NELEMS + 2) * 8 * (long long)sizeof(double));
+
+   BMSclearMemoryAccount(account);
+   cr_assert_eq(BMSgetMemoryAccountUsedMax(account, 0), 0);
+
+   BMSsetBlockMemoryAccount(blkmem, NULL);
+   BMSdestroyBlockMemory(&blkmem);
+}
+
+/** checks that the sizes of the buffers in use are recorded for this file */
+Test(memaccount, buffermem)
+{
+   BMS_BUFMEM* buffer;
+   int* array1;
+   int* array2;
+
+   buffer = BMScreateBufferMemory(1.2, 4, FALSE);
+   cr_assert_not_null(buffer);
+
+   BMSsetBufferMemoryAccount(buffer, account);
+
+   BMSallocBufferMemoryArray(buffer, &array1, 100);
+   BMSallocBufferMemoryArray(buffer, &array2, 10);
+   cr_assert_not_null(array1);
+   cr_assert_not_null(array2);
+
+#ifndef SCIP_NOBUFFERMEM
+   cr_assert_eq(BMSgetMemoryAccountNFiles(account), 1);
+   cr_assert_geq(BMSgetMemoryAccountUsed(account, 0), 110 * (long long)sizeof(int));
+   cr_assert_eq(BMSgetMemoryAccountUsed(account, 0), BMSgetBufferMemoryUsed(buffer));
+
+   BMSreallocBufferMemoryArray(buffer, &array2, 1000);
+   cr_assert_geq(BMSgetMemoryAccountUsed(account, 0), 1100 * (long long)sizeof(int));
+#endif
+
+   BMSfreeBufferMemoryArray(buffer, &array2);
+   BMSfreeBufferMemoryArray(buffer, &array1);
+
+#ifndef SCIP_NOBUFFERMEM
+   cr_assert_eq(BMSgetMemoryAccountUsed(account, 0), 0);
+   cr_assert_geq(BMSgetMemoryAccountUsedMax(account, 0), 1100 * (long long)sizeof(int));
+#endif
+
+   BMSsetBufferMemoryAccount(buffer, NULL);
+   BMSdestroyBufferMemory(&buffer);
+}
+
+/** checks the memory per owner of a SCIP instance */
+Test(memaccount, owners)
+{
+   SCIP* scip;
+   char testfile[SCIP_MAXSTRLEN];
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+
+   /* nothing is recorded by default */
+   cr_assert_eq(SCIPgetMemUsedMaxOwner(scip, "cons_linear"), 0);
+
+   SCIP_CALL( SCIPsetBoolParam(scip, "memory/accounting", TRUE) );
+
+   strcpy(testfile, __FILE__);
+   testfile[strlen(testfile) - 12] = '\0';  /* cutoff "memaccount.c" */
+   strcat(testfile, "../../../check/instances/MIP/lseu.mps");
+   SCIP_CALL( SCIPreadProb(scip, testfile, NULL) );
+   SCIP_CALL( SCIPpresolve(scip) );
+
+   cr_assert_gt(SCIPgetMemUsedOwner(scip, "cons_linear"), 0);
+   cr_assert_gt(SCIPgetMemUsedOwner(scip, "var"), 0);
+   cr_assert_geq(SCIPgetMemUsedMaxOwner(scip, "cons_linear"), SCIPgetMemUsedOwner(scip, "cons_linear"));
+   cr_assert_eq(SCIPgetMemUsedOwner(scip, "unknown_owner"), 0);
+
+   /* the memory of the transformed problem is given back when it is freed */
+   SCIP_CALL( SCIPfreeTransform(scip) );
+   cr_assert_lt(SCIPgetMemUsedOwner(scip, "cons_linear"), SCIPgetMemUsedMaxOwner(scip, "cons_linear"));
+
+   SCIP_CALL( SCIPsetBoolParam(scip, "memory/accounting", FALSE) );
+   cr_assert_eq(SCIPgetMemUsedOwner(scip, "cons_linear"), 0);
+
+   SCIP_CALL( SCIPfree(&scip) );
+}
@@ -0,0 +1,109 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2023 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   nodeswap.c
+ * @brief  unit test for writing the bound changes of open nodes to the swap file
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <string.h>
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+#include "include/scip_test.h"
+
+/** results of a solve */
+struct SolveResult
+{
+   SCIP_Longint          nnodes;             /**< number of processed nodes */
+   SCIP_Real             dualbound;          /**< dual bound */
+   SCIP_Real             primalbound;        /**< primal bound */
+   int                   nnodesleft;         /**< number of open nodes */
+};
+typedef struct SolveResult SOLVERESULT;
+
+/** solves p0548 without LPs up to a node limit with the given swap factor */
+static
+SCIP_RETCODE solveSwap(
+   SCIP_Real             swapfac,            /**< fraction of the memory limit at which open nodes are swapped */
+   SOLVERESULT*          result              /**< pointer to store the results */
+   )
+{
+   char testfile[SCIP_MAXSTRLEN];
+   SCIP* scip;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+
+   strcpy(testfile, __FILE__);
+   testfile[strlen(testfile) - 10] = '\0';  /* cutoff "nodeswap.c" */
+   strcat(testfile, "../../../check/instances/MIP/p0548.mps");
+   SCIP_CALL( SCIPreadProb(scip, testfile, NULL) );
+
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+
+   /* without LPs, the search does not depend on the LP states that swapped nodes release */
+   SCIP_CALL( SCIPsetIntParam(scip, "lp/solvefreq", -1) );
+   SCIP_CALL( SCIPsetLongintParam(scip, "limits/nodes", 2000LL) );
+   SCIP_CALL( SCIPsetRealParam(scip, "memory/swapfac", swapfac) );
+
+   SCIP_CALL( SCIPsolve(scip) );
+
+   result->nnodes = SCIPgetNNodes(scip);
+   result->dualbound = SCIPgetDualbound(scip);
+   result->primalbound = SCIPgetPrimalbound(scip);
+   result->nnodesleft = SCIPgetNNodesLeft(scip);
+
+   SCIP_CALL( SCIPfree(&scip) );
+
+   return SCIP_OKAY;
+}
+
+/** deinitialization method */
+static
+void teardown(void)
+{
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(nodeswap, .fini = teardown);
+
+/* TESTS */
+
+/** swapping all open nodes at every node does not change the search */
+Test(nodeswap, sameresult)
+{
+   SOLVERESULT inmemory;
+   SOLVERESULT swapped;
+
+   SCIP_CALL( solveSwap(1.0, &inmemory) );
+   SCIP_CALL( solveSwap(0.0, &swapped) );
+
+   cr_assert_gt(inmemory.nnodesleft, 0);
+   cr_assert_eq(inmemory.nnodes, swapped.nnodes);
+   cr_assert_eq(inmemory.nnodesleft, swapped.nnodesleft);
+   cr_assert_eq(inmemory.dualbound, swapped.dualbound);
+   cr_assert_eq(inmemory.primalbound, swapped.primalbound);
+}
@@ -0,0 +1,513 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2023 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+
+/**@file   conchash.c
+ * @brief  unit tests and throughput benchmark for the concurrent hash table and hash map
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <stdio.h>
+
+#include "scip/scip.h"
+#include "scip/pub_misc.h"
+#include "tpi/tpi.h"
+#include "include/scip_test.h"
+
+#define NTHREADS          4          /* number of threads */
+#define NJOBS             8          /* number of jobs accessing the table at the same time */
+#define NKEYS         20000          /* number of different keys in the stress tests */
+#define NORIGINS         64          /* number of origins whose images are incremented at the same time */
+#define NBENCHKEYS   400000          /* number of keys in the benchmark */
+
+/* global variables */
+static SCIP* scip;
+
+/** data of a job accessing a hash table */
+typedef struct JobData
+{
+   SCIP_CONCHASHTABLE*   conchashtable;      /**< concurrent hash table, or NULL */
+   SCIP_CONCHASHMAP*     conchashmap;        /**< concurrent hash map, or NULL */
+   SCIP_HASHTABLE*       hashtable;          /**< hash table guarded by lock, or NULL */
+   SCIP_LOCK*            lock;               /**< lock of the hash table */
+   int*                  keys;               /**< keys, which are also the elements, of the job */
+   int                   nkeys;              /**< number of keys */
+   int                   first;              /**< first key handled by the job */
+   int                   step;               /**< distance of the keys handled by the job */
+   int                   ninserted;          /**< number of elements that the job inserted */
+   int                   nfound;             /**< number of elements that the job found */
+} JOBDATA;
+
+/** get key of hash element */
+static
+SCIP_DECL_HASHGETKEY(getKey)
+{  /*lint --e{715}*/
+   return elem;
+}
+
+/** checks whether two keys are equal */
+static
+SCIP_DECL_HASHKEYEQ(keyEQ)
+{  /*lint --e{715}*/
+   return *(int*)key1 == *(int*)key2;
+}
+
+/** returns the hash value of the key */
+static
+SCIP_DECL_HASHKEYVAL(keyVal)
+{  /*lint --e{715}*/
+   return (uint64_t)*(int*)key;
+}
+
+/** inserts all keys of the job, which are equal for all jobs, such that only one element per key is inserted */
+static
+SCIP_RETCODE insertJob(
+   void*                 args                /**< pointer to the job's data */
+   )
+{
+   JOBDATA* data = (JOBDATA*) args;
+   int i;
+
+   for( i = 0; i < data->nkeys; ++i )
+   {
+      void* stored;
+
+      SCIP_CALL( SCIPconchashtableRetrieveOrInsert(data->conchashtable, &data->keys[i], &stored) );
+
+      if( stored == &data->keys[i] )
+         ++data->ninserted;
+      else if( *(int*)stored != data->keys[i] )
+         return SCIP_ERROR;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** removes the keys that are congruent to first modulo step and retrieves all other ones */
+static
+SCIP_RETCODE removeJob(
+   void*                 args                /**< pointer to the job's data */
+   )
+{
+   JOBDATA* data = (JOBDATA*) args;
+   int i;
+
+   for( i = 0; i < data->nkeys; ++i )
+   {
+      if( data->keys[i] % data->step == data->first )
+      {
+         SCIP_CALL( SCIPconchashtableRemove(data->conchashtable, &data->keys[i]) );
+      }
+      else if( SCIPconchashtableRetrieve(data->conchashtable, &data->keys[i]) != NULL )
+         ++data->nfound;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** increments the images of all origins */
+static
+SCIP_RETCODE incrementJob(
+   void*                 args                /**< pointer to the job's data */
+   )
+{
+   JOBDATA* data = (JOBDATA*) args;
+   int i;
+
+   for( i = 0; i < data->nkeys; ++i )
+   {
+      SCIP_CALL( SCIPconchashmapAddImageInt(data->conchashmap, (void*)&data->keys[i % NORIGINS], 1, NULL) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** inserts and retrieves every step-th key, starting at first, in the concurrent hash table or the locked hash table */
+static
+SCIP_RETCODE benchJob(
+   void*                 args                /**< pointer to the job's data */
+   )
+{
+   JOBDATA* data = (JOBDATA*) args;
+   int i;
+
+   for( i = data->first; i < data->nkeys; i += data->step )
+   {
+      if( data->conchashtable != NULL )
+      {
+         SCIP_CALL( SCIPconchashtableInsert(data->conchashtable, &data->keys[i]) );
+      }
+      else
+      {
+         SCIP_CALL( SCIPtpiAcquireLock(data->lock) );
+         SCIP_CALL( SCIPhashtableInsert(data->hashtable, &data->keys[i]) );
+         SCIP_CALL( SCIPtpiReleaseLock(data->lock) );
+      }
+   }
+
+   for( i = data->first; i < data->nkeys; i += data->step )
+   {
+      void* element;
+
+      if( data->conchashtable != NULL )
+         element = SCIPconchashtableRetrieve(data->conchashtable, &data->keys[i]);
+      else
+      {
+         SCIP_CALL( SCIPtpiAcquireLock(data->lock) );
+         element = SCIPhashtableRetrieve(data->hashtable, &data->keys[i]);
+         SCIP_CALL( SCIPtpiReleaseLock(data->lock) );
+      }
+
+      if( element != NULL )
+         ++data->nfound;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** submits one job per data entry and waits for them */
+static
+SCIP_RETCODE runJobs(
+   SCIP_RETCODE          (*jobfunc)(void* args),/**< the job function */
+   JOBDATA*              data,               /**< the job data */
+   int                   njobs               /**< number of jobs */
+   )
+{
+   int jobid;
+   int i;
+
+   jobid = SCIPtpiGetNewJobID();
+
+   for( i = 0; i < njobs; ++i )
+   {
+      SCIP_JOB* job;
+      SCIP_SUBMITSTATUS status;
+
+      SCIP_CALL( SCIPtpiCreateJob(&job, jobid, jobfunc, (void*) &data[i]) );
+      SCIP_CALL( SCIPtpiSubmitJob(job, &status) );
+      cr_assert_eq(status, SCIP_SUBMIT_SUCCESS);
+   }
+
+   return SCIPtpiCollectJobs(jobid);
+}
+
+/** inserts and retrieves the keys with the given number of jobs and returns the elapsed wall clock time in seconds */
+static
+SCIP_Real runBenchmark(
+   SCIP_CONCHASHTABLE*   conchashtable,      /**< concurrent hash table, or NULL to use hashtable */
+   SCIP_HASHTABLE*       hashtable,          /**< hash table to use if conchashtable is NULL */
+   SCIP_LOCK*            lock,               /**< lock of the hash table */
+   int*                  keys,               /**< keys */
+   int                   njobs               /**< number of jobs, or 0 to access the hash table without jobs and lock */
+   )
+{
+   JOBDATA data[NTHREADS];
+   SCIP_CLOCK* clock;
+   SCIP_Real time;
+   int nfound = 0;
+   int j;
+
+   for( j = 0; j < MAX(njobs, 1); ++j )
+   {
+      data[j].conchashtable = conchashtable;
+      data[j].conchashmap = NULL;
+      data[j].hashtable = hashtable;
+      data[j].lock = lock;
+      data[j].keys = keys;
+      data[j].nkeys = NBENCHKEYS;
+      data[j].first = j;
+      data[j].step = MAX(njobs, 1);
+      data[j].ninserted = 0;
+      data[j].nfound = 0;
+   }
+
+   SCIP_CALL_ABORT( SCIPcreateWallClock(scip, &clock) );
+   SCIPstartClock(scip, clock);
+
+   if( njobs == 0 )
+   {
+      int i;
+
+      for( i = 0; i < NBENCHKEYS; ++i )
+      {
+         SCIP_CALL_ABORT( SCIPhashtableInsert(hashtable, &keys[i]) );
+      }
+      for( i = 0; i < NBENCHKEYS; ++i )
+      {
+         if( SCIPhashtableRetrieve(hashtable, &keys[i]) != NULL )
+            ++data[0].nfound;
+      }
+   }
+   else
+   {
+      SCIP_CALL_ABORT( runJobs(benchJob, data, njobs) );
+   }
+
+   SCIPstopClock(scip, clock);
+   time = SCIPgetClockTime(scip, clock);
+   SCIP_CALL_ABORT( SCIPfreeClock(scip, &clock) );
+
+   for( j = 0; j < MAX(njobs, 1); ++j )
+      nfound += data[j].nfound;
+   cr_assert_eq(nfound, NBENCHKEYS);
+
+   return time;
+}
+
+/** setup of test run */
+static
+void setup(void)
+{
+   SCIP_CALL( SCIPcreate(&scip) );
+}
+
+/** deinitialization method */
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(conchash, .init = setup, .fini = teardown);
+
+/* TESTS */
+
+/** checks the methods of the concurrent hash table and hash map in a single thread */
+Test(conchash, sequential)
+{
+   SCIP_CONCHASHTABLE* hashtable;
+   SCIP_CONCHASHMAP* hashmap;
+   int keys[100];
+   int copies[100];
+   int image;
+   int i;
+
+   SCIP_CALL( SCIPconchashtableCreate(&hashtable, SCIPblkmem(scip), 10, 5, getKey, keyEQ, keyVal, NULL) );
+   cr_assert_eq(SCIPconchashtableGetNStripes(hashtable), 8);
+
+   for( i = 0; i < 100; ++i )
+   {
+      keys[i] = i;
+      copies[i] = i;
+      SCIP_CALL( SCIPconchashtableSafeInsert(hashtable, &keys[i]) );
+   }
+   cr_assert_eq(SCIPconchashtableGetNElements(hashtable), 100);
+
+   for( i = 0; i < 100; ++i )
+   {
+      void* stored;
+
+      cr_assert_eq(SCIPconchashtableRetrieve(hashtable, &copies[i]), &keys[i]);
+      cr_assert(SCIPconchashtableExists(hashtable, &copies[i]));
+
+      SCIP_CALL( SCIPconchashtableRetrieveOrInsert(hashtable, &copies[i], &stored) );
+      cr_assert_eq(stored, &keys[i]);
+   }
+
+   for( i = 0; i < 100; i += 2 )
+   {
+      SCIP_CALL( SCIPconchashtableRemove(hashtable, &keys[i]) );
+   }
+   cr_assert_eq(SCIPconchashtableGetNElements(hashtable), 50);
+   cr_assert_null(SCIPconchashtableRetrieve(hashtable, &copies[42]));
+   cr_assert_not_null(SCIPconchashtableRetrieve(hashtable, &copies[43]));
+
+   SCIP_CALL( SCIPconchashtableRemoveAll(hashtable) );
+   cr_assert_eq(SCIPconchashtableGetNElements(hashtable), 0);
+
+   SCIPconchashtableFree(&hashtable);
+
+   SCIP_CALL( SCIPconchashmapCreate(&hashmap, SCIPblkmem(scip), 10, 1) );
+
+   for( i = 0; i < 100; ++i )
+   {
+      SCIP_CALL( SCIPconchashmapInsertInt(hashmap, &keys[i], i) );
+   }
+   cr_assert_eq(SCIPconchashmapGetNElements(hashmap), 100);
+   cr_assert_eq(SCIPconchashmapGetImageInt(hashmap, &keys[17]), 17);
+   cr_assert_eq(SCIPconchashmapGetImageInt(hashmap, &copies[17]), INT_MAX);
+
+   SCIP_CALL( SCIPconchashmapAddImageInt(hashmap, &keys[17], 3, &image) );
+   cr_assert_eq(image, 17);
+   cr_assert_eq(SCIPconchashmapGetImageInt(hashmap, &keys[17]), 20);
+
+   SCIP_CALL( SCIPconchashmapAddImageInt(hashmap, &copies[17], 3, &image) );
+   cr_assert_eq(image, 0);
+   cr_assert_eq(SCIPconchashmapGetNElements(hashmap), 101);
+
+   SCIP_CALL( SCIPconchashmapRemove(hashmap, &keys[17]) );
+   cr_assert(!SCIPconchashmapExists(hashmap, &keys[17]));
+   cr_assert(SCIPconchashmapExists(hashmap, &copies[17]));
+
+   SCIP_CALL( SCIPconchashmapRemoveAll(hashmap) );
+   cr_assert_eq(SCIPconchashmapGetNElements(hashmap), 0);
+
+   SCIPconchashmapFree(&hashmap);
+}
+
+/** inserts equal keys and removes keys from several threads at the same time */
+Test(conchash, stress)
+{
+   SCIP_CONCHASHTABLE* hashtable;
+   JOBDATA data[NJOBS];
+   int* keys[NJOBS];
+   int ninserted = 0;
+   int j;
+   int i;
+
+   if( !SCIPtpiIsAvailable() )
+      return;
+
+   SCIP_CALL( SCIPtpiInit(NTHREADS, INT_MAX, FALSE) );
+
+   /* start with a small table, such that the stripes are resized while the jobs insert */
+   SCIP_CALL( SCIPconchashtableCreate(&hashtable, SCIPblkmem(scip), 0, 2 * NTHREADS, getKey, keyEQ, keyVal, NULL) );
+
+   for( j = 0; j < NJOBS; ++j )
+   {
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &keys[j], NKEYS) );
+
+      /* the jobs insert the keys in different orders */
+      for( i = 0; i < NKEYS; ++i )
+         keys[j][i] = (j % 2 == 0) ? i : NKEYS - 1 - i;
+
+      data[j].conchashtable = hashtable;
+      data[j].conchashmap = NULL;
+      data[j].keys = keys[j];
+      data[j].nkeys = NKEYS;
+      data[j].first = j;
+      data[j].step = NJOBS;
+      data[j].ninserted = 0;
+      data[j].nfound = 0;
+   }
+
+   /* exactly one element per key is inserted */
+   SCIP_CALL( runJobs(insertJob, data, NJOBS) );
+
+   for( j = 0; j < NJOBS; ++j )
+      ninserted += data[j].ninserted;
+   cr_assert_eq(ninserted, NKEYS);
+   cr_assert_eq(SCIPconchashtableGetNElements(hashtable), NKEYS);
+
+   /* every key is removed by one job, while the other jobs may or may not find it */
+   SCIP_CALL( runJobs(removeJob, data, NJOBS) );
+   cr_assert_eq(SCIPconchashtableGetNElements(hashtable), 0);
+
+   for( j = 0; j < NJOBS; ++j )
+   {
+      cr_assert_leq(data[j].nfound, NKEYS - NKEYS / NJOBS);
+      SCIPfreeBlockMemoryArray(scip, &keys[j], NKEYS);
+   }
+
+   SCIPconchashtableFree(&hashtable);
+
+   SCIP_CALL( SCIPtpiExit() );
+}
+
+/** increments the images of the same origins from several threads at the same time */
+Test(conchash, increments)
+{
+   SCIP_CONCHASHMAP* hashmap;
+   JOBDATA data[NJOBS];
+   int keys[NORIGINS];
+   int j;
+   int i;
+
+   if( !SCIPtpiIsAvailable() )
+      return;
+
+   SCIP_CALL( SCIPtpiInit(NTHREADS, INT_MAX, FALSE) );
+
+   SCIP_CALL( SCIPconchashmapCreate(&hashmap, SCIPblkmem(scip), 0, NTHREADS) );
+
+   for( j = 0; j < NJOBS; ++j )
+   {
+      data[j].conchashtable = NULL;
+      data[j].conchashmap = hashmap;
+      data[j].keys = keys;
+      data[j].nkeys = NKEYS;
+   }
+
+   SCIP_CALL( runJobs(incrementJob, data, NJOBS) );
+
+   cr_assert_eq(SCIPconchashmapGetNElements(hashmap), NORIGINS);
+
+   for( i = 0; i < NORIGINS; ++i )
+      cr_assert_eq(SCIPconchashmapGetImageInt(hashmap, &keys[i]), NJOBS * (NKEYS / NORIGINS + (i < NKEYS % NORIGINS)));
+
+   SCIPconchashmapFree(&hashmap);
+
+   SCIP_CALL( SCIPtpiExit() );
+}
+
+/** compares the throughput of the hash table, the hash table guarded by a lock, and the concurrent hash table */
+Test(conchash, benchmark)
+{
+   SCIP_CONCHASHTABLE* conchashtable;
+   SCIP_HASHTABLE* hashtable;
+   SCIP_LOCK* lock;
+   int* keys;
+   SCIP_Real time;
+   int i;
+
+   if( !SCIPtpiIsAvailable() )
+      return;
+
+   SCIP_CALL( SCIPtpiInit(NTHREADS, INT_MAX, FALSE) );
+   SCIP_CALL( SCIPtpiInitLock(&lock) );
+
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &keys, NBENCHKEYS) );
+   for( i = 0; i < NBENCHKEYS; ++i )
+      keys[i] = i;
+
+   /* all tables are created with their final size, such that only the accesses are measured */
+   SCIP_CALL( SCIPhashtableCreate(&hashtable, SCIPblkmem(scip), NBENCHKEYS, getKey, keyEQ, keyVal, NULL) );
+   time = runBenchmark(NULL, hashtable, lock, keys, 0);
+   printf("hash table, 1 thread:                    %6.1f Mops/s\n", 2e-6 * NBENCHKEYS / MAX(time, 1e-6));
+   SCIPhashtableFree(&hashtable);
+
+   SCIP_CALL( SCIPhashtableCreate(&hashtable, SCIPblkmem(scip), NBENCHKEYS, getKey, keyEQ, keyVal, NULL) );
+   time = runBenchmark(NULL, hashtable, lock, keys, NTHREADS);
+   printf("hash table with lock, %d threads:         %6.1f Mops/s\n", NTHREADS, 2e-6 * NBENCHKEYS / MAX(time, 1e-6));
+   SCIPhashtableFree(&hashtable);
+
+   SCIP_CALL( SCIPconchashtableCreate(&conchashtable, SCIPblkmem(scip), NBENCHKEYS, 1, getKey, keyEQ, keyVal, NULL) );
+   time = runBenchmark(conchashtable, NULL, NULL, keys, 1);
+   printf("concurrent hash table, 1 thread:         %6.1f Mops/s\n", 2e-6 * NBENCHKEYS / MAX(time, 1e-6));
+   SCIPconchashtableFree(&conchashtable);
+
+   SCIP_CALL( SCIPconchashtableCreate(&conchashtable, SCIPblkmem(scip), NBENCHKEYS, 4 * NTHREADS, getKey, keyEQ, keyVal,
+         NULL) );
+   time = runBenchmark(conchashtable, NULL, NULL, keys, NTHREADS);
+   printf("concurrent hash table, %d threads:        %6.1f Mops/s\n", NTHREADS, 2e-6 * NBENCHKEYS / MAX(time, 1e-6));
+   SCIPconchashtableFree(&conchashtable);
+
+   SCIPfreeBlockMemoryArray(scip, &keys, NBENCHKEYS);
+
+   SCIPtpiDestroyLock(&lock);
+   SCIP_CALL( SCIPtpiExit() );
+}
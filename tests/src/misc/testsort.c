@@ -28,6 +28,7 @@
  */
 
 #include<stdio.h>
+#include<limits.h>
 
 #include "scip/pub_misc.h"
 #include "scip/scip.h"
@@ -186,3 +187,102 @@ Test(sort, desc_sort_down, .description = "tests SCIPsortDown by checking that t
 
    SCIPfreeBufferArray(scip, &perm);
 }
+
+#define NLARGE 5000     /* number of elements of the large arrays, which are sorted by radix sort */
+
+Test(sort, radix_int, .description = "tests sorting large int arrays with the permutation of an additional field")
+{
+   int* keys;
+   int* orig;
+   int* inds;
+   int i;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &keys, NLARGE) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &orig, NLARGE) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &inds, NLARGE) );
+
+   for( i = 0; i < NLARGE; ++i )
+   {
+      orig[i] = (int)((i * 7919L) % 1001) - 500;
+      inds[i] = i;
+   }
+   orig[0] = INT_MIN;
+   orig[1] = INT_MAX;
+   BMScopyMemoryArray(keys, orig, NLARGE);
+
+   SCIPsortIntInt(keys, inds, NLARGE);
+
+   cr_assert_eq(keys[0], INT_MIN);
+   cr_assert_eq(keys[NLARGE-1], INT_MAX);
+   for( i = 0; i < NLARGE; ++i )
+   {
+      cr_assert_eq(keys[i], orig[inds[i]]);
+      if( i > 0 )
+         cr_assert_leq(keys[i-1], keys[i]);
+   }
+
+   SCIPsortDownIntInt(keys, inds, NLARGE);
+
+   cr_assert_eq(keys[0], INT_MAX);
+   cr_assert_eq(keys[NLARGE-1], INT_MIN);
+   for( i = 0; i < NLARGE; ++i )
+   {
+      cr_assert_eq(keys[i], orig[inds[i]]);
+      if( i > 0 )
+         cr_assert_geq(keys[i-1], keys[i]);
+   }
+
+   SCIPfreeBufferArray(scip, &inds);
+   SCIPfreeBufferArray(scip, &orig);
+   SCIPfreeBufferArray(scip, &keys);
+}
+
+Test(sort, radix_real, .description = "tests sorting large real arrays with the permutation of an additional field")
+{
+   SCIP_Real* keys;
+   SCIP_Real* orig;
+   int* inds;
+   int i;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &keys, NLARGE) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &orig, NLARGE) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &inds, NLARGE) );
+
+   for( i = 0; i < NLARGE; ++i )
+   {
+      orig[i] = ((i * 7919L) % 2001 - 1000) / 7.0;
+      inds[i] = i;
+   }
+   orig[0] = -SCIPinfinity(scip);
+   orig[1] = SCIPinfinity(scip);
+   orig[2] = -0.0;
+   orig[3] = 1e-300;
+   orig[4] = -1e-300;
+   BMScopyMemoryArray(keys, orig, NLARGE);
+
+   SCIPsortRealInt(keys, inds, NLARGE);
+
+   cr_assert_eq(keys[0], -SCIPinfinity(scip));
+   cr_assert_eq(keys[NLARGE-1], SCIPinfinity(scip));
+   for( i = 0; i < NLARGE; ++i )
+   {
+      cr_assert_eq(keys[i], orig[inds[i]]);
+      if( i > 0 )
+         cr_assert_leq(keys[i-1], keys[i]);
+   }
+
+   SCIPsortDownRealInt(keys, inds, NLARGE);
+
+   cr_assert_eq(keys[0], SCIPinfinity(scip));
+   cr_assert_eq(keys[NLARGE-1], -SCIPinfinity(scip));
+   for( i = 0; i < NLARGE; ++i )
+   {
+      cr_assert_eq(keys[i], orig[inds[i]]);
+      if( i > 0 )
+         cr_assert_geq(keys[i-1], keys[i]);
+   }
+
+   SCIPfreeBufferArray(scip, &inds);
+   SCIPfreeBufferArray(scip, &orig);
+   SCIPfreeBufferArray(scip, &keys);
+}
@@ -0,0 +1,129 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2023 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   obbtnthreads.c
+ * @brief  unit test checking that parallel OBBT finds the same bounds for any number of threads
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <string.h>
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+#include "tpi/tpi.h"
+#include "include/scip_test.h"
+
+#define MAXNVARS 100
+
+/** results of a root node solve that depend on the bounds found by OBBT */
+typedef struct SolveResult
+{
+   SCIP_Longint          ndomreds;           /**< number of domain reductions found by OBBT */
+   SCIP_Real             lbs[MAXNVARS];      /**< global lower bounds of the transformed variables */
+   SCIP_Real             ubs[MAXNVARS];      /**< global upper bounds of the transformed variables */
+   int                   nvars;              /**< number of transformed variables */
+   SCIP_Real             dualbound;          /**< dual bound */
+} SOLVERESULT;
+
+/** solves the root node of the instance with OBBT using the given number of threads */
+static
+SCIP_RETCODE solveObbt(
+   int                   nthreads,           /**< number of threads used to solve the OBBT LPs */
+   SOLVERESULT*          result              /**< pointer to store the results of the solve */
+   )
+{
+   SCIP* scip;
+   SCIP_VAR** vars;
+   SCIP_PROP* prop;
+   char testfile[SCIP_MAXSTRLEN];
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+
+   strcpy(testfile, __FILE__);
+   testfile[strlen(testfile) - 14] = '\0';  /* cutoff "obbtnthreads.c" */
+   strcat(testfile, "../../../check/instances/MINLP/pointpack06.osil");
+   SCIP_CALL( SCIPreadProb(scip, testfile, NULL) );
+
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+   SCIP_CALL( SCIPsetIntParam(scip, "parallel/mode", 1) );
+   SCIP_CALL( SCIPsetIntParam(scip, "parallel/maxnthreads", nthreads) );
+   SCIP_CALL( SCIPsetIntParam(scip, "propagating/obbt/nthreads", nthreads) );
+
+   /* the split of the iteration limit between the threads would make the result depend on their number */
+   SCIP_CALL( SCIPsetRealParam(scip, "propagating/obbt/itlimitfactor", -1.0) );
+   SCIP_CALL( SCIPsetLongintParam(scip, "limits/nodes", 1LL) );
+
+   SCIP_CALL( SCIPsolve(scip) );
+
+   prop = SCIPfindProp(scip, "obbt");
+   cr_assert_not_null(prop);
+
+   result->ndomreds = SCIPpropGetNDomredsFound(prop);
+   result->dualbound = SCIPgetDualbound(scip);
+
+   vars = SCIPgetVars(scip);
+   result->nvars = SCIPgetNVars(scip);
+   cr_assert_leq(result->nvars, MAXNVARS);
+
+   for( i = 0; i < result->nvars; ++i )
+   {
+      result->lbs[i] = SCIPvarGetLbGlobal(vars[i]);
+      result->ubs[i] = SCIPvarGetUbGlobal(vars[i]);
+   }
+
+   SCIP_CALL( SCIPfree(&scip) );
+
+   return SCIP_OKAY;
+}
+
+/* TESTS */
+
+/** checks that the bounds found by parallel OBBT do not depend on the number of threads */
+Test(obbtnthreads, bounds)
+{
+   SOLVERESULT twothreads;
+   SOLVERESULT fourthreads;
+   int i;
+
+   if( !SCIPtpiIsAvailable() )
+      return;
+
+   SCIP_CALL( solveObbt(2, &twothreads) );
+   SCIP_CALL( solveObbt(4, &fourthreads) );
+
+   cr_assert_eq(fourthreads.ndomreds, twothreads.ndomreds);
+   cr_assert_eq(fourthreads.nvars, twothreads.nvars);
+   cr_assert_float_eq(fourthreads.dualbound, twothreads.dualbound, 1e-6);
+
+   for( i = 0; i < twothreads.nvars; ++i )
+   {
+      cr_assert_float_eq(fourthreads.lbs[i], twothreads.lbs[i], 1e-6);
+      cr_assert_float_eq(fourthreads.ubs[i], twothreads.ubs[i], 1e-6);
+   }
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
@@ -0,0 +1,255 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2023 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   jobs.c
+ * @brief  unit tests for the job interface of the TPI
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "tpi/tpi.h"
+#include "include/scip_test.h"
+
+#define NSHORTWORK     2000          /* number of iterations of a short job */
+#define NNESTEDJOBS    16            /* number of jobs submitted by a nested job */
+
+/* global variables */
+static SCIP* scip;
+
+/** data of a single job */
+typedef struct JobData
+{
+   int                   niterations;        /**< number of iterations of the job */
+   double                result;             /**< result of the job's computation */
+   SCIP_RETCODE          retcode;            /**< return code the job should return */
+} JOBDATA;
+
+/** a job that performs a number of floating point operations */
+static
+SCIP_RETCODE workJob(
+   void*                 args                /**< pointer to the job's data */
+   )
+{
+   JOBDATA* data = (JOBDATA*) args;
+   double x = 1.0;
+   int i;
+
+   for( i = 0; i < data->niterations; ++i )
+      x = 0.5 * x + 1.0 / (i + 1.0);
+
+   data->result = x;
+
+   return data->retcode;
+}
+
+/** a job that submits and collects further jobs */
+static
+SCIP_RETCODE nestedJob(
+   void*                 args                /**< pointer to the data of the nested jobs */
+   )
+{
+   JOBDATA* data = (JOBDATA*) args;
+   int jobid;
+   int i;
+
+   jobid = SCIPtpiGetNewJobID();
+
+   for( i = 0; i < NNESTEDJOBS; ++i )
+   {
+      SCIP_JOB* job;
+      SCIP_SUBMITSTATUS status;
+
+      SCIP_CALL( SCIPtpiCreateJob(&job, jobid, workJob, (void*) &data[i]) );
+      SCIP_CALL( SCIPtpiSubmitJob(job, &status) );
+      assert(status == SCIP_SUBMIT_SUCCESS);
+   }
+
+   SCIP_CALL( SCIPtpiCollectJobs(jobid) );
+
+   return SCIP_OKAY;
+}
+
+/** a job that increments a shared counter atomically */
+static
+SCIP_RETCODE atomicJob(
+   void*                 args                /**< pointer to the shared counter */
+   )
+{
+   int* counter = (int*) args;
+   int i;
+
+   for( i = 0; i < NSHORTWORK; ++i )
+      (void) SCIPtpiAtomicFetchAddInt(counter, 1);
+
+   return SCIP_OKAY;
+}
+
+/** submits njobs jobs of the given function with the given data and waits for them */
+static
+SCIP_RETCODE runJobs(
+   SCIP_RETCODE          (*jobfunc)(void* args),/**< the job function */
+   JOBDATA*              data,               /**< the job data */
+   int                   datasize,           /**< number of data entries consumed by each job */
+   int                   njobs               /**< number of jobs */
+   )
+{
+   int jobid;
+   int i;
+
+   jobid = SCIPtpiGetNewJobID();
+
+   for( i = 0; i < njobs; ++i )
+   {
+      SCIP_JOB* job;
+      SCIP_SUBMITSTATUS status;
+
+      SCIP_CALL( SCIPtpiCreateJob(&job, jobid, jobfunc, (void*) &data[i * datasize]) );
+      SCIP_CALL( SCIPtpiSubmitJob(job, &status) );
+      cr_assert_eq(status, SCIP_SUBMIT_SUCCESS);
+   }
+
+   return SCIPtpiCollectJobs(jobid);
+}
+
+/** setup of test run */
+static
+void setup(void)
+{
+   SCIP_CALL( SCIPcreate(&scip) );
+}
+
+/** deinitialization method */
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(jobs, .init = setup, .fini = teardown);
+
+/* TESTS */
+
+/** checks that all jobs are processed and that the smallest return code is reported */
+Test(jobs, retcodes)
+{
+   JOBDATA data[100];
+   int i;
+
+   if( !SCIPtpiIsAvailable() )
+      return;
+
+   for( i = 0; i < 100; ++i )
+   {
+      data[i].niterations = i;
+      data[i].result = 0.0;
+      data[i].retcode = (i == 42 ? SCIP_INVALIDDATA : SCIP_OKAY);
+   }
+
+   SCIP_CALL( SCIPtpiInit(4, INT_MAX, FALSE) );
+
+   cr_assert_eq(runJobs(workJob, data, 1, 100), SCIP_INVALIDDATA);
+
+   for( i = 1; i < 100; ++i )
+      cr_assert_gt(data[i].result, 0.0);
+
+   /* the tpi is reference counted, so a second initialization shares the threads and only adds the missing ones */
+   SCIP_CALL( SCIPtpiInit(2, INT_MAX, FALSE) );
+   cr_assert_eq(SCIPtpiGetNumThreads(), 4);
+   SCIP_CALL( SCIPtpiExit() );
+
+   SCIP_CALL( SCIPtpiInit(8, INT_MAX, FALSE) );
+   cr_assert_eq(SCIPtpiGetNumThreads(), 8);
+   SCIP_CALL( SCIPtpiExit() );
+   cr_assert_eq(SCIPtpiGetNumThreads(), 8);
+
+   data[42].retcode = SCIP_OKAY;
+   cr_assert_eq(runJobs(workJob, data, 1, 100), SCIP_OKAY);
+
+   SCIP_CALL( SCIPtpiExit() );
+}
+
+/** checks that jobs submitting and collecting jobs do not block the pool, even if there are more nested jobs than
+ *  threads
+ */
+Test(jobs, nested)
+{
+   JOBDATA data[8 * NNESTEDJOBS];
+   int i;
+
+   if( !SCIPtpiIsAvailable() )
+      return;
+
+   for( i = 0; i < 8 * NNESTEDJOBS; ++i )
+   {
+      data[i].niterations = NSHORTWORK;
+      data[i].result = 0.0;
+      data[i].retcode = SCIP_OKAY;
+   }
+
+   SCIP_CALL( SCIPtpiInit(2, INT_MAX, FALSE) );
+
+   SCIP_CALL( runJobs(nestedJob, data, NNESTEDJOBS, 8) );
+
+   for( i = 0; i < 8 * NNESTEDJOBS; ++i )
+      cr_assert_gt(data[i].result, 0.0);
+
+   SCIP_CALL( SCIPtpiExit() );
+}
+
+/** checks that concurrent atomic increments are not lost */
+Test(jobs, atomics)
+{
+   int counter = 0;
+   int jobid;
+   int i;
+
+   if( !SCIPtpiIsAvailable() )
+      return;
+
+   SCIP_CALL( SCIPtpiInit(4, INT_MAX, FALSE) );
+
+   jobid = SCIPtpiGetNewJobID();
+
+   for( i = 0; i < 16; ++i )
+   {
+      SCIP_JOB* job;
+      SCIP_SUBMITSTATUS status;
+
+      SCIP_CALL( SCIPtpiCreateJob(&job, jobid, atomicJob, (void*) &counter) );
+      SCIP_CALL( SCIPtpiSubmitJob(job, &status) );
+      cr_assert_eq(status, SCIP_SUBMIT_SUCCESS);
+   }
+
+   SCIP_CALL( SCIPtpiCollectJobs(jobid) );
+
+   cr_assert_eq(SCIPtpiAtomicLoadInt(&counter), 16 * NSHORTWORK);
+   cr_assert_eq(SCIPtpiAtomicFetchAddInt(&counter, -16 * NSHORTWORK), 16 * NSHORTWORK);
+   SCIPtpiAtomicStoreInt(&counter, 42);
+   cr_assert_eq(SCIPtpiAtomicLoadInt(&counter), 42);
+
+   SCIP_CALL( SCIPtpiExit() );
+}